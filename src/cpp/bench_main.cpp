@@ -0,0 +1,1659 @@
+/**
+ * nanobrain_bench - NanoBrain benchmark suite
+ *
+ * Runs microbenchmarks over the hot paths (random tensor initialization,
+ * coherence, time crystal stepping, encoding, attention diffusion, reasoning,
+ * multimodal stream fusion, time circuit pipelines, concept-wheel indexing,
+ * capsule spill/thaw, cellular automata, shared thread pool dispatch, ggml
+ * context memory provisioning, cold start, persistence, Atomese parsing, AtomSpace pattern
+ * queries, fractal condensation fields) and end-to-end
+ * UnifiedNanoBrainKernel::process_cycle throughput on deterministic
+ * synthetic AtomSpaces, plus sharded cycle scaling from 1 to 32 shards, then
+ * writes machine-readable JSON.
+ *
+ * Usage:
+ *   nanobrain_bench [--min-atoms N] [--max-atoms N] [--link-density F]
+ *                   [--primes uniform|small|zipf|single] [--seed N]
+ *                   [--min-time-ms F] [--max-iterations N]
+ *                   [--filter SUBSTR] [--out FILE] [--trace FILE]
+ *                   [--verbose]
+ *
+ * --trace writes a Chrome trace of every case; it needs a build configured
+ * with -DNANOBRAIN_ENABLE_TRACING=ON.
+ */
+
+#include "nanobrain_atomese.h"
+#include "nanobrain_bench.h"
+#include "nanobrain_brain_model.h"
+#include "nanobrain_brain_jelly.h"
+#include "nanobrain_circuit_pipeline.h"
+#include "nanobrain_distributed.h"
+#include "nanobrain_persistence.h"
+#include "nanobrain_ppm.h"
+#include "nanobrain_query.h"
+#include "nanobrain_sharded.h"
+#include "nanobrain_singularity.h"
+#include "nanobrain_synthetic.h"
+#include "nanobrain_trace.h"
+#include "nanobrain_unified.h"
+#include "nanobrain_wheel_index.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ================================================================
+// Allocation Counting
+// ================================================================
+
+// Global operator new/delete are replaced so cases can report heap
+// allocations per iteration
+static std::atomic<uint64_t> heap_allocations{0};
+
+void *operator new(std::size_t size) {
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+static uint64_t allocation_count() {
+  return heap_allocations.load(std::memory_order_relaxed);
+}
+
+// ================================================================
+// dTLB Miss Counting
+// ================================================================
+
+// Data-TLB read misses of the calling thread via perf events; available()
+// is false where perf is missing or restricted
+class TlbMissCounter {
+public:
+  TlbMissCounter() {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~TlbMissCounter() {
+#if defined(__linux__)
+    if (fd >= 0)
+      close(fd);
+#endif
+  }
+
+  bool available() const { return fd >= 0; }
+
+  void start() {
+#if defined(__linux__)
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  uint64_t stop() {
+    uint64_t count = 0;
+#if defined(__linux__)
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) != sizeof(count))
+        count = 0;
+    }
+#endif
+    return count;
+  }
+
+private:
+  int fd = -1;
+};
+
+// ================================================================
+// Options
+// ================================================================
+
+struct BenchSuiteOptions {
+  size_t min_atoms = 1000;
+  size_t max_atoms = 100000;
+  float link_density = 0.1f;
+  PrimeDistribution primes = PrimeDistribution::SmallPrimeBiased;
+  uint64_t seed = 42;
+  std::string out_path;
+  std::string trace_path;
+  BenchmarkOptions runner;
+};
+
+static void print_usage() {
+  std::cerr << "Usage: nanobrain_bench [--min-atoms N] [--max-atoms N]\n"
+               "                       [--link-density F]\n"
+               "                       [--primes uniform|small|zipf|single]\n"
+               "                       [--seed N] [--min-time-ms F]\n"
+               "                       [--max-iterations N] [--filter S]\n"
+               "                       [--out FILE] [--trace FILE]\n"
+               "                       [--verbose]\n";
+}
+
+static bool parse_args(int argc, char **argv, BenchSuiteOptions &opts) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto value = [&](const char *name) -> const char * {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << name << std::endl;
+        return nullptr;
+      }
+      return argv[++i];
+    };
+    const char *v = nullptr;
+    if (arg == "--min-atoms" && (v = value("--min-atoms"))) {
+      opts.min_atoms = std::strtoull(v, nullptr, 10);
+    } else if (arg == "--max-atoms" && (v = value("--max-atoms"))) {
+      opts.max_atoms = std::strtoull(v, nullptr, 10);
+    } else if (arg == "--link-density" && (v = value("--link-density"))) {
+      opts.link_density = std::strtof(v, nullptr);
+    } else if (arg == "--primes" && (v = value("--primes"))) {
+      if (!parse_prime_distribution(v, opts.primes)) {
+        std::cerr << "Unknown prime distribution: " << v << std::endl;
+        return false;
+      }
+    } else if (arg == "--seed" && (v = value("--seed"))) {
+      opts.seed = std::strtoull(v, nullptr, 10);
+    } else if (arg == "--min-time-ms" && (v = value("--min-time-ms"))) {
+      opts.runner.min_time_ms = std::strtod(v, nullptr);
+    } else if (arg == "--max-iterations" && (v = value("--max-iterations"))) {
+      opts.runner.max_iterations = std::strtoull(v, nullptr, 10);
+    } else if (arg == "--filter" && (v = value("--filter"))) {
+      opts.runner.filter = v;
+    } else if (arg == "--out" && (v = value("--out"))) {
+      opts.out_path = v;
+    } else if (arg == "--trace" && (v = value("--trace"))) {
+      opts.trace_path = v;
+    } else if (arg == "--verbose") {
+      opts.runner.quiet = false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ================================================================
+// Helpers
+// ================================================================
+
+// Atom counts 10^k within [min_atoms, max_atoms], clipped to a per-case cap
+static std::vector<size_t> atom_sizes(const BenchSuiteOptions &opts,
+                                      size_t cap) {
+  std::vector<size_t> sizes;
+  for (size_t n = 1000; n <= 10000000; n *= 10) {
+    if (n >= opts.min_atoms && n <= opts.max_atoms && n <= cap) {
+      sizes.push_back(n);
+    }
+  }
+  return sizes;
+}
+
+static SyntheticAtomSpaceConfig synthetic_config(const BenchSuiteOptions &opts,
+                                                 size_t atoms) {
+  SyntheticAtomSpaceConfig cfg;
+  cfg.atom_count = atoms;
+  cfg.link_density = opts.link_density;
+  cfg.prime_distribution = opts.primes;
+  cfg.seed = opts.seed;
+  return cfg;
+}
+
+static std::map<std::string, double> size_params(const BenchSuiteOptions &opts,
+                                                 size_t atoms) {
+  return {{"atoms", static_cast<double>(atoms)},
+          {"link_density", opts.link_density},
+          {"prime_distribution", static_cast<double>(opts.primes)}};
+}
+
+// ggml context size: fixed headroom plus a per-atom budget
+static size_t context_bytes(size_t atoms, size_t bytes_per_atom) {
+  return (64u << 20) + atoms * bytes_per_atom;
+}
+
+static std::unique_ptr<TimeCrystalKernel>
+make_populated_kernel(const BenchSuiteOptions &opts, size_t atoms,
+                      size_t bytes_per_atom) {
+  TimeCrystalConfig tc_config;
+  tc_config.memory_size = context_bytes(atoms, bytes_per_atom);
+  auto kernel = std::make_unique<TimeCrystalKernel>(tc_config);
+  kernel->initialize();
+  SyntheticAtomSpaceGenerator generator(synthetic_config(opts, atoms));
+  generator.populate(*kernel);
+  return kernel;
+}
+
+// Mirrors UnifiedNanoBrainKernel::build_node_tensors/build_link_tensors
+static void build_tensors(TimeCrystalKernel &kernel,
+                          AtomSpaceTensorEncoder &encoder,
+                          std::vector<NodeTensor *> &nodes,
+                          std::vector<LinkTensor *> &links) {
+  for (const auto &id : kernel.get_all_atom_ids()) {
+    const auto *atom = kernel.get_atom(id);
+    Atom a;
+    a.id = atom->id;
+    a.type = atom->type;
+    a.name = atom->name;
+    a.truth_value[0] = atom->truth_value.strength;
+    a.truth_value[1] = atom->truth_value.confidence;
+    a.truth_value[2] = atom->truth_value.count;
+    a.attention_value[0] = atom->attention_value.sti;
+    a.attention_value[1] = atom->attention_value.lti;
+    a.attention_value[2] = atom->attention_value.vlti;
+    if (NodeTensor *node = encoder.encode_atom(a)) {
+      nodes.push_back(node);
+    }
+  }
+
+  NanoBrainKernel *tensors = kernel.get_tensor_kernel();
+  for (const auto &inf_id : kernel.get_all_inference_ids()) {
+    const auto *inference = kernel.get_inference(inf_id);
+    LinkTensor *link = new LinkTensor();
+    link->id = "link_" + inf_id;
+    link->atom_id = inference->conclusion_id;
+    link->source_nodes = inference->premise_ids;
+    link->target_nodes = {inference->conclusion_id};
+    link->relation_tensor =
+        tensors->create_tensor({32}, TensorInitPolicy::zero());
+    link->attention_weights =
+        tensors->create_tensor({1}, TensorInitPolicy::zero());
+    link->truth_value_tensor = tensors->create_tensor_from(
+        {inference->fractal_convergence, inference->quantum_coherence, 1.0f});
+    links.push_back(link);
+  }
+}
+
+// Node tensors belong to the encoder's cache; only links are ours to free
+template <typename T> static void delete_all(std::vector<T *> &items) {
+  for (auto *item : items) {
+    delete item;
+  }
+  items.clear();
+}
+
+// ================================================================
+// Benchmarks
+// ================================================================
+
+static void bench_random(BenchmarkRunner &runner,
+                         const BenchSuiteOptions &opts) {
+  // Tensor initialization: one 64-wide embedding per atom, filled with the
+  // counter-based generator at increasing thread counts
+  const size_t width = 64;
+  for (size_t n : atom_sizes(opts, 100000)) {
+    std::vector<float> values(n * width);
+    for (int threads : {1, 2, 4, 8}) {
+      auto params = size_params(opts, n);
+      params["threads"] = threads;
+      ThreadPoolConfig pool_config;
+      pool_config.threads = threads;
+      NanoBrainThreadPool pool(pool_config);
+      CounterRng rng(opts.seed, RandomSubsystem::TensorInit);
+      runner.run({"random", "fill_uniform", params,
+                  static_cast<double>(values.size())},
+                 [&] {
+                   rng.fill_uniform(values.data(), values.size(), -1.0f,
+                                    1.0f, &pool);
+                 });
+    }
+  }
+}
+
+static void bench_coherence(BenchmarkRunner &runner,
+                            const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 10000000)) {
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    std::vector<std::vector<int>> sets;
+    runner.run(
+        {"time_crystal", "ppm_coherence", size_params(opts, n),
+         static_cast<double>(n)},
+        [&] {
+          float acc = 0.0f;
+          for (const auto &s : sets) {
+            acc += kernel->compute_ppm_coherence(s);
+          }
+          volatile float sink = acc;
+          (void)sink;
+        },
+        [&] {
+          TimeCrystalConfig cfg;
+          cfg.memory_size = context_bytes(0, 0);
+          kernel = std::make_unique<TimeCrystalKernel>(cfg);
+          SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+          sets = generator.generate_prime_sets(n);
+        });
+  }
+}
+
+static void bench_time_crystal(BenchmarkRunner &runner,
+                               const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 10000000)) {
+    if (!runner.enabled("time_crystal", "state_update") &&
+        !runner.enabled("time_crystal", "process_cycle"))
+      break;
+
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    auto setup = [&] {
+      if (!kernel)
+        kernel = make_populated_kernel(opts, n, 0);
+    };
+
+    runner.run({"time_crystal", "state_update", size_params(opts, n),
+                static_cast<double>(n)},
+               [&] {
+                 kernel->update_time_crystal_states();
+                 kernel->update_gml_resonances();
+               },
+               setup);
+
+    uint64_t allocations = 0;
+    size_t cycles = 0;
+    auto *result = runner.run(
+        {"time_crystal", "process_cycle", size_params(opts, n),
+         static_cast<double>(n), 50},
+        [&] {
+          uint64_t before = allocation_count();
+          kernel->process_cycle();
+          allocations += allocation_count() - before;
+          cycles++;
+        },
+        setup);
+    if (result && cycles > 0) {
+      result->counters["allocations_per_cycle"] =
+          static_cast<double>(allocations) / cycles;
+    }
+  }
+}
+
+static void bench_encoding(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 100000)) {
+    std::unique_ptr<NanoBrainKernel> kernel;
+    std::unique_ptr<AtomSpaceTensorEncoder> encoder;
+    std::vector<Atom> atoms;
+    const size_t iterations = 5;
+
+    // The encoder caches by atom id, so each iteration starts cold
+    runner.run(
+        {"encoder", "encode_atom", size_params(opts, n),
+         static_cast<double>(n), iterations},
+        [&] {
+          encoder->clear_cache();
+          for (const auto &a : atoms) {
+            encoder->encode_atom(a);
+          }
+        },
+        [&] {
+          NanoBrainConfig cfg;
+          // Warmup + iterations each allocate a full set of node tensors
+          cfg.memory_size = context_bytes(n * (iterations + 1), 4096);
+          cfg.use_gpu = false;
+          kernel = std::make_unique<NanoBrainKernel>(cfg);
+          encoder = std::make_unique<AtomSpaceTensorEncoder>(kernel.get());
+          SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+          atoms = generator.generate_atoms(n);
+        });
+  }
+}
+
+static void bench_attention(BenchmarkRunner &runner,
+                            const BenchSuiteOptions &opts) {
+  // Diffusion scans every node per link, so it is capped well below the
+  // other suites until it is indexed.
+  for (size_t n : atom_sizes(opts, 10000)) {
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    std::unique_ptr<AtomSpaceTensorEncoder> encoder;
+    std::unique_ptr<AttentionAllocationEngine> engine;
+    std::vector<NodeTensor *> nodes;
+    std::vector<LinkTensor *> links;
+
+    runner.run(
+        {"attention", "diffusion", size_params(opts, n),
+         static_cast<double>(n), 20},
+        [&] { engine->apply_attention_diffusion(nodes, links); },
+        [&] {
+          kernel = make_populated_kernel(opts, n, 8192);
+          encoder = std::make_unique<AtomSpaceTensorEncoder>(
+              kernel->get_tensor_kernel());
+          build_tensors(*kernel, *encoder, nodes, links);
+          engine = std::make_unique<AttentionAllocationEngine>(
+              kernel->get_tensor_kernel(), AttentionAllocationConfig{});
+          engine->initialize(n);
+        });
+    delete_all(links);
+  }
+}
+
+static void bench_reasoning(BenchmarkRunner &runner,
+                            const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 100000)) {
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    std::unique_ptr<AtomSpaceTensorEncoder> encoder;
+    std::unique_ptr<RecursiveReasoningEngine> engine;
+    std::vector<NodeTensor *> nodes;
+    std::vector<LinkTensor *> links;
+    std::vector<std::string> ids;
+    size_t next_seed = 0;
+
+    runner.run(
+        {"reasoning", "step", size_params(opts, n), 1.0, 50},
+        [&] {
+          engine->clear_all_chains();
+          for (int c = 0; c < engine->get_config().parallel_chains; c++) {
+            engine->start_reasoning_chain(
+                {ids[next_seed % ids.size()],
+                 ids[(next_seed * 7919 + 1) % ids.size()]});
+            next_seed++;
+          }
+          engine->execute_reasoning_step(nodes, links);
+        },
+        [&] {
+          kernel = make_populated_kernel(opts, n, 8192);
+          encoder = std::make_unique<AtomSpaceTensorEncoder>(
+              kernel->get_tensor_kernel());
+          build_tensors(*kernel, *encoder, nodes, links);
+          ids = kernel->get_all_atom_ids();
+          engine = std::make_unique<RecursiveReasoningEngine>(
+              kernel->get_tensor_kernel(), ReasoningEngineConfig{});
+          engine->initialize();
+        });
+    delete_all(links);
+  }
+}
+
+static void bench_decision(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  // H3 decisions per second against batch size: 1024 situations per
+  // iteration, one decide() each (graphs built per call, in a scratch arena)
+  // or decide_batch() over the persistent batch graph
+  const int input_dim = 128;
+  const int actions = 16;
+  const size_t situations = 1024;
+
+  NanoBrainConfig cfg;
+  cfg.memory_size = context_bytes(0, 0);
+  cfg.scratch_size = 64u << 20;
+  cfg.use_gpu = false;
+  NanoBrainKernel kernel(cfg);
+  H3DecisionDevice device(&kernel, input_dim, actions);
+  device.initialize();
+
+  std::vector<float> inputs(situations * input_dim);
+  CounterRng(opts.seed, RandomSubsystem::TensorInit)
+      .fill_uniform(inputs.data(), inputs.size(), -1.0f, 1.0f);
+
+  std::map<std::string, double> params = {{"batch", 1.0}};
+  runner.run({"decision", "decide", params, static_cast<double>(situations)},
+             [&] {
+               for (size_t i = 0; i < situations; i++) {
+                 {
+                   ScratchScope scratch(&kernel);
+                   device.decide(kernel.create_tensor_from(
+                       inputs.data() + i * input_dim, input_dim));
+                 }
+                 kernel.reset_scratch();
+               }
+             });
+
+  for (size_t batch : {1, 16, 64, 256, 1024}) {
+    params["batch"] = static_cast<double>(batch);
+    runner.run({"decision", "decide_batch", params,
+                static_cast<double>(situations)},
+               [&] {
+                 for (size_t i = 0; i < situations; i += batch) {
+                   device.decide_batch(inputs.data() + i * input_dim, batch);
+                 }
+               });
+  }
+}
+
+static void bench_sensory_fusion(BenchmarkRunner &runner,
+                                 const BenchSuiteOptions &opts) {
+  // Batched multimodal fusion against stream length: five D = 128 modality
+  // streams of T timesteps stacked into one [T x 5 x D] tensor, then fused
+  // with one matmul (per-iteration tensors live in a scratch arena)
+  const int64_t dim = 128;
+  const std::vector<SensoryModality> order = {
+      SensoryModality::Visual, SensoryModality::Auditory,
+      SensoryModality::Tactile, SensoryModality::Olfactory,
+      SensoryModality::Gustatory};
+  const std::vector<int64_t> step_counts = {256, 1024, 4096};
+
+  int64_t stream_floats = 0;
+  for (int64_t steps : step_counts)
+    stream_floats += steps * dim * static_cast<int64_t>(order.size());
+
+  NanoBrainConfig cfg;
+  cfg.memory_size =
+      context_bytes(0, 0) + static_cast<size_t>(stream_floats) * sizeof(float);
+  cfg.scratch_size = 64u << 20;
+  cfg.use_gpu = false;
+  NanoBrainKernel kernel(cfg);
+  SensoryPrimeMapper mapper(&kernel);
+  mapper.initialize();
+
+  for (int64_t steps : step_counts) {
+    if (!runner.enabled("sensory", "stack_modalities") &&
+        !runner.enabled("sensory", "fuse_stream"))
+      break;
+
+    std::vector<NanoBrainTensor *> streams;
+    std::vector<float> values(static_cast<size_t>(steps * dim));
+    for (size_t m = 0; m < order.size(); m++) {
+      CounterRng(opts.seed, RandomSubsystem::TensorInit, m,
+                 static_cast<uint64_t>(steps))
+          .fill_uniform(values.data(), values.size(), -1.0f, 1.0f);
+      streams.push_back(kernel.create_tensor_from({dim, steps}, values.data(),
+                                                   values.size()));
+    }
+
+    std::map<std::string, double> params = {
+        {"timesteps", static_cast<double>(steps)},
+        {"modalities", static_cast<double>(order.size())},
+        {"dim", static_cast<double>(dim)}};
+    runner.run({"sensory", "stack_modalities", params,
+                static_cast<double>(steps)},
+               [&] {
+                 {
+                   ScratchScope scratch(&kernel);
+                   mapper.stack_modalities(streams);
+                 }
+                 kernel.reset_scratch();
+               });
+    runner.run({"sensory", "fuse_stream", params, static_cast<double>(steps)},
+               [&] {
+                 {
+                   ScratchScope scratch(&kernel);
+                   mapper.fuse_stream(mapper.stack_modalities(streams), order);
+                 }
+                 kernel.reset_scratch();
+               });
+  }
+}
+
+static void bench_neuron_mapping(BenchmarkRunner &runner,
+                                 const BenchSuiteOptions &opts) {
+  // Neurons of 1000 segments (soma, axon chain, dendrite tree) imported in
+  // bulk; n is the total segment count
+  const size_t per_neuron = 1000;
+  std::vector<NeuronSegmentSpec> morphology = {
+      {NeuronSegmentKind::Soma, 0, -1}};
+  for (size_t i = 1; i < per_neuron; i++) {
+    bool axon = i <= per_neuron / 3;
+    int32_t parent = axon ? static_cast<int32_t>(i - 1)
+                          : static_cast<int32_t>((i - per_neuron / 3) / 2);
+    morphology.push_back({axon ? NeuronSegmentKind::Axon
+                               : NeuronSegmentKind::Dendrite,
+                          static_cast<int>(i % AXON_SCALE_LEVELS), parent});
+  }
+
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    std::vector<std::string> names(std::max<size_t>(1, n / per_neuron));
+    for (size_t i = 0; i < names.size(); i++) {
+      names[i] = "cell_" + std::to_string(i);
+    }
+
+    auto params = size_params(opts, n);
+    TimeCrystalConfig cfg;
+    cfg.memory_size = context_bytes(0, 0);
+    TimeCrystalKernel tc_kernel(cfg);
+    std::unique_ptr<NeuronTimeCrystalMapper> mapper;
+    runner.run({"neuron", "import_morphology", params,
+                static_cast<double>(names.size() * per_neuron)},
+               [&] {
+                 mapper = std::make_unique<NeuronTimeCrystalMapper>(
+                     nullptr, &tc_kernel);
+                 mapper->import_neurons(names, morphology);
+               });
+
+    for (int threads : {1, 4}) {
+      params["threads"] = threads;
+      ThreadPoolConfig pool_config;
+      pool_config.threads = threads;
+      NanoBrainThreadPool pool(pool_config);
+      runner.run({"neuron", "update_crystal_states", params,
+                  static_cast<double>(names.size() * per_neuron)},
+                 [&] { mapper->update_crystal_states(); },
+                 [&] {
+                   mapper = std::make_unique<NeuronTimeCrystalMapper>(
+                       nullptr, &tc_kernel);
+                   mapper->import_neurons(names, morphology);
+                   mapper->set_thread_pool(&pool);
+                 });
+      mapper.reset(); // Drop the mapper before its pool
+    }
+  }
+}
+
+static void bench_filament(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  // Filament signals from n sources at ~1 kHz each: every iteration records
+  // one signal per source and predicts its next spike
+  for (size_t n : atom_sizes(opts, 100000)) {
+    std::unique_ptr<FilamentCommunicator> filament;
+    std::vector<std::string> sources;
+    int64_t now = 0;
+    runner.run(
+        {"filament", "record_predict", size_params(opts, n),
+         static_cast<double>(n)},
+        [&] {
+          float acc = 0.0f;
+          CounterRng rng(opts.seed, RandomSubsystem::Microtubule, 0, now);
+          FilamentSignal signal;
+          signal.is_pre_spike = true;
+          for (const auto &source : sources) {
+            signal.source_id = source;
+            signal.timestamp = now + static_cast<int64_t>(rng() % 3);
+            signal.signal_strength = 0.7f + 0.3f * rng.uniform();
+            signal.predicted_timing = filament->predict_spike_timing(source);
+            filament->record_signal(signal);
+            acc += filament->get_prediction_confidence(source);
+          }
+          now++;
+          volatile float sink = acc;
+          (void)sink;
+        },
+        [&] {
+          filament = std::make_unique<FilamentCommunicator>(nullptr, nullptr);
+          filament->initialize();
+          sources.clear();
+          for (size_t i = 0; i < n; i++) {
+            sources.push_back("neuron_" + std::to_string(i));
+          }
+          now = 0;
+        });
+  }
+}
+
+static void bench_circuits(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  // Diagnosis -> DecisionSupport -> Creative over a stream of n inputs:
+  // called back to back on one thread (reading kernel metrics per call, or
+  // a shared metrics cache), or streamed through a CircuitPipeline
+  auto kernel = make_populated_kernel(opts, 1000, 0);
+  CircuitMetricsCache cache(kernel.get());
+
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    std::vector<std::vector<float>> stream(n);
+    for (size_t i = 0; i < n; i++) {
+      stream[i].resize(CONSCIOUSNESS_DIMENSIONS);
+      CounterRng(opts.seed, RandomSubsystem::Consciousness, i)
+          .fill_uniform(stream[i].data(), stream[i].size(), 0.0f, 1.0f);
+    }
+
+    DiagnosisInterface diagnosis(kernel.get());
+    DecisionSupportInterface decision(kernel.get());
+    CreativeGenerationInterface creative(kernel.get());
+
+    auto params = size_params(opts, n);
+    for (int cached : {0, 1}) {
+      // Kernel metrics per call cost ~0.1 ms: keep uncached runs short
+      if (!cached && n > 10000)
+        continue;
+      params["metrics_cache"] = cached;
+      for (TimeCircuit *circuit :
+           std::initializer_list<TimeCircuit *>{&diagnosis, &decision,
+                                                &creative}) {
+        circuit->set_metrics_cache(cached ? &cache : nullptr);
+      }
+      runner.run({"circuits", "serial", params, static_cast<double>(n)},
+                 [&] {
+                   float acc = 0.0f;
+                   for (const auto &input : stream) {
+                     diagnosis.process_input(input);
+                     decision.process_input(diagnosis.generate_output());
+                     creative.process_input(decision.generate_output());
+                     acc += creative.generate_output()[0];
+                   }
+                   volatile float sink = acc;
+                   (void)sink;
+                 });
+    }
+
+    runner.run({"circuits", "pipeline", params, static_cast<double>(n)},
+               [&] {
+                 CircuitPipeline pipeline;
+                 int stage = pipeline.add_stage(&diagnosis);
+                 stage = pipeline.add_stage(&decision, {stage});
+                 pipeline.add_stage(&creative, {stage});
+                 pipeline.set_metrics_cache(&cache);
+                 pipeline.start();
+                 for (const auto &input : stream) {
+                   pipeline.submit(input);
+                 }
+                 pipeline.wait();
+               });
+  }
+}
+
+static void bench_wheels(BenchmarkRunner &runner,
+                         const BenchSuiteOptions &opts) {
+  // A vocabulary of n concepts mapped into wheel space, indexed, and
+  // queried with 1000 perturbed vocabulary wheels per iteration
+  const size_t queries = 1000;
+  NanoBrainThreadPool setup_pool;
+  ConsciousnessConfig setup_config;
+  setup_config.thread_pool = &setup_pool;
+  PhilosophicalTransformationEngine engine(setup_config);
+
+  for (size_t n : atom_sizes(opts, 10000000)) {
+    bool enabled = false;
+    for (const char *name :
+         {"create_wheels", "build_index", "knn", "radius", "insert"}) {
+      enabled = enabled || runner.enabled("wheels", name);
+    }
+    if (!enabled)
+      break;
+
+    std::vector<std::string> concepts(n);
+    for (size_t i = 0; i < n; i++) {
+      concepts[i] = "concept_" + std::to_string(i);
+    }
+
+    LinguisticWheelSet wheels;
+    WheelIndex index;
+    std::vector<WheelIndex::Vector> targets(queries);
+    auto setup_wheels = [&] {
+      if (wheels.size() != n)
+        wheels = engine.create_wheels(concepts);
+    };
+    auto setup_index = [&] {
+      setup_wheels();
+      if (index.size() != n)
+        index.build(concepts, wheels);
+      CounterRng rng(opts.seed, RandomSubsystem::Consciousness);
+      for (auto &target : targets) {
+        target = wheels.vector(rng() % n);
+        for (float &v : target)
+          v += rng.uniform(-0.05f, 0.05f);
+      }
+    };
+
+    auto params = size_params(opts, n);
+    for (int threads : {1, 4}) {
+      params["threads"] = threads;
+      ThreadPoolConfig pool_config;
+      pool_config.threads = threads;
+      NanoBrainThreadPool pool(pool_config);
+      ConsciousnessConfig config;
+      config.thread_pool = &pool;
+      PhilosophicalTransformationEngine pooled(config);
+      runner.run({"wheels", "create_wheels", params, static_cast<double>(n)},
+                 [&] { wheels = pooled.create_wheels(concepts); });
+    }
+    params.erase("threads");
+
+    runner.run({"wheels", "build_index", params, static_cast<double>(n), 5},
+               [&] { index.build(concepts, wheels); }, setup_wheels);
+
+    params["k"] = 10;
+    runner.run({"wheels", "knn", params, static_cast<double>(queries)},
+               [&] {
+                 size_t found = 0;
+                 for (const auto &target : targets) {
+                   found += index.knn(target, 10).size();
+                 }
+                 volatile size_t sink = found;
+                 (void)sink;
+               },
+               setup_index);
+    params.erase("k");
+
+    params["radius"] = 0.25;
+    runner.run({"wheels", "radius", params, static_cast<double>(queries)},
+               [&] {
+                 size_t found = 0;
+                 for (const auto &target : targets) {
+                   found += index.radius(target, 0.25f).size();
+                 }
+                 volatile size_t sink = found;
+                 (void)sink;
+               },
+               setup_index);
+    params.erase("radius");
+
+    // Incremental inserts of 1% more concepts per iteration, rebuilds
+    // included; runs last since it grows the index
+    size_t extra = std::max<size_t>(1, n / 100);
+    runner.run({"wheels", "insert", params, static_cast<double>(extra), 5},
+               [&] {
+                 for (size_t i = 0; i < extra; i++) {
+                   index.insert("extra", wheels.vector(i));
+                 }
+               },
+               setup_index);
+  }
+}
+
+static void bench_capsules(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  // 10^4 frozen capsules with 1% kept resident, so nearly every thaw
+  // faults a spilled state back in from the segment file
+  const size_t capsules = 10000;
+  const size_t thaws = 1000;
+  if (!runner.enabled("capsules", "freeze") &&
+      !runner.enabled("capsules", "thaw"))
+    return;
+
+  CorticalPenConfig config;
+  config.time_crystal_resolution = 1024;
+  config.resident_capsules = static_cast<int>(capsules / 100);
+
+  NanoBrainConfig kernel_config;
+  kernel_config.memory_size = 64u << 20;
+  kernel_config.use_gpu = false;
+  NanoBrainKernel kernel(kernel_config);
+  NanoBrainTensor *dynamics = kernel.create_tensor({2048});
+  NanoBrainTensor *thawed = kernel.create_tensor(
+      {config.time_crystal_resolution}, TensorInitPolicy::uninitialized());
+
+  std::map<std::string, double> params = {
+      {"capsules", static_cast<double>(capsules)},
+      {"resident_capsules", static_cast<double>(config.resident_capsules)},
+      {"resolution", static_cast<double>(config.time_crystal_resolution)}};
+
+  {
+    CorticalPenFreezer freezer(&kernel, nullptr, config);
+    std::vector<std::string> ids(capsules);
+    runner.run({"capsules", "freeze", params, static_cast<double>(capsules),
+                5},
+               [&] {
+                 for (auto &id : ids)
+                   id = freezer.freeze_dynamics(dynamics, {});
+                 for (const auto &id : ids)
+                   freezer.delete_capsule(id);
+               });
+  }
+
+  CorticalPenFreezer freezer(&kernel, nullptr, config);
+  std::vector<std::string> targets;
+  auto setup = [&] {
+    if (freezer.capsule_count() > 0)
+      return;
+    std::vector<std::string> ids(capsules);
+    for (auto &id : ids)
+      id = freezer.freeze_dynamics(dynamics, {});
+    CounterRng rng(opts.seed, RandomSubsystem::Consciousness);
+    targets.resize(thaws);
+    for (auto &target : targets)
+      target = ids[rng() % capsules];
+  };
+
+  BenchmarkResult *result = runner.run(
+      {"capsules", "thaw", params, static_cast<double>(thaws)},
+      [&] {
+        for (const auto &id : targets)
+          freezer.thaw_capsule(id, thawed);
+      },
+      setup);
+  if (result) {
+    CapsuleStoreStats stats = freezer.get_store_stats();
+    result->counters["memory_ceiling_bytes"] =
+        static_cast<double>(stats.memory_ceiling_bytes);
+    result->counters["resident_bytes"] =
+        static_cast<double>(stats.resident_bytes);
+    result->counters["spill_file_bytes"] =
+        static_cast<double>(stats.spill_file_bytes);
+    result->counters["thaw_p50_us"] = stats.thaw_p50_us;
+    result->counters["thaw_p99_us"] = stats.thaw_p99_us;
+    result->counters["thaw_max_us"] = stats.thaw_max_us;
+    if (stats.thaws > 0) {
+      result->counters["faults_per_thaw"] =
+          static_cast<double>(stats.faults) / stats.thaws;
+    }
+  }
+}
+
+static void bench_cellular(BenchmarkRunner &runner,
+                           const BenchSuiteOptions &opts) {
+  // Rule 110 on a 1024-wide grid of n cells: per-generation full updates,
+  // dirty-tile updates, and memoized runs of 1024 generations, from dense
+  // and nearly dead random grids; then a 2-D Life rule as a std::function
+  // and as a compile-time stencil
+  const int width = 1024;
+  const int memo_generations = 1024;
+
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    int height = static_cast<int>(std::max<size_t>(1, n / width));
+    CellularAutomatonEngine engine(nullptr);
+    for (double density : {0.5, 0.001}) {
+      auto params = size_params(opts, n);
+      params["density"] = density;
+      auto setup = [&] {
+        engine.initialize(width, height);
+        engine.set_rule(110);
+        engine.randomize(static_cast<float>(density), opts.seed);
+      };
+
+      runner.run({"cellular", "update_parallel", params,
+                  static_cast<double>(width) * height},
+                 [&] { engine.update_parallel(); }, setup);
+      runner.run({"cellular", "update_sparse", params,
+                  static_cast<double>(width) * height},
+                 [&] { engine.update_sparse(); }, setup);
+      params["generations"] = memo_generations;
+      runner.run({"cellular", "run_memoized", params,
+                  static_cast<double>(width) * height * memo_generations,
+                  20},
+                 [&] { engine.run_memoized(memo_generations); }, setup);
+    }
+
+    // Game of Life through the std::function rule and the compile-time
+    // stencil, 16 generations per iteration
+    const int life_generations = 16;
+    auto params = size_params(opts, n);
+    params["generations"] = life_generations;
+    auto life_setup = [&] {
+      engine.initialize(width, height);
+      engine.randomize(0.3f, opts.seed);
+    };
+    CellularAutomatonEngine custom(nullptr);
+    runner.run({"cellular", "custom_rule", params,
+                static_cast<double>(width) * height * life_generations},
+               [&] { custom.run(life_generations); },
+               [&] {
+                 custom.initialize(width, height);
+                 custom.randomize(0.3f, opts.seed);
+                 custom.set_custom_rule([](int x, int y,
+                                           const CellularAutomatonState &s) {
+                   int count = 0;
+                   for (int dy = -1; dy <= 1; dy++) {
+                     for (int dx = -1; dx <= 1; dx++) {
+                       if (dx != 0 || dy != 0)
+                         count += s.grid[(y + dy + s.height) % s.height]
+                                        [(x + dx + s.width) % s.width];
+                     }
+                   }
+                   return (count == 3 || (s.grid[y][x] && count == 2)) ? 1
+                                                                       : 0;
+                 });
+               });
+    runner.run({"cellular", "run_with_rule", params,
+                static_cast<double>(width) * height * life_generations},
+               [&] { engine.run_with_rule<ConwayLifeRule>(life_generations); },
+               life_setup);
+  }
+}
+
+static void bench_thread_pool(BenchmarkRunner &runner,
+                              const BenchSuiteOptions &opts) {
+  // One pass over n floats split into `threads` chunks: threads spawned
+  // per call (what the engines did before the shared pool) against the
+  // pool; then time crystal stepping on the pool
+  for (size_t n : atom_sizes(opts, 10000000)) {
+    std::vector<float> values(n, 1.0f);
+    auto scale = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        values[i] = values[i] * 0.5f + 1.0f;
+      }
+    };
+
+    for (int threads : {1, 2, 4}) {
+      auto params = size_params(opts, n);
+      params["threads"] = threads;
+      size_t grain = (n + threads - 1) / threads;
+
+      runner.run({"thread_pool", "spawn_for", params, static_cast<double>(n)},
+                 [&] {
+                   std::vector<std::thread> workers;
+                   for (size_t begin = grain; begin < n; begin += grain) {
+                     workers.emplace_back(scale, begin,
+                                          std::min(n, begin + grain));
+                   }
+                   scale(0, std::min(n, grain));
+                   for (auto &worker : workers) {
+                     worker.join();
+                   }
+                 });
+
+      ThreadPoolConfig pool_config;
+      pool_config.threads = threads;
+      NanoBrainThreadPool pool(pool_config);
+      runner.run({"thread_pool", "pool_for", params, static_cast<double>(n)},
+                 [&] { pool.parallel_for(0, n, grain, scale); });
+
+      runner.run(
+          {"thread_pool", "pool_reduce", params, static_cast<double>(n)},
+          [&] {
+            double sum = pool.parallel_reduce(
+                0, n, pool.grain_for(n, 4096), 0.0,
+                [&](size_t begin, size_t end) {
+                  double partial = 0.0;
+                  for (size_t i = begin; i < end; i++) {
+                    partial += values[i];
+                  }
+                  return partial;
+                },
+                [](double a, double b) { return a + b; });
+            volatile double sink = sum;
+            (void)sink;
+          });
+
+      std::unique_ptr<TimeCrystalKernel> kernel;
+      runner.run({"thread_pool", "state_update", params,
+                  static_cast<double>(n)},
+                 [&] { kernel->update_time_crystal_states(); },
+                 [&] {
+                   if (kernel)
+                     return;
+                   kernel = make_populated_kernel(opts, n, 0);
+                   kernel->set_thread_pool(&pool);
+                 });
+    }
+  }
+}
+
+static void bench_memory(BenchmarkRunner &runner,
+                         const BenchSuiteOptions &opts) {
+  // ggml context provisioning: ggml's own malloc against pre-faulted
+  // regular, transparent-huge and hugetlb pages. first_cycle builds and
+  // populates a kernel and reports its first process_cycle; random_access
+  // reads random words across a context-sized region, with dTLB misses
+  // where perf events are available.
+  struct Variant {
+    HugePagePolicy huge_pages;
+    bool prefault;
+  };
+  const Variant variants[] = {{HugePagePolicy::None, false},
+                              {HugePagePolicy::None, true},
+                              {HugePagePolicy::Transparent, true},
+                              {HugePagePolicy::Huge2MB, true}};
+  const size_t accesses = 1u << 20;
+
+  for (size_t n : atom_sizes(opts, 100000)) {
+    for (const Variant &variant : variants) {
+      MemoryProvisioning provisioning;
+      provisioning.huge_pages = variant.huge_pages;
+      provisioning.prefault = variant.prefault;
+      auto params = size_params(opts, n);
+      params["huge_pages"] = static_cast<double>(variant.huge_pages);
+      params["prefault"] = variant.prefault ? 1.0 : 0.0;
+
+      double first_cycle_ms = 0.0;
+      double provision_ms = 0.0;
+      size_t builds = 0;
+      auto *result = runner.run(
+          {"memory", "first_cycle", params, 1.0, 5},
+          [&] {
+            TimeCrystalConfig tc_config;
+            tc_config.memory_size = context_bytes(n, 1024);
+            tc_config.memory_provisioning = provisioning;
+            TimeCrystalKernel kernel(tc_config);
+            kernel.initialize();
+            SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+            generator.populate(kernel);
+
+            auto start = std::chrono::steady_clock::now();
+            kernel.process_cycle();
+            first_cycle_ms += std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+            provision_ms += kernel.get_tensor_kernel()
+                                ->get_memory_stats()
+                                .context_memory.provision_ms;
+            builds++;
+          });
+      if (result && builds > 0) {
+        result->counters["first_cycle_ms"] = first_cycle_ms / builds;
+        result->counters["provision_ms"] = provision_ms / builds;
+      }
+
+      MemoryRegion region;
+      TlbMissCounter tlb;
+      uint64_t misses = 0;
+      size_t passes = 0;
+      uint64_t state = opts.seed | 1;
+      auto *access = runner.run(
+          {"memory", "random_access", params, static_cast<double>(accesses)},
+          [&] {
+            const auto *words = static_cast<const uint64_t *>(region.data());
+            size_t count = region.size() / sizeof(uint64_t);
+            uint64_t sum = 0;
+            tlb.start();
+            for (size_t i = 0; i < accesses; i++) {
+              state ^= state << 13;
+              state ^= state >> 7;
+              state ^= state << 17;
+              sum += words[state % count];
+            }
+            misses += tlb.stop();
+            passes++;
+            volatile uint64_t sink = sum;
+            (void)sink;
+          },
+          [&] {
+            // Written through, as tensors would be: untouched pages all
+            // read the shared zero page
+            if (region.allocate(context_bytes(n, 1024), provisioning))
+              std::memset(region.data(), 1, region.size());
+          });
+      if (access) {
+        access->counters["page_size"] =
+            static_cast<double>(region.get_info().page_size);
+        if (tlb.available() && passes > 0) {
+          access->counters["dtlb_misses_per_access"] =
+              static_cast<double>(misses) / (passes * accesses);
+        }
+      }
+    }
+  }
+}
+
+static void bench_startup(BenchmarkRunner &runner,
+                          const BenchSuiteOptions &opts) {
+  // Cold start of the default unified kernel (construct + initialize,
+  // target under 10 ms) and of the pieces that used to build tables at
+  // startup
+  (void)opts;
+  double cold_start_ms = 0.0;
+  size_t starts = 0;
+  auto *result = runner.run(
+      {"startup", "unified_cold_start", {}, 1.0, 20}, [&] {
+        auto start = std::chrono::steady_clock::now();
+        UnifiedNanoBrainKernel kernel{UnifiedNanoBrainConfig()};
+        kernel.initialize();
+        cold_start_ms += std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+        starts++;
+      });
+  if (result && starts > 0) {
+    result->counters["cold_start_ms"] = cold_start_ms / starts;
+  }
+
+  runner.run({"startup", "time_crystal_initialize", {}, 1.0, 20}, [] {
+    TimeCrystalKernel kernel{TimeCrystalConfig()};
+    kernel.initialize();
+  });
+
+  runner.run({"startup", "ppm_table", {}, 1.0}, [] {
+    PPMCoherenceTable table;
+    table.initialize();
+    volatile float sink = table.lookup({2, 3, 5, 7, 11});
+    (void)sink;
+  });
+}
+
+static void bench_persistence(BenchmarkRunner &runner,
+                              const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    if (!runner.enabled("persistence", "save_buffer") &&
+        !runner.enabled("persistence", "load_buffer"))
+      break;
+
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    AtomSpacePersistence persistence;
+    std::vector<uint8_t> buffer;
+    auto setup = [&] {
+      if (!kernel) {
+        kernel = make_populated_kernel(opts, n, 0);
+        persistence.save_to_buffer(kernel.get(), buffer);
+      }
+    };
+
+    BenchmarkResult *saved = runner.run(
+        {"persistence", "save_buffer", size_params(opts, n),
+         static_cast<double>(n), 20},
+        [&] { persistence.save_to_buffer(kernel.get(), buffer); }, setup);
+    if (saved) {
+      saved->counters["bytes"] = static_cast<double>(buffer.size());
+    }
+
+    runner.run({"persistence", "load_buffer", size_params(opts, n),
+                static_cast<double>(n), 20},
+               [&] {
+                 TimeCrystalConfig cfg;
+                 cfg.memory_size = context_bytes(0, 0);
+                 TimeCrystalKernel target(cfg);
+                 persistence.load_from_buffer(&target, buffer);
+               },
+               setup);
+  }
+}
+
+static void bench_atomese(BenchmarkRunner &runner,
+                          const BenchSuiteOptions &opts) {
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    AtomeseParser parser;
+    std::string source;
+
+    BenchmarkResult *result = runner.run(
+        {"atomese", "parse_all", size_params(opts, n),
+         static_cast<double>(n)},
+        [&] {
+          auto parsed = parser.parse_all(source);
+          volatile size_t sink = parsed.size();
+          (void)sink;
+        },
+        [&] {
+          SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+          source = generator.generate_atomese(n);
+        });
+    if (result) {
+      result->counters["bytes"] = static_cast<double>(source.size());
+    }
+  }
+}
+
+static void bench_query(BenchmarkRunner &runner,
+                        const BenchSuiteOptions &opts) {
+  // Anchored queries should cost the same at every size; the typed scan
+  // walks the whole Inheritance bucket
+  const size_t queries = 1000;
+  for (size_t n : atom_sizes(opts, 1000000)) {
+    if (!runner.enabled("query", "anchored") &&
+        !runner.enabled("query", "two_hop") &&
+        !runner.enabled("query", "typed_scan"))
+      break;
+
+    std::unique_ptr<TimeCrystalKernel> kernel;
+    std::vector<QueryPattern> anchored;
+    std::vector<QueryPattern> two_hop;
+    QueryPattern typed_scan;
+    auto setup = [&] {
+      if (kernel)
+        return;
+      kernel = make_populated_kernel(opts, n, 0);
+
+      // Anchor on link premises so every query has at least one result
+      std::vector<std::string> links = kernel->get_all_inference_ids();
+      for (size_t q = 0; q < queries && !links.empty(); q++) {
+        const auto *link =
+            kernel->get_inference(links[q * links.size() / queries]);
+        QueryClause first;
+        first.any_rule = true;
+        first.premises = {QueryTerm::atom(link->premise_ids[0]),
+                          QueryTerm::variable("y")};
+        QueryClause second;
+        second.any_rule = true;
+        second.premises = {QueryTerm::variable("y"), QueryTerm::variable("z")};
+        anchored.push_back({{}, {first}});
+        two_hop.push_back({{}, {second, first}});
+      }
+
+      QueryClause inheritance;
+      inheritance.premises = {QueryTerm::variable("x"), QueryTerm::any()};
+      typed_scan = {{{"x", Symbol("ConceptNode")}}, {inheritance}};
+    };
+
+    auto run_batch = [&](const char *name,
+                         const std::vector<QueryPattern> &patterns) {
+      size_t results = 0;
+      size_t candidates = 0;
+      BenchmarkResult *result = runner.run(
+          {"query", name, size_params(opts, n),
+           static_cast<double>(queries)},
+          [&] {
+            AtomSpaceQueryEngine engine(kernel.get());
+            results = candidates = 0;
+            for (const auto &pattern : patterns) {
+              QueryResult found = engine.execute(pattern);
+              results += found.stats.results;
+              candidates += found.stats.candidates;
+            }
+          },
+          setup);
+      if (result) {
+        result->counters["results_per_query"] =
+            static_cast<double>(results) / static_cast<double>(queries);
+        result->counters["candidates_per_result"] =
+            results ? static_cast<double>(candidates) /
+                          static_cast<double>(results)
+                    : 0.0;
+      }
+    };
+    run_batch("anchored", anchored);
+    run_batch("two_hop", two_hop);
+
+    size_t scanned = 0;
+    BenchmarkResult *scan = runner.run(
+        {"query", "typed_scan", size_params(opts, n), static_cast<double>(n),
+         20},
+        [&] {
+          AtomSpaceQueryEngine engine(kernel.get());
+          scanned = engine.execute(typed_scan).stats.results;
+        },
+        setup);
+    if (scan) {
+      scan->counters["results"] = static_cast<double>(scanned);
+    }
+  }
+}
+
+static void bench_fractal_condensation(BenchmarkRunner &runner,
+                                      const BenchSuiteOptions &opts) {
+  // Atom count doubles as the condensation sample count; field queries are
+  // evaluated against whatever survives the prime threshold
+  const size_t queries = 1024;
+  NanoBrainThreadPool pool;
+  for (size_t n : atom_sizes(opts, 100000)) {
+    FractalCondensationConfig cfg;
+    cfg.max_condensation_points = static_cast<int>(n);
+    cfg.seed = opts.seed;
+    cfg.thread_pool = &pool;
+    FractalCondensation condensation(nullptr, cfg);
+
+    BenchmarkResult *result = runner.run(
+        {"brain_jelly", "condense_everywhere", size_params(opts, n),
+         static_cast<double>(n)},
+        [&] { condensation.condense_everywhere(); });
+    if (result) {
+      result->counters["points"] =
+          static_cast<double>(condensation.get_points().size());
+    }
+
+    std::vector<std::array<float, 11>> positions(queries);
+    std::vector<float> values(queries);
+    runner.run(
+        {"brain_jelly", "field_values", size_params(opts, n),
+         static_cast<double>(queries)},
+        [&] {
+          condensation.get_field_values(positions.data(), positions.size(),
+                                        values.data());
+        },
+        [&] {
+          if (condensation.get_points().empty())
+            condensation.condense_everywhere();
+          for (size_t i = 0; i < queries; i++) {
+            for (int d = 0; d < 11; d++) {
+              positions[i][d] = std::sin(0.37f * i + 1.3f * d);
+            }
+          }
+        });
+  }
+}
+
+static void bench_unified(BenchmarkRunner &runner,
+                          const BenchSuiteOptions &opts) {
+  // process_cycle re-encodes every atom each cycle, so iterations are capped
+  // to keep the ggml context bounded.
+  const size_t cycles = 5;
+  for (size_t n : atom_sizes(opts, 10000)) {
+    std::unique_ptr<UnifiedNanoBrainKernel> kernel;
+    CycleStageTimings stage_sum;
+    size_t stage_samples = 0;
+
+    BenchmarkResult *result = runner.run(
+        {"unified", "process_cycle", size_params(opts, n),
+         static_cast<double>(n), cycles},
+        [&] {
+          const auto &t = kernel->process_cycle().stage_timings;
+          stage_sum.sync_tensors_ms += t.sync_tensors_ms;
+          stage_sum.time_crystal_ms += t.time_crystal_ms;
+          stage_sum.attention_ms += t.attention_ms;
+          stage_sum.reasoning_ms += t.reasoning_ms;
+          stage_sum.metacognition_ms += t.metacognition_ms;
+          stage_samples++;
+        },
+        [&] {
+          UnifiedNanoBrainConfig cfg;
+          cfg.memory_size = context_bytes(n * (cycles + 2), 8192);
+          kernel = std::make_unique<UnifiedNanoBrainKernel>(cfg);
+          kernel->initialize();
+          SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+          generator.populate(*kernel->get_time_crystal_kernel());
+        });
+
+    // Mean per-stage breakdown (includes the warmup cycle)
+    if (result && stage_samples > 0) {
+      double k = 1.0 / stage_samples;
+      result->counters["sync_tensors_ms"] = stage_sum.sync_tensors_ms * k;
+      result->counters["time_crystal_ms"] = stage_sum.time_crystal_ms * k;
+      result->counters["attention_ms"] = stage_sum.attention_ms * k;
+      result->counters["reasoning_ms"] = stage_sum.reasoning_ms * k;
+      result->counters["metacognition_ms"] = stage_sum.metacognition_ms * k;
+
+      MemoryStats memory = kernel->get_metrics().memory;
+      result->counters["memory_used_bytes"] =
+          static_cast<double>(memory.used_bytes);
+      result->counters["allocation_rate"] = memory.allocation_rate;
+    }
+  }
+}
+
+static void bench_sharded(BenchmarkRunner &runner,
+                          const BenchSuiteOptions &opts) {
+  // Every cycle adds conclusion atoms, so iterations are capped
+  for (size_t n : atom_sizes(opts, 100000)) {
+    for (int shard_count : {1, 2, 4, 8, 16, 32}) {
+      if (!runner.enabled("sharded", "process_cycle"))
+        return;
+
+      // One worker per shard, as a dedicated shard thread would have
+      ThreadPoolConfig pool_config;
+      pool_config.threads = shard_count;
+      NanoBrainThreadPool pool(pool_config);
+      std::unique_ptr<ShardedNanoBrainKernel> kernel;
+      auto params = size_params(opts, n);
+      params["shards"] = shard_count;
+
+      BenchmarkResult *result = runner.run(
+          {"sharded", "process_cycle", params, static_cast<double>(n), 20},
+          [&] { kernel->process_cycle(); },
+          [&] {
+            ShardedNanoBrainConfig cfg;
+            cfg.shard_count = shard_count;
+            cfg.shard_config.memory_size = 16u << 20;
+            cfg.thread_pool = &pool;
+            kernel = std::make_unique<ShardedNanoBrainKernel>(cfg);
+            kernel->initialize();
+            SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+            generator.populate(*kernel);
+          });
+
+      if (result) {
+        ShardedNanoBrainMetrics m = kernel->get_metrics();
+        result->counters["messages"] =
+            static_cast<double>(m.messages_delivered);
+        result->counters["ghost_atoms"] = static_cast<double>(m.ghost_atoms);
+        result->counters["cross_shard_links"] =
+            static_cast<double>(m.cross_shard_links);
+        result->counters["exchange_ms"] = m.exchange_ms;
+        result->counters["max_shard_ms"] = m.max_shard_ms;
+        result->counters["load_imbalance"] = m.load_imbalance;
+      }
+    }
+  }
+}
+
+/**
+ * Coordinator plus one worker thread per shard, linked by socketpairs
+ */
+struct DistributedBenchCluster {
+  std::unique_ptr<DistributedCoordinator> coordinator;
+  std::vector<std::thread> workers;
+
+  DistributedBenchCluster(const ShardedNanoBrainConfig &cfg, int count)
+      : coordinator(std::make_unique<DistributedCoordinator>(cfg)) {
+    for (int i = 0; i < count; i++) {
+      std::unique_ptr<SocketTransport> local, remote;
+      if (!SocketTransport::create_pair(local, remote))
+        break;
+      coordinator->add_worker(std::move(local));
+      workers.emplace_back([cfg, link = std::move(remote)]() mutable {
+        DistributedWorker(cfg, std::move(link)).serve();
+      });
+    }
+  }
+
+  ~DistributedBenchCluster() {
+    coordinator->shutdown();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+};
+
+static void bench_distributed(BenchmarkRunner &runner,
+                              const BenchSuiteOptions &opts) {
+  // Setup pays a round trip per atom and link, so sizes are capped
+  for (size_t n : atom_sizes(opts, 10000)) {
+    for (int worker_count : {1, 2, 4, 8}) {
+      if (!runner.enabled("distributed", "process_cycle"))
+        return;
+
+      std::unique_ptr<DistributedBenchCluster> cluster;
+      auto params = size_params(opts, n);
+      params["workers"] = worker_count;
+
+      BenchmarkResult *result = runner.run(
+          {"distributed", "process_cycle", params, static_cast<double>(n),
+           20},
+          [&] { cluster->coordinator->process_cycle(); },
+          [&] {
+            ShardedNanoBrainConfig cfg;
+            cfg.shard_config.memory_size = 16u << 20;
+            cluster.reset();
+            cluster = std::make_unique<DistributedBenchCluster>(cfg,
+                                                                worker_count);
+            cluster->coordinator->initialize();
+            SyntheticAtomSpaceGenerator generator(synthetic_config(opts, n));
+            generator.populate(*cluster->coordinator);
+          });
+
+      if (result) {
+        DistributedNanoBrainMetrics m = cluster->coordinator->get_metrics();
+        result->counters["messages"] =
+            static_cast<double>(m.sharded.messages_delivered);
+        result->counters["bytes_sent"] = static_cast<double>(m.bytes_sent);
+        result->counters["bytes_received"] =
+            static_cast<double>(m.bytes_received);
+        result->counters["exchange_ms"] = m.sharded.exchange_ms;
+        result->counters["max_shard_ms"] = m.sharded.max_shard_ms;
+      }
+    }
+  }
+}
+
+// ================================================================
+// Main
+// ================================================================
+
+int main(int argc, char **argv) {
+  BenchSuiteOptions opts;
+  if (!parse_args(argc, argv, opts)) {
+    print_usage();
+    return 1;
+  }
+
+  BenchmarkRunner runner(opts.runner);
+
+  if (!opts.trace_path.empty()) {
+#ifndef NANOBRAIN_TRACING
+    std::cerr << "Warning: built without NANOBRAIN_TRACING, trace will be "
+                 "empty"
+              << std::endl;
+#endif
+    TraceRecorder::instance().set_thread_name("bench");
+    TraceRecorder::instance().set_enabled(true);
+  }
+
+  {
+    // Subsystems log to std::cout; keep it clean for the JSON document
+    ScopedStdoutSilencer silence(opts.runner.quiet);
+
+    bench_random(runner, opts);
+    bench_coherence(runner, opts);
+    bench_time_crystal(runner, opts);
+    bench_encoding(runner, opts);
+    bench_attention(runner, opts);
+    bench_reasoning(runner, opts);
+    bench_decision(runner, opts);
+    bench_sensory_fusion(runner, opts);
+    bench_neuron_mapping(runner, opts);
+    bench_filament(runner, opts);
+    bench_circuits(runner, opts);
+    bench_wheels(runner, opts);
+    bench_capsules(runner, opts);
+    bench_cellular(runner, opts);
+    bench_thread_pool(runner, opts);
+    bench_memory(runner, opts);
+    bench_startup(runner, opts);
+    bench_persistence(runner, opts);
+    bench_atomese(runner, opts);
+    bench_query(runner, opts);
+    bench_fractal_condensation(runner, opts);
+    bench_unified(runner, opts);
+    bench_sharded(runner, opts);
+    bench_distributed(runner, opts);
+  }
+
+  if (!opts.trace_path.empty()) {
+    TraceRecorder::instance().set_enabled(false);
+    if (!TraceRecorder::instance().write_chrome_trace(opts.trace_path)) {
+      std::cerr << "Failed to write " << opts.trace_path << std::endl;
+      return 1;
+    }
+  }
+
+  std::map<std::string, std::string> metadata = {
+      {"nanobrain_version", NANOBRAIN_CPP_VERSION},
+      {"build_date", NANOBRAIN_CPP_BUILD_DATE},
+      {"hardware_threads",
+       std::to_string(std::thread::hardware_concurrency())},
+      {"seed", std::to_string(opts.seed)},
+      {"prime_distribution", prime_distribution_to_string(opts.primes)},
+#ifdef NANOBRAIN_TRACING
+      {"tracing", "compiled"},
+#else
+      {"tracing", "off"},
+#endif
+      {"timestamp_ms",
+       std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count())},
+#if defined(__clang__)
+      {"compiler", "clang " __clang_version__},
+#elif defined(__GNUC__)
+      {"compiler", "gcc " __VERSION__},
+#elif defined(_MSC_VER)
+      {"compiler", "msvc " + std::to_string(_MSC_VER)},
+#endif
+  };
+
+  runner.write_summary(std::cerr);
+
+  if (opts.out_path.empty()) {
+    runner.write_json(std::cout, metadata);
+  } else {
+    std::ofstream out(opts.out_path);
+    if (!out.is_open()) {
+      std::cerr << "Failed to open " << opts.out_path << std::endl;
+      return 1;
+    }
+    runner.write_json(out, metadata);
+  }
+  return 0;
+}
@@ -251,8 +251,11 @@ void demo_cortical_pen_freezer(NanoBrainKernel *kernel,
 
   // Thaw a capsule
   std::cout << "\nThawing capsule '" << cap1 << "'...\n";
-  auto *thawed = freezer.thaw_capsule(cap1);
-  std::cout << "Thaw result: " << (thawed ? "Success" : "Failed") << "\n";
+  auto *thawed = kernel->create_tensor(
+      {static_cast<int64_t>(freezer.state_size())},
+      TensorInitPolicy::uninitialized());
+  bool ok = freezer.thaw_capsule(cap1, thawed);
+  std::cout << "Thaw result: " << (ok ? "Success" : "Failed") << "\n";
 }
 
 void demo_humanoid_avatar(NanoBrainKernel *kernel,
@@ -5,12 +5,16 @@
 #include "nanobrain_hinductor.h"
 #include "nanobrain_kernel.h"
 #include "nanobrain_metacognitive.h"
+#include "nanobrain_query.h"
 #include "nanobrain_reasoning.h"
+#include "nanobrain_singularity.h"
 #include "nanobrain_time_crystal.h"
 #include "nanobrain_unified.h"
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <string>
 #include <vector>
 
 int main() {
@@ -624,6 +628,158 @@ int main() {
 
   std::cout << "\n  Fractal Mechanics tests complete!" << std::endl;
 
+  // Checks below count failures; any failure makes the test exit non-zero
+  int failures = 0;
+
+  // ================================================================
+  // Part 12: Cellular Automaton Equivalence
+  // ================================================================
+  std::cout << "\n--- Part 12: Cellular Automaton Equivalence ---"
+            << std::endl;
+
+  // run_sparse() and run_memoized() must match run() cell for cell; rules
+  // 1, 57 and 255 turn an empty neighbourhood on
+  const int ca_rules[] = {30, 90, 110, 150, 18, 1, 57, 255};
+  const int ca_widths[] = {1, 7, 64, 65, 200};
+  const int ca_generations[] = {1, 13, 64, 100};
+  int ca_cases = 0;
+  int ca_mismatches = 0;
+  for (int width : ca_widths) {
+    CellularAutomatonEngine dense(&kernel);
+    CellularAutomatonEngine sparse(&kernel);
+    CellularAutomatonEngine memoized(&kernel);
+    for (auto *engine : {&dense, &sparse, &memoized})
+      engine->initialize(width, 3);
+
+    for (int rule : ca_rules) {
+      for (int generations : ca_generations) {
+        // Same seed and call count, so all three start from the same grid
+        for (auto *engine : {&dense, &sparse, &memoized}) {
+          engine->set_rule(rule);
+          engine->randomize(0.3f, 1234);
+        }
+        dense.run(generations);
+        sparse.run_sparse(generations);
+        memoized.run_memoized(generations);
+
+        ca_cases++;
+        const auto &expected = dense.get_state().grid;
+        if (sparse.get_state().grid != expected ||
+            memoized.get_state().grid != expected) {
+          ca_mismatches++;
+          std::cout << "  Mismatch: rule " << rule << ", width " << width
+                    << ", " << generations << " generations" << std::endl;
+        }
+      }
+    }
+  }
+  std::cout << "  " << ca_cases - ca_mismatches << "/" << ca_cases
+            << " rule/width/generation cases match run(): "
+            << (ca_mismatches == 0 ? "PASS" : "FAIL") << std::endl;
+  if (ca_mismatches > 0)
+    failures++;
+
+  // ================================================================
+  // Part 13: Pattern Query vs Brute Force
+  // ================================================================
+  std::cout << "\n--- Part 13: Pattern Query vs Brute Force ---" << std::endl;
+
+  TimeCrystalKernel query_space(tc_config);
+  query_space.initialize();
+
+  std::vector<std::string> concepts;
+  for (int i = 0; i < 60; i++) {
+    concepts.push_back(query_space.create_atom(
+        i % 3 == 0 ? "PredicateNode" : "ConceptNode",
+        "q" + std::to_string(i), {0.8f, 0.9f, 1.0f}, {10, 1, 0}, {2, 3},
+        {}));
+  }
+  // Distinct, loop-free pairs over a mix of rules
+  for (int i = 0; i < 60; i++) {
+    for (int step : {1, 7, 23}) {
+      int j = (i + step) % 60;
+      InferenceRuleType rule = (i + step) % 4 == 0
+                                   ? InferenceRuleType::Similarity
+                                   : InferenceRuleType::Inheritance;
+      query_space.create_inference(concepts[i], concepts[j], rule);
+    }
+  }
+
+  // Premise pairs of every link with this rule
+  std::vector<std::vector<std::string>> pairs;
+  for (const auto &id : query_space.get_all_inference_ids()) {
+    const TimeCrystalInference *inf = query_space.get_inference(id);
+    if (inf && inf->rule == InferenceRuleType::Inheritance &&
+        inf->premise_ids.size() == 2)
+      pairs.push_back(inf->premise_ids);
+  }
+
+  AtomSpaceQueryEngine query(&query_space);
+  auto check_rows = [&](const std::string &name, const QueryPattern &pattern,
+                        std::vector<std::vector<std::string>> expected) {
+    std::sort(expected.begin(), expected.end());
+    QueryResult result = query.execute(pattern);
+    bool match = result.success && result.rows == expected;
+    std::cout << "  " << name << ": " << result.rows.size() << " rows, "
+              << expected.size() << " expected: " << (match ? "PASS" : "FAIL")
+              << std::endl;
+    if (!match)
+      failures++;
+    return result;
+  };
+
+  // ($a, $b)
+  QueryClause ab;
+  ab.premises = {QueryTerm::variable("$a"), QueryTerm::variable("$b")};
+  QueryPattern single;
+  single.clauses = {ab};
+  QueryResult all_pairs = check_rows("Single clause", single, pairs);
+
+  // (anchor, $b)
+  QueryClause anchored_clause;
+  anchored_clause.premises = {QueryTerm::atom(concepts[0]),
+                              QueryTerm::variable("$b")};
+  QueryPattern anchored;
+  anchored.clauses = {anchored_clause};
+  std::vector<std::vector<std::string>> anchored_expected;
+  for (const auto &pair : pairs) {
+    if (pair[0] == concepts[0])
+      anchored_expected.push_back({pair[1]});
+  }
+  check_rows("Anchored clause", anchored, anchored_expected);
+
+  // ($a, $b) and ($b, $c)
+  QueryClause bc;
+  bc.premises = {QueryTerm::variable("$b"), QueryTerm::variable("$c")};
+  QueryPattern join;
+  join.clauses = {ab, bc};
+  std::vector<std::vector<std::string>> join_expected;
+  for (const auto &first : pairs) {
+    for (const auto &second : pairs) {
+      if (first[1] == second[0])
+        join_expected.push_back({first[0], first[1], second[1]});
+    }
+  }
+  check_rows("Two-hop join", join, join_expected);
+
+  // A limited query returns that many of the full rows, the same each time
+  const size_t query_limit = 5;
+  QueryResult limited = query.execute(single, query_limit);
+  QueryResult repeated = query.execute(single, query_limit);
+  bool limited_ok = limited.success &&
+                    limited.rows.size() ==
+                        std::min(query_limit, all_pairs.rows.size()) &&
+                    limited.rows == repeated.rows;
+  for (const auto &row : limited.rows) {
+    if (!std::binary_search(all_pairs.rows.begin(), all_pairs.rows.end(),
+                            row))
+      limited_ok = false;
+  }
+  std::cout << "  Limited to " << query_limit << ": " << limited.rows.size()
+            << " rows: " << (limited_ok ? "PASS" : "FAIL") << std::endl;
+  if (!limited_ok)
+    failures++;
+
   // Cleanup mock tensors
   for (auto *node : node_tensors) {
     delete node;
@@ -635,12 +791,15 @@ int main() {
   // ================================================================
   std::cout << "\n==================================================="
             << std::endl;
-  std::cout << "    All Tests Complete                            "
-            << std::endl;
+  if (failures > 0)
+    std::cout << "    " << failures << " Checks Failed" << std::endl;
+  else
+    std::cout << "    All Tests Complete                            "
+              << std::endl;
   std::cout << "    NanoBrain C++ llama.cpp Adaptation Ready      "
             << std::endl;
   std::cout << "==================================================="
             << std::endl;
 
-  return 0;
+  return failures > 0 ? 1 : 0;
 }
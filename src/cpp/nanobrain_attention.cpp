@@ -1,4 +1,5 @@
 #include "nanobrain_attention.h"
+#include "nanobrain_trace.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -38,17 +39,16 @@ void AttentionAllocationEngine::initialize_global_attention(size_t num_nodes) {
     num_nodes = 1000; // Default
 
   // Create main attention distribution tensor
-  global_attention.attention_distribution =
-      kernel->create_tensor({static_cast<int64_t>(num_nodes)});
+  global_attention.attention_distribution = kernel->create_tensor(
+      {static_cast<int64_t>(num_nodes)}, TensorInitPolicy::zero());
 
   // Create gradient tensor
-  global_attention.attention_gradients =
-      kernel->create_tensor({static_cast<int64_t>(num_nodes)});
+  global_attention.attention_gradients = kernel->create_tensor(
+      {static_cast<int64_t>(num_nodes)}, TensorInitPolicy::zero());
 
   // Create temperature tensor (single value)
-  global_attention.temperature_tensor = kernel->create_tensor({1});
-  std::vector<float> temp_data = {config.temperature};
-  kernel->set_data(global_attention.temperature_tensor, temp_data);
+  global_attention.temperature_tensor =
+      kernel->create_tensor_from({config.temperature});
 
   // Initialize attention heads for multi-head attention
   int embedding_dim = 128;
@@ -59,13 +59,16 @@ void AttentionAllocationEngine::initialize_global_attention(size_t num_nodes) {
     head.head_id = h;
     head.head_scale = 1.0f / std::sqrt(static_cast<float>(head_dim));
 
-    // Create projection tensors
-    head.query_projection = kernel->create_tensor(
-        {static_cast<int64_t>(embedding_dim), static_cast<int64_t>(head_dim)});
-    head.key_projection = kernel->create_tensor(
-        {static_cast<int64_t>(embedding_dim), static_cast<int64_t>(head_dim)});
-    head.value_projection = kernel->create_tensor(
-        {static_cast<int64_t>(embedding_dim), static_cast<int64_t>(head_dim)});
+    // Create projection tensors (learned weights, so Xavier regardless of
+    // the kernel's default)
+    const std::vector<int64_t> shape = {static_cast<int64_t>(embedding_dim),
+                                        static_cast<int64_t>(head_dim)};
+    head.query_projection =
+        kernel->create_tensor(shape, TensorInitPolicy::xavier());
+    head.key_projection =
+        kernel->create_tensor(shape, TensorInitPolicy::xavier());
+    head.value_projection =
+        kernel->create_tensor(shape, TensorInitPolicy::xavier());
 
     // Attention weights will be computed dynamically
     head.attention_weights = nullptr;
@@ -83,6 +86,8 @@ void AttentionAllocationEngine::initialize_global_attention(size_t num_nodes) {
 AttentionStats AttentionAllocationEngine::update_attention_allocation(
     const std::vector<NodeTensor *> &node_tensors,
     const std::vector<LinkTensor *> &link_tensors) {
+  NB_TRACE_SCOPE("attention",
+                 "AttentionAllocationEngine::update_attention_allocation");
 
   AttentionStats stats;
 
@@ -210,8 +215,6 @@ NanoBrainTensor *AttentionAllocationEngine::compute_attention_scores(
   if (nodes.empty())
     return nullptr;
 
-  // Create score tensor
-  auto *scores = kernel->create_tensor({static_cast<int64_t>(nodes.size())});
   std::vector<float> score_data(nodes.size(), 0.0f);
 
   // Compute scores based on embeddings
@@ -230,8 +233,7 @@ NanoBrainTensor *AttentionAllocationEngine::compute_attention_scores(
     score /= config.temperature;
   }
 
-  kernel->set_data(scores, score_data);
-  return scores;
+  return kernel->create_tensor_from(score_data);
 }
 
 NanoBrainTensor *AttentionAllocationEngine::apply_attention_to_values(
@@ -252,10 +254,8 @@ NanoBrainTensor *AttentionAllocationEngine::apply_attention_to_values(
       if (nodes[i]->attention_weights) {
         kernel->compute(nodes[i]->attention_weights);
         // Create update tensor
-        auto *update = kernel->create_tensor({1});
-        std::vector<float> update_data = {weight * config.resource_budget /
-                                          nodes.size()};
-        kernel->set_data(update, update_data);
+        auto *update = kernel->create_tensor_from(
+            {weight * config.resource_budget / nodes.size()});
 
         // Note: In a real implementation, we'd update the node's attention
         // Here we just compute to ensure the graph is evaluated
@@ -301,9 +301,7 @@ NanoBrainTensor *AttentionAllocationEngine::multi_head_self_attention(
       auto *attention_logits = kernel->contract(queries[0], keys[0]);
 
       // Scale
-      auto *scale = kernel->create_tensor({1});
-      std::vector<float> scale_data = {head.head_scale};
-      kernel->set_data(scale, scale_data);
+      auto *scale = kernel->create_tensor_from({head.head_scale});
       auto *scaled_logits = kernel->mul(attention_logits, scale);
 
       // Softmax
@@ -330,9 +328,8 @@ NanoBrainTensor *AttentionAllocationEngine::multi_head_self_attention(
     result = kernel->add(result, head_outputs[i]);
   }
 
-  auto *num_heads = kernel->create_tensor({1});
-  std::vector<float> num_data = {static_cast<float>(head_outputs.size())};
-  kernel->set_data(num_heads, num_data);
+  auto *num_heads =
+      kernel->create_tensor_from({static_cast<float>(head_outputs.size())});
   result = kernel->div(result, num_heads);
 
   kernel->compute(result);
@@ -346,6 +343,8 @@ NanoBrainTensor *AttentionAllocationEngine::multi_head_self_attention(
 void AttentionAllocationEngine::apply_attention_diffusion(
     const std::vector<NodeTensor *> &node_tensors,
     const std::vector<LinkTensor *> &link_tensors) {
+  NB_TRACE_SCOPE("attention",
+                 "AttentionAllocationEngine::apply_attention_diffusion");
 
   // For each link, spread attention from source to target
   for (const auto *link : link_tensors) {
@@ -375,9 +374,7 @@ void AttentionAllocationEngine::apply_attention_diffusion(
       for (const auto &target_id : link->target_nodes) {
         for (auto *node : node_tensors) {
           if (node && node->atom_id == target_id && node->attention_weights) {
-            auto *delta = kernel->create_tensor({1});
-            std::vector<float> delta_data = {amount_per_target};
-            kernel->set_data(delta, delta_data);
+            auto *delta = kernel->create_tensor_from({amount_per_target});
 
             auto *new_att = kernel->add(node->attention_weights, delta);
             kernel->compute(new_att);
@@ -403,12 +400,7 @@ void AttentionAllocationEngine::collect_rent(
     float rent = current_attention * config.rent_collection_rate;
     float new_attention = std::max(0.0f, current_attention - rent);
 
-    auto *new_att_tensor = kernel->create_tensor({1});
-    std::vector<float> att_data = {new_attention};
-    kernel->set_data(new_att_tensor, att_data);
-
-    // Note: In actual implementation, we'd update the node's tensor
-    // For now, we just track the change
+    kernel->set_value(node->attention_weights, 0, new_attention);
   }
 }
 
@@ -456,10 +448,7 @@ void AttentionAllocationEngine::distribute_wages(
       kernel->compute(node->attention_weights);
       float current = kernel->get_value(node->attention_weights, 0);
 
-      auto *new_att = kernel->create_tensor({1});
-      std::vector<float> att_data = {current + wage};
-      kernel->set_data(new_att, att_data);
-      // Update node's attention (conceptually)
+      kernel->set_value(node->attention_weights, 0, current + wage);
     }
   }
 }
@@ -502,10 +491,7 @@ void AttentionAllocationEngine::update_link_attention(
         std::sqrt(total_source_attention * total_target_attention);
 
     if (link->attention_weights) {
-      auto *new_att = kernel->create_tensor({1});
-      std::vector<float> att_data = {link_attention};
-      kernel->set_data(new_att, att_data);
-      // Update link attention (conceptually)
+      kernel->set_value(link->attention_weights, 0, link_attention);
     }
   }
 }
@@ -545,9 +531,7 @@ void AttentionAllocationEngine::apply_gradient_updates(
     // Ensure non-negative
     updated = std::max(0.0f, updated);
 
-    auto *new_att = kernel->create_tensor({1});
-    std::vector<float> att_data = {updated};
-    kernel->set_data(new_att, att_data);
+    kernel->set_value(node->attention_weights, 0, updated);
   }
 }
 
@@ -557,7 +541,6 @@ NanoBrainTensor *AttentionAllocationEngine::compute_attention_gradients(
   if (nodes.empty())
     return nullptr;
 
-  auto *gradients = kernel->create_tensor({static_cast<int64_t>(nodes.size())});
   std::vector<float> grad_data(nodes.size(), 0.0f);
 
   // Simple gradient: difference from mean attention
@@ -585,8 +568,7 @@ NanoBrainTensor *AttentionAllocationEngine::compute_attention_gradients(
     }
   }
 
-  kernel->set_data(gradients, grad_data);
-  return gradients;
+  return kernel->create_tensor_from(grad_data);
 }
 
 // ================================================================
@@ -615,9 +597,7 @@ void AttentionAllocationEngine::enforce_resource_constraints(
         kernel->compute(node->attention_weights);
         float current = kernel->get_value(node->attention_weights, 0);
 
-        auto *scaled = kernel->create_tensor({1});
-        std::vector<float> scaled_data = {current * scale};
-        kernel->set_data(scaled, scaled_data);
+        kernel->set_value(node->attention_weights, 0, current * scale);
       }
     }
   }
@@ -643,9 +623,7 @@ void AttentionAllocationEngine::normalize_attention(
         float current = kernel->get_value(node->attention_weights, 0);
         float normalized = current / total_attention;
 
-        auto *norm_tensor = kernel->create_tensor({1});
-        std::vector<float> norm_data = {normalized};
-        kernel->set_data(norm_tensor, norm_data);
+        kernel->set_value(node->attention_weights, 0, normalized);
       }
     }
   }
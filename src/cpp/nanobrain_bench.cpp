@@ -0,0 +1,213 @@
+#include "nanobrain_bench.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+// ================================================================
+// Helpers
+// ================================================================
+
+namespace {
+
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return c; }
+  std::streamsize xsputn(const char *, std::streamsize n) override {
+    return n;
+  }
+};
+
+NullBuffer null_buffer;
+
+void write_number_map(std::ostream &out,
+                      const std::map<std::string, double> &values) {
+  out << "{";
+  bool first = true;
+  for (const auto &[key, value] : values) {
+    if (!first)
+      out << ", ";
+    out << "\"" << bench_json_escape(key) << "\": " << value;
+    first = false;
+  }
+  out << "}";
+}
+
+} // namespace
+
+std::string bench_json_escape(const std::string &s) {
+  std::string escaped;
+  escaped.reserve(s.size());
+  for (char c : s) {
+    switch (c) {
+    case '"':
+      escaped += "\\\"";
+      break;
+    case '\\':
+      escaped += "\\\\";
+      break;
+    case '\n':
+      escaped += "\\n";
+      break;
+    case '\t':
+      escaped += "\\t";
+      break;
+    default:
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+// ================================================================
+// ScopedStdoutSilencer Implementation
+// ================================================================
+
+ScopedStdoutSilencer::ScopedStdoutSilencer(bool enabled) {
+  if (enabled) {
+    saved = std::cout.rdbuf(&null_buffer);
+  }
+}
+
+ScopedStdoutSilencer::~ScopedStdoutSilencer() {
+  if (saved) {
+    std::cout.rdbuf(saved);
+  }
+}
+
+// ================================================================
+// BenchmarkRunner Implementation
+// ================================================================
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions &opts)
+    : options(opts) {}
+
+bool BenchmarkRunner::enabled(const std::string &suite,
+                              const std::string &name) const {
+  if (options.filter.empty())
+    return true;
+  return (suite + "." + name).find(options.filter) != std::string::npos;
+}
+
+BenchmarkResult *BenchmarkRunner::run(const BenchmarkCase &bench,
+                                      const std::function<void()> &body,
+                                      const std::function<void()> &setup) {
+  if (!enabled(bench.suite, bench.name))
+    return nullptr;
+
+  using clock = std::chrono::steady_clock;
+
+  BenchmarkResult result;
+  result.suite = bench.suite;
+  result.name = bench.name;
+  result.params = bench.params;
+
+  size_t max_iterations = bench.max_iterations > 0
+                              ? std::min(bench.max_iterations,
+                                         options.max_iterations)
+                              : options.max_iterations;
+  max_iterations = std::max<size_t>(max_iterations, 1);
+
+  std::vector<double> samples;
+  {
+    ScopedStdoutSilencer silence(options.quiet);
+
+    auto setup_start = clock::now();
+    if (setup)
+      setup();
+    result.setup_ms = std::chrono::duration<double, std::milli>(
+                          clock::now() - setup_start)
+                          .count();
+
+    // Warmup (untimed)
+    body();
+
+    double elapsed_ms = 0.0;
+    while (samples.size() < max_iterations &&
+           (elapsed_ms < options.min_time_ms ||
+            samples.size() < options.min_iterations)) {
+      auto t0 = clock::now();
+      body();
+      double ns =
+          std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+      samples.push_back(ns);
+      elapsed_ms += ns / 1e6;
+    }
+  }
+
+  std::vector<double> sorted = samples;
+  std::sort(sorted.begin(), sorted.end());
+
+  result.iterations = samples.size();
+  result.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) /
+                   samples.size();
+  result.median_ns = sorted[sorted.size() / 2];
+  result.min_ns = sorted.front();
+  result.max_ns = sorted.back();
+
+  double variance = 0.0;
+  for (double s : samples) {
+    variance += (s - result.mean_ns) * (s - result.mean_ns);
+  }
+  result.stddev_ns = std::sqrt(variance / samples.size());
+  result.items_per_second =
+      result.mean_ns > 0.0 ? bench.items_per_iteration * 1e9 / result.mean_ns
+                           : 0.0;
+
+  results.push_back(result);
+  return &results.back();
+}
+
+void BenchmarkRunner::write_json(
+    std::ostream &out,
+    const std::map<std::string, std::string> &metadata) const {
+  out << std::setprecision(9);
+  out << "{\n";
+  out << "  \"schema\": \"nanobrain-bench/1\",\n";
+  out << "  \"metadata\": {";
+  bool first = true;
+  for (const auto &[key, value] : metadata) {
+    if (!first)
+      out << ", ";
+    out << "\"" << bench_json_escape(key) << "\": \""
+        << bench_json_escape(value) << "\"";
+    first = false;
+  }
+  out << "},\n";
+
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto &r = results[i];
+    out << "    {\"suite\": \"" << bench_json_escape(r.suite)
+        << "\", \"name\": \"" << bench_json_escape(r.name)
+        << "\", \"params\": ";
+    write_number_map(out, r.params);
+    out << ", \"iterations\": " << r.iterations
+        << ", \"mean_ns\": " << r.mean_ns << ", \"median_ns\": " << r.median_ns
+        << ", \"min_ns\": " << r.min_ns << ", \"max_ns\": " << r.max_ns
+        << ", \"stddev_ns\": " << r.stddev_ns
+        << ", \"items_per_second\": " << r.items_per_second
+        << ", \"setup_ms\": " << r.setup_ms << ", \"counters\": ";
+    write_number_map(out, r.counters);
+    out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+void BenchmarkRunner::write_summary(std::ostream &out) const {
+  for (const auto &r : results) {
+    std::ostringstream label;
+    label << r.suite << "." << r.name;
+    for (const auto &[key, value] : r.params) {
+      label << " " << key << "=" << value;
+    }
+    out << std::left << std::setw(56) << label.str() << std::right
+        << std::fixed << std::setprecision(3) << std::setw(14)
+        << r.mean_ns / 1e6 << " ms" << std::setw(16) << std::setprecision(0)
+        << r.items_per_second << " items/s" << std::endl;
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef NANOBRAIN_BENCH_H
+#define NANOBRAIN_BENCH_H
+
+/**
+ * NanoBrain Benchmark Harness
+ *
+ * Minimal timing harness used by the nanobrain_bench executable. Each case
+ * is warmed up once, then repeated until a minimum wall time or iteration
+ * cap is reached. Results are emitted as JSON so runs from different
+ * releases can be diffed by tooling.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Benchmark runner options
+ */
+struct BenchmarkOptions {
+  double min_time_ms = 200.0;   // Keep iterating until this much time elapsed
+  size_t min_iterations = 3;    // ... and at least this many iterations
+  size_t max_iterations = 1000; // Hard iteration cap
+  std::string filter;           // Substring matched against "suite.name"
+  bool quiet = true;            // Silence std::cout chatter inside cases
+};
+
+/**
+ * Description of one benchmark case
+ */
+struct BenchmarkCase {
+  std::string suite; // e.g. "attention"
+  std::string name;  // e.g. "diffusion"
+  std::map<std::string, double> params;
+  double items_per_iteration = 1.0; // For items_per_second
+  size_t max_iterations = 0;        // Per-case cap (0 = runner default)
+};
+
+/**
+ * Timing result for one benchmark case
+ */
+struct BenchmarkResult {
+  std::string suite;
+  std::string name;
+  std::map<std::string, double> params;
+  std::map<std::string, double> counters; // Case-specific extra metrics
+  size_t iterations = 0;
+  double mean_ns = 0.0;
+  double median_ns = 0.0;
+  double min_ns = 0.0;
+  double max_ns = 0.0;
+  double stddev_ns = 0.0;
+  double items_per_second = 0.0;
+  double setup_ms = 0.0;
+};
+
+/**
+ * Benchmark Runner
+ */
+class BenchmarkRunner {
+public:
+  explicit BenchmarkRunner(const BenchmarkOptions &options);
+
+  // True if the case passes the filter; use to skip expensive setup
+  bool enabled(const std::string &suite, const std::string &name) const;
+
+  // Time `body`. `setup` runs once (untimed) before warmup. Returns the
+  // stored result so callers can attach counters.
+  BenchmarkResult *run(const BenchmarkCase &bench,
+                       const std::function<void()> &body,
+                       const std::function<void()> &setup = nullptr);
+
+  const std::vector<BenchmarkResult> &get_results() const { return results; }
+
+  // Emit all results as a JSON document
+  void write_json(std::ostream &out,
+                  const std::map<std::string, std::string> &metadata) const;
+
+  // One line per result, for humans
+  void write_summary(std::ostream &out) const;
+
+private:
+  BenchmarkOptions options;
+  std::vector<BenchmarkResult> results;
+};
+
+/**
+ * Redirects std::cout to a null sink for the lifetime of the scope
+ */
+class ScopedStdoutSilencer {
+public:
+  explicit ScopedStdoutSilencer(bool enabled = true);
+  ~ScopedStdoutSilencer();
+
+  ScopedStdoutSilencer(const ScopedStdoutSilencer &) = delete;
+  ScopedStdoutSilencer &operator=(const ScopedStdoutSilencer &) = delete;
+
+private:
+  std::streambuf *saved = nullptr;
+};
+
+// Escape a string for inclusion in JSON output
+std::string bench_json_escape(const std::string &s);
+
+#endif // NANOBRAIN_BENCH_H
@@ -3,8 +3,8 @@
 #include <chrono>
 #include <cmath>
 #include <iostream>
+#include <iterator>
 #include <numeric>
-#include <random>
 #include <sstream>
 
 // ================================================================
@@ -273,6 +273,64 @@ void BioMorphicDeviceRegistry::initialize_full_registry() {
 // Fractal Condensation Implementation
 // ================================================================
 
+namespace {
+
+// Run fn(begin, end, chunk) over [0, n) split into `workers` contiguous
+// chunks on the pool, or in one chunk on the calling thread without one
+template <typename Fn>
+void run_chunked(NanoBrainThreadPool *pool, size_t n, size_t workers, Fn fn) {
+  if (!pool || workers <= 1) {
+    fn(size_t{0}, n, size_t{0});
+    return;
+  }
+  size_t per_chunk = (n + workers - 1) / workers;
+  pool->run_chunks(workers, [&](size_t c) {
+    size_t begin = std::min(n, c * per_chunk);
+    fn(begin, std::min(n, begin + per_chunk), c);
+  });
+}
+
+// Sum of strength / (1 + |x - p|^2) over all points. Points are processed
+// in fixed lanes with per-lane partial sums so the loop vectorizes without
+// relaxed floating-point reassociation.
+float field_value_at(const CondensationPointStore &store, const float *x) {
+  constexpr size_t LANES = 8;
+  const size_t n = store.size();
+  const size_t n_vec = n - n % LANES;
+  const float *strength = store.strength.data();
+
+  float acc[LANES] = {};
+  for (size_t base = 0; base < n_vec; base += LANES) {
+    float dist_sq[LANES] = {};
+    for (int d = 0; d < 11; ++d) {
+      const float *c = store.coords[d].data() + base;
+      for (size_t l = 0; l < LANES; ++l) {
+        float diff = x[d] - c[l];
+        dist_sq[l] += diff * diff;
+      }
+    }
+    for (size_t l = 0; l < LANES; ++l) {
+      acc[l] += strength[base + l] / (1.0f + dist_sq[l]);
+    }
+  }
+
+  float value = 0.0f;
+  for (size_t l = 0; l < LANES; ++l) {
+    value += acc[l];
+  }
+  for (size_t i = n_vec; i < n; ++i) {
+    float dist_sq = 0.0f;
+    for (int d = 0; d < 11; ++d) {
+      float diff = x[d] - store.coords[d][i];
+      dist_sq += diff * diff;
+    }
+    value += strength[i] / (1.0f + dist_sq);
+  }
+  return value;
+}
+
+} // namespace
+
 FractalCondensation::FractalCondensation(
     NanoBrainKernel *kernel, const FractalCondensationConfig &config)
     : kernel(kernel), config(config) {
@@ -290,32 +348,55 @@ void FractalCondensation::condense_everywhere() {
 
   clear_points();
 
-  // Sample 11D space at grid points
-  float step = config.spatial_resolution * 10.0f;
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  // Sample 11D space at random seed positions. Each chunk keeps its hits
+  // in sample order and chunks are concatenated in order, so the result
+  // only depends on the seed.
+  const size_t samples =
+      static_cast<size_t>(std::max(0, config.max_condensation_points));
+  const uint64_t call = condense_calls++;
+  const size_t workers = worker_count(samples);
+
+  std::vector<std::vector<CondensationPoint>> found(
+      std::max<size_t>(1, workers));
+  auto search = [&](size_t begin, size_t end, size_t chunk) {
+    auto &out = found[chunk];
+    for (size_t i = begin; i < end; ++i) {
+      CounterRng rng(config.seed, RandomSubsystem::FractalCondensation, i,
+                     call);
+      std::array<float, 11> seed_position;
+      for (int d = 0; d < 11; ++d) {
+        seed_position[d] = rng.uniform(-1.0f, 1.0f);
+      }
 
-  for (int i = 0; i < config.max_condensation_points; ++i) {
-    std::array<float, 11> seed_position;
-    for (int d = 0; d < 11; ++d) {
-      seed_position[d] = dist(gen);
+      CondensationPoint point = find_condensation_point(seed_position);
+      if (point.condensation_strength > config.prime_threshold) {
+        apply_prime_at_point(point);
+        out.push_back(std::move(point));
+      }
     }
+  };
+  run_chunked(config.thread_pool, samples, workers, search);
 
-    CondensationPoint point = find_condensation_point(seed_position);
-    if (point.condensation_strength > config.prime_threshold) {
-      active_points.push_back(point);
-    }
+  size_t total = 0;
+  for (const auto &chunk : found) {
+    total += chunk.size();
   }
-
-  // Apply prime pattern to all points
-  apply_prime_pattern();
+  active_points.reserve(total);
+  for (auto &chunk : found) {
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(active_points));
+  }
+  point_store_dirty = true;
 }
 
 void FractalCondensation::apply_prime_pattern() {
-  for (auto &point : active_points) {
-    apply_prime_at_point(point);
-  }
+  run_chunked(config.thread_pool, active_points.size(),
+              worker_count(active_points.size()),
+              [this](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                  apply_prime_at_point(active_points[i]);
+                }
+              });
+  point_store_dirty = true;
 }
 
 std::vector<CondensationPoint> FractalCondensation::get_points() const {
@@ -327,6 +408,7 @@ void FractalCondensation::add_condensation_point(
   if (active_points.size() <
       static_cast<size_t>(config.max_condensation_points)) {
     active_points.push_back(point);
+    point_store_dirty = true;
   }
 }
 
@@ -334,6 +416,7 @@ void FractalCondensation::clear_points() {
   active_points.clear();
   field.active_points.clear();
   field.total_condensation = 0.0f;
+  point_store_dirty = true;
 }
 
 CondensationField FractalCondensation::compute_field() {
@@ -345,20 +428,20 @@ CondensationField FractalCondensation::compute_field() {
   }
   field.total_condensation = total;
 
-  // Compute field coherence
+  // Compute field coherence: the mean of cos(phase_i - phase_j) over all
+  // pairs, via the phasor sum |sum e^(i*phase)|^2 = N + 2 * sum_pairs cos
   if (active_points.size() >= 2) {
-    float coherence_sum = 0.0f;
-    for (size_t i = 0; i < active_points.size() - 1; ++i) {
-      for (size_t j = i + 1; j < active_points.size(); ++j) {
-        // Compute phase alignment
-        float phase_diff = std::abs(active_points[i].temporal_phase -
-                                    active_points[j].temporal_phase);
-        coherence_sum += std::cos(phase_diff);
-      }
+    double cos_sum = 0.0;
+    double sin_sum = 0.0;
+    for (const auto &point : active_points) {
+      cos_sum += std::cos(point.temporal_phase);
+      sin_sum += std::sin(point.temporal_phase);
     }
-    int pair_count =
-        static_cast<int>(active_points.size() * (active_points.size() - 1) / 2);
-    field.field_coherence = (coherence_sum / pair_count + 1.0f) / 2.0f;
+    double n = static_cast<double>(active_points.size());
+    double pair_cos_sum = (cos_sum * cos_sum + sin_sum * sin_sum - n) / 2.0;
+    double pair_count = n * (n - 1.0) / 2.0;
+    field.field_coherence =
+        static_cast<float>((pair_cos_sum / pair_count + 1.0) / 2.0);
   } else {
     field.field_coherence = 1.0f;
   }
@@ -368,22 +451,56 @@ CondensationField FractalCondensation::compute_field() {
 
 float FractalCondensation::get_field_value(
     const std::array<float, 11> &position) {
-  float value = 0.0f;
+  return field_value_at(get_point_store(), position.data());
+}
 
-  for (const auto &point : active_points) {
-    // Compute distance in 11D
-    float distance_sq = 0.0f;
+void FractalCondensation::get_field_values(
+    const std::array<float, 11> *positions, size_t count, float *out) {
+  const CondensationPointStore &store = get_point_store();
+
+  // Parallelise over query positions once the total work is large enough
+  size_t work = count * std::max<size_t>(store.size(), 1);
+  size_t workers = std::min(count, worker_count(work));
+  run_chunked(config.thread_pool, count, workers,
+              [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                  out[i] = field_value_at(store, positions[i].data());
+                }
+              });
+}
+
+std::vector<float> FractalCondensation::get_field_values(
+    const std::vector<std::array<float, 11>> &positions) {
+  std::vector<float> values(positions.size());
+  get_field_values(positions.data(), positions.size(), values.data());
+  return values;
+}
+
+const CondensationPointStore &FractalCondensation::get_point_store() {
+  if (point_store_dirty) {
+    size_t n = active_points.size();
     for (int d = 0; d < 11; ++d) {
-      float diff = position[d] - point.position[d];
-      distance_sq += diff * diff;
+      point_store.coords[d].resize(n);
     }
-    float distance = std::sqrt(distance_sq);
-
-    // Inverse square falloff
-    value += point.condensation_strength / (1.0f + distance * distance);
+    point_store.strength.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      const auto &point = active_points[i];
+      for (int d = 0; d < 11; ++d) {
+        point_store.coords[d][i] = point.position[d];
+      }
+      point_store.strength[i] = point.condensation_strength;
+    }
+    point_store_dirty = false;
   }
+  return point_store;
+}
 
-  return value;
+size_t FractalCondensation::worker_count(size_t items) const {
+  if (!config.thread_pool)
+    return 1;
+  size_t threads = config.thread_pool->get_thread_count();
+  size_t grain = std::max<size_t>(config.parallel_grain, 1);
+  return std::max<size_t>(1, std::min(threads, items / grain));
 }
 
 void FractalCondensation::set_prime_pattern(const std::vector<int> &primes) {
@@ -716,11 +833,26 @@ void BrainJellySimulator::propagate_resonance() {
 // Cortical Pen Freezer Implementation
 // ================================================================
 
+namespace {
+
+float *tensor_floats(NanoBrainTensor *tensor) {
+  return static_cast<float *>(tensor->ggml_tensor->data);
+}
+
+} // namespace
+
 CorticalPenFreezer::CorticalPenFreezer(NanoBrainKernel *kernel,
                                        TimeCrystalKernel *time_crystal,
                                        const CorticalPenConfig &config)
     : kernel(kernel), time_crystal(time_crystal), config(config),
-      capsule_counter(0) {}
+      capsule_counter(0) {
+  if (config.resident_capsules > 0 &&
+      !segment.open(config.spill_path, state_floats())) {
+    std::cerr << "[CorticalPenFreezer] No segment file, keeping every "
+                 "capsule resident"
+              << std::endl;
+  }
+}
 
 CorticalPenFreezer::~CorticalPenFreezer() { capsules.clear(); }
 
@@ -730,17 +862,28 @@ std::string CorticalPenFreezer::freeze_dynamics(
   if (!current_state)
     return "";
 
+  // Without a slot the state would be lost, and make_resident would hand
+  // back zeros for it
+  int slot = acquire_slot();
+  if (slot < 0) {
+    std::cerr << "[CorticalPenFreezer] No slot for the frozen state, "
+                 "capsule not created"
+              << std::endl;
+    return "";
+  }
+
   std::string id = "capsule_" + std::to_string(capsule_counter++);
 
   auto capsule = std::make_unique<ProblemCapsule>();
   capsule->id = id;
-  capsule->frozen_state = encode_to_time_crystal(current_state);
   capsule->prime_signature = compute_signature(current_state);
   capsule->temporal_anchor = static_cast<float>(capsule_counter);
   capsule->complexity_order = static_cast<int>(related_atoms.size());
   capsule->related_atoms = related_atoms;
+  capsule->frozen_state = slots[slot];
+  encode_to_time_crystal(current_state, capsule->frozen_state);
 
-  capsules[id] = std::move(capsule);
+  insert_capsule(std::move(capsule), slot);
   return id;
 }
 
@@ -749,29 +892,41 @@ CorticalPenFreezer::create_problem_capsule(const std::string &problem_id) {
   // Create a new capsule for a problem
   auto capsule = std::make_unique<ProblemCapsule>();
   capsule->id = problem_id;
-  capsule->frozen_state = kernel->create_tensor(config.time_crystal_resolution);
   capsule->prime_signature = {2, 3, 5, 7, 11};
   capsule->temporal_anchor = static_cast<float>(capsule_counter++);
   capsule->complexity_order = 5;
 
-  ProblemCapsule *ptr = capsule.get();
-  capsules[problem_id] = std::move(capsule);
-  return ptr;
+  int slot = acquire_slot();
+  if (slot >= 0) {
+    capsule->frozen_state = slots[slot];
+    std::fill_n(tensor_floats(capsule->frozen_state), state_floats(), 0.0f);
+  } else {
+    capsule->frozen_state = nullptr;
+  }
+
+  return insert_capsule(std::move(capsule), slot)->capsule.get();
 }
 
 ProblemCapsule *CorticalPenFreezer::get_capsule(const std::string &id) {
   auto it = capsules.find(id);
-  return it != capsules.end() ? it->second.get() : nullptr;
+  if (it == capsules.end())
+    return nullptr;
+  make_resident(it->second);
+  return it->second.capsule.get();
 }
 
 const ProblemCapsule *
 CorticalPenFreezer::get_capsule(const std::string &id) const {
   auto it = capsules.find(id);
-  return it != capsules.end() ? it->second.get() : nullptr;
+  return it != capsules.end() ? it->second.capsule.get() : nullptr;
 }
 
 bool CorticalPenFreezer::delete_capsule(const std::string &id) {
-  return capsules.erase(id) > 0;
+  auto it = capsules.find(id);
+  if (it == capsules.end())
+    return false;
+  erase_entry(it);
+  return true;
 }
 
 std::vector<std::string> CorticalPenFreezer::get_all_capsule_ids() const {
@@ -783,18 +938,27 @@ std::vector<std::string> CorticalPenFreezer::get_all_capsule_ids() const {
   return ids;
 }
 
-NanoBrainTensor *CorticalPenFreezer::thaw_capsule(const std::string &id) {
-  auto *capsule = get_capsule(id);
-  if (!capsule)
-    return nullptr;
-
-  // Create a copy of the frozen state
-  NanoBrainTensor *thawed =
-      kernel->create_tensor(config.time_crystal_resolution);
+bool CorticalPenFreezer::thaw_capsule(const std::string &id,
+                                      NanoBrainTensor *destination) {
+  auto start = std::chrono::steady_clock::now();
+  if (!destination || !destination->ggml_tensor ||
+      destination->ggml_tensor->type != GGML_TYPE_F32 ||
+      static_cast<size_t>(ggml_nelements(destination->ggml_tensor)) <
+          state_floats())
+    return false;
+  auto it = capsules.find(id);
+  if (it == capsules.end() || !make_resident(it->second))
+    return false;
 
-  // In a real implementation, would copy data from frozen_state to thawed
+  // Copy out so the caller's tensor outlives evictions of the slot
+  std::copy_n(tensor_floats(it->second.capsule->frozen_state), state_floats(),
+              tensor_floats(destination));
 
-  return thawed;
+  thaw_latency.record(static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count()));
+  return true;
 }
 
 std::vector<int>
@@ -806,6 +970,183 @@ CorticalPenFreezer::get_capsule_signature(const std::string &id) const {
   return {};
 }
 
+std::vector<std::string> CorticalPenFreezer::find_capsules_by_signature(
+    const std::vector<int> &signature) const {
+  auto it = signature_index.find(signature);
+  if (it == signature_index.end())
+    return {};
+  return std::vector<std::string>(it->second.begin(), it->second.end());
+}
+
+bool CorticalPenFreezer::is_resident(const std::string &id) const {
+  auto it = capsules.find(id);
+  return it != capsules.end() && it->second.slot >= 0;
+}
+
+CapsuleStoreStats CorticalPenFreezer::get_store_stats() const {
+  size_t state_bytes = state_floats() * sizeof(float) + ggml_tensor_overhead();
+
+  CapsuleStoreStats stats;
+  stats.resident_capsules = lru_order.size();
+  stats.spilled_capsules = capsules.size() - lru_order.size();
+  stats.resident_bytes = slots.size() * state_bytes;
+  if (segment.is_open()) {
+    stats.memory_ceiling_bytes = config.resident_capsules * state_bytes;
+    stats.spill_file_bytes = segment.file_bytes();
+  }
+  stats.evictions = evictions;
+  stats.faults = faults;
+  stats.spill_failures = spill_failures;
+  stats.thaws = thaw_latency.count();
+  stats.thaw_p50_us = thaw_latency.percentile(0.50) / 1000.0f;
+  stats.thaw_p99_us = thaw_latency.percentile(0.99) / 1000.0f;
+  stats.thaw_max_us = thaw_latency.max() / 1000.0f;
+  return stats;
+}
+
+CorticalPenFreezer::CapsuleEntry *
+CorticalPenFreezer::insert_capsule(std::unique_ptr<ProblemCapsule> capsule,
+                                   int slot) {
+  std::string id = capsule->id;
+  auto existing = capsules.find(id);
+  if (existing != capsules.end())
+    erase_entry(existing);
+
+  CapsuleEntry &entry = capsules[id];
+  entry.signature = signature_index.emplace(capsule->prime_signature,
+                                            std::set<std::string>())
+                        .first;
+  entry.signature->second.insert(id);
+  entry.capsule = std::move(capsule);
+  entry.slot = slot;
+  if (slot >= 0) {
+    lru_order.push_front(id);
+    entry.lru = lru_order.begin();
+  }
+  return &entry;
+}
+
+void CorticalPenFreezer::erase_entry(
+    std::map<std::string, CapsuleEntry>::iterator it) {
+  CapsuleEntry &entry = it->second;
+  entry.signature->second.erase(it->first);
+  if (entry.signature->second.empty())
+    signature_index.erase(entry.signature);
+  if (entry.slot >= 0) {
+    free_slots.push_back(entry.slot);
+    lru_order.erase(entry.lru);
+  }
+  if (entry.record >= 0)
+    segment.release(entry.record);
+  capsules.erase(it);
+}
+
+int CorticalPenFreezer::acquire_slot() {
+  if (!free_slots.empty()) {
+    int slot = free_slots.back();
+    free_slots.pop_back();
+    return slot;
+  }
+
+  // Grow the pool up to the cap; past it (or out of context memory),
+  // spill the least recently used state and take its slot
+  bool capped = config.resident_capsules > 0 && segment.is_open();
+  if (!capped || slots.size() < static_cast<size_t>(config.resident_capsules)) {
+    int slot = new_slot();
+    if (slot >= 0)
+      return slot;
+  }
+
+  if (!capped)
+    return -1;
+  if (evict_lru()) {
+    int slot = free_slots.back();
+    free_slots.pop_back();
+    return slot;
+  }
+
+  // The spill failed (out of disk): keep the state resident past the cap
+  // rather than lose it
+  spill_failures++;
+  return new_slot();
+}
+
+int CorticalPenFreezer::new_slot() {
+  // Slots live as long as the freezer, so they never go to the scratch
+  // arena
+  AllocationTagScope tag(kernel, "pen_freezer");
+  MainContextScope main_context(kernel);
+  NanoBrainTensor *state = nullptr;
+  try {
+    state = kernel->create_tensor({static_cast<int64_t>(state_floats())},
+                                  TensorInitPolicy::uninitialized());
+  } catch (const NanoBrainMemoryError &) {
+    // Out of context memory: the caller spills instead
+  }
+  if (!state)
+    return -1;
+  slots.push_back(state);
+  return static_cast<int>(slots.size()) - 1;
+}
+
+bool CorticalPenFreezer::make_resident(CapsuleEntry &entry) {
+  if (entry.slot >= 0) {
+    touch(entry);
+    return true;
+  }
+
+  int slot = acquire_slot();
+  if (slot < 0)
+    return false;
+
+  float *data = tensor_floats(slots[slot]);
+  if (entry.record >= 0) {
+    segment.read(entry.record, data);
+    segment.release(entry.record);
+    entry.record = -1;
+    faults++;
+  } else {
+    // Frozen while the context was full; nothing was ever stored
+    std::fill_n(data, state_floats(), 0.0f);
+  }
+
+  entry.slot = slot;
+  entry.capsule->frozen_state = slots[slot];
+  lru_order.push_front(entry.capsule->id);
+  entry.lru = lru_order.begin();
+  return true;
+}
+
+bool CorticalPenFreezer::evict_lru() {
+  if (lru_order.empty())
+    return false;
+
+  CapsuleEntry &entry = capsules.at(lru_order.back());
+  int64_t record = segment.allocate();
+  if (record < 0)
+    return false;
+  if (!segment.write(record, tensor_floats(slots[entry.slot]))) {
+    segment.release(record);
+    return false;
+  }
+
+  free_slots.push_back(entry.slot);
+  entry.slot = -1;
+  entry.record = record;
+  entry.capsule->frozen_state = nullptr;
+  lru_order.pop_back();
+  evictions++;
+  return true;
+}
+
+void CorticalPenFreezer::touch(CapsuleEntry &entry) {
+  lru_order.splice(lru_order.begin(), lru_order, entry.lru);
+}
+
+size_t CorticalPenFreezer::state_floats() const {
+  return static_cast<size_t>(std::max(config.time_crystal_resolution, 1));
+}
+
 std::vector<int> CorticalPenFreezer::compute_signature(NanoBrainTensor *state) {
   // Compute prime signature from tensor state
   std::vector<int> signature = {2, 3, 5, 7, 11, 13, 17};
@@ -816,15 +1157,27 @@ std::vector<int> CorticalPenFreezer::compute_signature(NanoBrainTensor *state) {
   return signature;
 }
 
-NanoBrainTensor *
-CorticalPenFreezer::encode_to_time_crystal(NanoBrainTensor *dynamics) {
-  // Encode dynamic state into time crystal format
-  NanoBrainTensor *encoded =
-      kernel->create_tensor(config.time_crystal_resolution);
-
-  // Would use time crystal kernel's encoding methods
+void CorticalPenFreezer::encode_to_time_crystal(NanoBrainTensor *dynamics,
+                                                NanoBrainTensor *encoded) {
+  // Resample the dynamic state to the time crystal resolution: each
+  // encoded element is the mean of its share of the source elements
+  float *out = tensor_floats(encoded);
+  size_t width = state_floats();
+  if (!dynamics->ggml_tensor || dynamics->ggml_tensor->type != GGML_TYPE_F32) {
+    std::fill_n(out, width, 0.0f);
+    return;
+  }
 
-  return encoded;
+  const float *in = tensor_floats(dynamics);
+  size_t count = static_cast<size_t>(ggml_nelements(dynamics->ggml_tensor));
+  for (size_t i = 0; i < width; i++) {
+    size_t begin = i * count / width;
+    size_t end = std::min(std::max((i + 1) * count / width, begin + 1), count);
+    float sum = 0.0f;
+    for (size_t j = begin; j < end; j++)
+      sum += in[j];
+    out[i] = end > begin ? sum / (end - begin) : 0.0f;
+  }
 }
 
 // ================================================================
@@ -841,6 +1194,18 @@ HumanoidAvatarInterface::HumanoidAvatarInterface(
   triad_state.jelly_currents.resize(16, 0.0f);
   triad_state.consciousness_level = 0.0f;
   neural_state = kernel->create_tensor(128); // 128D neural state
+
+  if (config.realtime) {
+    sensor_ring =
+        std::make_unique<SpscQueue<Signal11D>>(config.sensor_ring_capacity);
+    motor_buffer = std::make_unique<DoubleBuffer>(config.motor_count);
+    target_buffer = std::make_unique<DoubleBuffer>(config.motor_count);
+    triad_buffer = std::make_unique<DoubleBuffer>(3);
+    step_latency = std::make_unique<LatencyHistogram>(config.latency_buckets);
+    signal_batch.resize(config.max_signals_per_step);
+    triad_state.sensory_inputs.reserve(config.max_signals_per_step);
+    refresh_jelly_cache();
+  }
 }
 
 HumanoidAvatarInterface::~HumanoidAvatarInterface() {
@@ -849,10 +1214,29 @@ HumanoidAvatarInterface::~HumanoidAvatarInterface() {
 
 void HumanoidAvatarInterface::sense_11d_signals(
     const std::vector<Signal11D> &signals) {
+  if (sensor_ring) {
+    for (const auto &signal : signals) {
+      push_sensor_signal(signal);
+    }
+    return;
+  }
+
   triad_state.sensory_inputs = signals;
   integrate_sensory_inputs();
 }
 
+bool HumanoidAvatarInterface::push_sensor_signal(const Signal11D &signal) {
+  if (!sensor_ring)
+    return false;
+
+  push_scratch = signal;
+  if (!sensor_ring->try_push(push_scratch)) {
+    dropped_signals.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
 Signal11D HumanoidAvatarInterface::get_integrated_signal() const {
   return fuse_signals(triad_state.sensory_inputs);
 }
@@ -864,12 +1248,68 @@ void HumanoidAvatarInterface::process_sensor_triad() {
   update_cognitive_state();
 }
 
+void HumanoidAvatarInterface::realtime_step() {
+  if (!sensor_ring)
+    return;
+
+  auto start = std::chrono::steady_clock::now();
+
+  // Drain queued signals; with none queued the last batch is held
+  size_t count = 0;
+  while (count < signal_batch.size() &&
+         sensor_ring->try_pop(signal_batch[count])) {
+    count++;
+  }
+  if (count > 0) {
+    signal_batch.resize(count);
+    signal_batch.swap(triad_state.sensory_inputs);
+    signal_batch.resize(config.max_signals_per_step); // Within capacity
+  }
+
+  if (target_buffer->get_version() != target_version) {
+    target_version = target_buffer->read(motor_targets.data());
+  }
+
+  process_sensor_triad();
+  motor_buffer->publish(triad_state.motor_outputs.data(),
+                        triad_state.motor_outputs.size());
+  const float summary[3] = {triad_state.sensory_integration,
+                            triad_state.motor_coordination,
+                            triad_state.consciousness_level};
+  triad_buffer->publish(summary, 3);
+
+  step_latency->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count());
+}
+
 std::vector<float> HumanoidAvatarInterface::get_motor_commands() const {
+  if (motor_buffer) {
+    std::vector<float> commands(motor_buffer->size());
+    motor_buffer->read(commands.data());
+    return commands;
+  }
   return triad_state.motor_outputs;
 }
 
+void HumanoidAvatarInterface::read_motor_commands(
+    std::vector<float> &out) const {
+  if (motor_buffer) {
+    out.resize(motor_buffer->size());
+    motor_buffer->read(out.data());
+  } else {
+    out.assign(triad_state.motor_outputs.begin(),
+               triad_state.motor_outputs.end());
+  }
+}
+
 void HumanoidAvatarInterface::set_motor_targets(
     const std::vector<float> &targets) {
+  if (target_buffer) {
+    target_buffer->publish(targets.data(), targets.size());
+    return;
+  }
+
   motor_targets = targets;
   if (motor_targets.size() != static_cast<size_t>(config.motor_count)) {
     motor_targets.resize(config.motor_count, 0.0f);
@@ -881,6 +1321,12 @@ NanoBrainTensor *HumanoidAvatarInterface::get_neural_output() {
 }
 
 void HumanoidAvatarInterface::update_neural_state(float delta_time) {
+  // The real-time thread owns the triad; only refresh what it reads
+  if (sensor_ring) {
+    refresh_jelly_cache();
+    return;
+  }
+
   // Update based on triad state
   process_sensor_triad();
 
@@ -893,23 +1339,54 @@ void HumanoidAvatarInterface::update_neural_state(float delta_time) {
 
 AvatarMetrics HumanoidAvatarInterface::get_metrics() const {
   AvatarMetrics metrics;
+  float summary[3];
+  read_triad_summary(summary);
 
-  metrics.sensory_bandwidth = triad_state.sensory_integration;
-  metrics.motor_precision = triad_state.motor_coordination;
+  metrics.sensory_bandwidth = summary[0];
+  metrics.motor_precision = summary[1];
   metrics.cognitive_load = 0.5f; // Placeholder
-  metrics.embodiment_index = get_embodiment_index();
+  metrics.embodiment_index = (summary[0] + summary[1] + summary[2]) / 3.0f;
   metrics.temporal_coherence = 0.8f; // Placeholder
 
+  if (step_latency) {
+    metrics.latency_p50_us = step_latency->percentile(0.50) / 1000.0f;
+    metrics.latency_p99_us = step_latency->percentile(0.99) / 1000.0f;
+    metrics.latency_max_us = step_latency->max() / 1000.0f;
+    metrics.realtime_steps = step_latency->count();
+    metrics.dropped_signals = dropped_signals.load(std::memory_order_relaxed);
+  }
+
   return metrics;
 }
 
+void HumanoidAvatarInterface::refresh_jelly_cache() {
+  if (!brain_jelly)
+    return;
+
+  cached_resonance.store(brain_jelly->get_total_resonance(),
+                         std::memory_order_relaxed);
+  cached_consciousness.store(brain_jelly->get_consciousness_index(),
+                             std::memory_order_relaxed);
+}
+
+void HumanoidAvatarInterface::read_triad_summary(float summary[3]) const {
+  // In real-time mode the control thread owns triad_state
+  if (triad_buffer) {
+    triad_buffer->read(summary);
+    return;
+  }
+
+  summary[0] = triad_state.sensory_integration;
+  summary[1] = triad_state.motor_coordination;
+  summary[2] = triad_state.consciousness_level;
+}
+
 float HumanoidAvatarInterface::get_embodiment_index() const {
   // Combine sensory, motor, and cognitive factors
-  float sensory = triad_state.sensory_integration;
-  float motor = triad_state.motor_coordination;
-  float consciousness = triad_state.consciousness_level;
+  float summary[3];
+  read_triad_summary(summary);
 
-  return (sensory + motor + consciousness) / 3.0f;
+  return (summary[0] + summary[1] + summary[2]) / 3.0f;
 }
 
 void HumanoidAvatarInterface::integrate_sensory_inputs() {
@@ -932,7 +1409,10 @@ void HumanoidAvatarInterface::process_jelly_layer() {
   if (!brain_jelly)
     return;
 
-  triad_state.jelly_resonance = brain_jelly->get_total_resonance();
+  // Real-time steps use the cache instead of re-scanning the chain
+  triad_state.jelly_resonance =
+      sensor_ring ? cached_resonance.load(std::memory_order_relaxed)
+                  : brain_jelly->get_total_resonance();
 
   // Update jelly currents based on sensory integration
   for (size_t i = 0; i < triad_state.jelly_currents.size(); ++i) {
@@ -971,7 +1451,9 @@ void HumanoidAvatarInterface::compute_motor_outputs() {
 
 void HumanoidAvatarInterface::update_cognitive_state() {
   if (brain_jelly) {
-    triad_state.consciousness_level = brain_jelly->get_consciousness_index();
+    triad_state.consciousness_level =
+        sensor_ring ? cached_consciousness.load(std::memory_order_relaxed)
+                    : brain_jelly->get_consciousness_index();
   }
 
   // cognitive_state tensor would be updated here
@@ -984,7 +1466,8 @@ Signal11D HumanoidAvatarInterface::fuse_signals(
   fused.dimensions.fill(0.0f);
   fused.signal_strength = 0.0f;
   fused.timestamp = 0;
-  fused.source_sensor = "fused";
+  static const Symbol fused_sensor("fused");
+  fused.source_sensor = fused_sensor;
 
   if (signals.empty())
     return fused;
@@ -1029,24 +1512,56 @@ void IntegratedBrainJellySystem::initialize() {
   if (active)
     return;
 
-  // Create all subsystems
-  device_registry = std::make_unique<BioMorphicDeviceRegistry>(
-      kernel, config.registry_config);
-  device_registry->initialize_full_registry();
+  active = true;
 
-  condensation_engine =
-      std::make_unique<FractalCondensation>(kernel, config.condensation_config);
+  // Lazy systems build each subsystem on first use
+  if (!config.lazy_subsystems) {
+    get_device_registry();
+    get_condensation_engine();
+    get_pen_freezer();
+    get_avatar_interface();
+  }
+}
 
-  brain_jelly =
-      std::make_unique<BrainJellySimulator>(kernel, config.jelly_config);
+BioMorphicDeviceRegistry *IntegratedBrainJellySystem::get_device_registry() {
+  if (!device_registry && active) {
+    device_registry = std::make_unique<BioMorphicDeviceRegistry>(
+        kernel, config.registry_config);
+    device_registry->initialize_full_registry();
+  }
+  return device_registry.get();
+}
 
-  pen_freezer = std::make_unique<CorticalPenFreezer>(kernel, time_crystal,
-                                                     config.pen_config);
+FractalCondensation *IntegratedBrainJellySystem::get_condensation_engine() {
+  if (!condensation_engine && active) {
+    condensation_engine = std::make_unique<FractalCondensation>(
+        kernel, config.condensation_config);
+  }
+  return condensation_engine.get();
+}
 
-  avatar_interface = std::make_unique<HumanoidAvatarInterface>(
-      kernel, time_crystal, brain_jelly.get(), config.avatar_config);
+BrainJellySimulator *IntegratedBrainJellySystem::get_brain_jelly() {
+  if (!brain_jelly && active) {
+    brain_jelly =
+        std::make_unique<BrainJellySimulator>(kernel, config.jelly_config);
+  }
+  return brain_jelly.get();
+}
 
-  active = true;
+CorticalPenFreezer *IntegratedBrainJellySystem::get_pen_freezer() {
+  if (!pen_freezer && active) {
+    pen_freezer = std::make_unique<CorticalPenFreezer>(kernel, time_crystal,
+                                                       config.pen_config);
+  }
+  return pen_freezer.get();
+}
+
+HumanoidAvatarInterface *IntegratedBrainJellySystem::get_avatar_interface() {
+  if (!avatar_interface && active) {
+    avatar_interface = std::make_unique<HumanoidAvatarInterface>(
+        kernel, time_crystal, get_brain_jelly(), config.avatar_config);
+  }
+  return avatar_interface.get();
 }
 
 void IntegratedBrainJellySystem::shutdown() {
@@ -1068,19 +1583,13 @@ void IntegratedBrainJellySystem::process_cycle(float delta_time) {
 
   current_time += delta_time;
 
-  // Update all subsystems
-  if (device_registry) {
-    device_registry->update_all_devices(delta_time);
-    device_registry->propagate_signals();
-  }
+  // Update the cycled subsystems (created here on the first cycle)
+  BioMorphicDeviceRegistry *registry = get_device_registry();
+  registry->update_all_devices(delta_time);
+  registry->propagate_signals();
 
-  if (brain_jelly) {
-    brain_jelly->update_chain(delta_time);
-  }
-
-  if (avatar_interface) {
-    avatar_interface->update_neural_state(delta_time);
-  }
+  get_brain_jelly()->update_chain(delta_time);
+  get_avatar_interface()->update_neural_state(delta_time);
 }
 
 BrainJellyMetrics IntegratedBrainJellySystem::get_metrics() const {
@@ -1109,6 +1618,7 @@ BrainJellyMetrics IntegratedBrainJellySystem::get_metrics() const {
   if (pen_freezer) {
     metrics.frozen_capsules = pen_freezer->capsule_count();
     metrics.average_complexity = 5.0f; // Placeholder
+    metrics.capsule_store = pen_freezer->get_store_stats();
   }
 
   if (avatar_interface) {
@@ -11,16 +11,24 @@
  * - 17 Bio-morphic device types with inter-device communication
  * - Fractal condensation engine for multi-point condensation
  * - Brain jelly simulator with EEG signal generation
- * - Cortical pen freezer for dynamics→time crystal conversion
+ * - Cortical pen freezer for dynamics→time crystal conversion, with
+ *   cold capsules spilled to an mmap'd segment file
  * - Humanoid avatar interface with 11D signal sensing
  */
 
+#include "nanobrain_capsule_store.h"
 #include "nanobrain_kernel.h"
+#include "nanobrain_realtime.h"
+#include "nanobrain_symbol.h"
 #include "nanobrain_time_crystal.h"
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -177,6 +185,25 @@ struct FractalCondensationConfig {
   float spatial_resolution = 0.01f; // Resolution in 11D space
   float prime_threshold = 0.3f;     // Minimum prime alignment
   bool enable_everywhere = true;    // Condense at all points
+
+  // Point search is seeded per (seed, call, sample), so fields are
+  // reproducible regardless of thread count
+  uint64_t seed = 0x6A09E667F3BCC909ull;
+  NanoBrainThreadPool *thread_pool = nullptr; // Search/evaluation workers
+                                              // (not owned; nullptr =
+                                              // serial)
+  size_t parallel_grain = 4096; // Minimum work items per chunk
+};
+
+/**
+ * Structure-of-arrays copy of condensation point positions and strengths
+ * used by the batched field kernel
+ */
+struct CondensationPointStore {
+  std::array<std::vector<float>, 11> coords; // coords[d][i]
+  std::vector<float> strength;
+
+  size_t size() const { return strength.size(); }
 };
 
 /**
@@ -244,6 +271,9 @@ struct BrainJellyConfig {
 
 /**
  * Problem capsule containing frozen dynamics
+ *
+ * frozen_state is null while the capsule is spilled to disk; the
+ * non-const CorticalPenFreezer::get_capsule faults it back in.
  */
 struct ProblemCapsule {
   std::string id;
@@ -262,6 +292,33 @@ struct CorticalPenConfig {
   float freeze_threshold = 0.7f;
   bool preserve_dynamics = true;
   int time_crystal_resolution = 11;
+
+  // Tiered storage: at most resident_capsules frozen states stay in the
+  // ggml context, and the least recently used ones spill to a segment
+  // file (0 = keep every capsule resident)
+  int resident_capsules = 0;
+  std::string spill_path; // Segment file (empty = unlinked temporary)
+};
+
+/**
+ * Capsule tier occupancy and thaw latency
+ */
+struct CapsuleStoreStats {
+  size_t resident_capsules = 0;
+  size_t spilled_capsules = 0;
+  size_t resident_bytes = 0;       // ggml bytes held by frozen states
+  size_t memory_ceiling_bytes = 0; // Bound on resident_bytes unless spills
+                                   // fail (0 = none)
+  size_t spill_file_bytes = 0;
+  uint64_t evictions = 0;      // States written out to the segment file
+  uint64_t faults = 0;         // States read back from it
+  uint64_t spill_failures = 0; // Spills refused; the state stayed resident
+
+  // thaw_capsule latency, including any fault-in
+  uint64_t thaws = 0;
+  float thaw_p50_us = 0.0f;
+  float thaw_p99_us = 0.0f;
+  float thaw_max_us = 0.0f;
 };
 
 // ================================================================
@@ -275,7 +332,7 @@ struct Signal11D {
   std::array<float, 11> dimensions;
   float signal_strength;
   int64_t timestamp;
-  std::string source_sensor;
+  Symbol source_sensor; // Interned: a fixed set of sensors, copied by pointer
 };
 
 /**
@@ -308,6 +365,12 @@ struct HumanoidAvatarConfig {
   bool enable_11d_sensing = true;
   float response_latency = 0.01f; // seconds
   bool enable_time_crystal_net = true;
+
+  // Real-time loop (HumanoidAvatarInterface::realtime_step)
+  bool realtime = false;
+  size_t sensor_ring_capacity = 1024; // Signals queued between steps
+  size_t max_signals_per_step = 256;  // Signals drained per step
+  size_t latency_buckets = 4096;      // 1 us latency histogram buckets
 };
 
 /**
@@ -319,6 +382,13 @@ struct AvatarMetrics {
   float cognitive_load;
   float embodiment_index;
   float temporal_coherence;
+
+  // Real-time loop step latency (zero outside real-time mode)
+  float latency_p50_us = 0.0f;
+  float latency_p99_us = 0.0f;
+  float latency_max_us = 0.0f;
+  uint64_t realtime_steps = 0;
+  uint64_t dropped_signals = 0; // Pushed while the sensor ring was full
 };
 
 // ================================================================
@@ -401,6 +471,18 @@ public:
   CondensationField compute_field();
   float get_field_value(const std::array<float, 11> &position);
 
+  // Batched field evaluation: out[i] = field at positions[i]
+  void get_field_values(const std::array<float, 11> *positions, size_t count,
+                        float *out);
+  std::vector<float>
+  get_field_values(const std::vector<std::array<float, 11>> &positions);
+
+  // Replace FractalCondensationConfig::thread_pool (nullptr = serial);
+  // results do not change. The pool must outlive the condensation.
+  void set_thread_pool(NanoBrainThreadPool *pool) {
+    config.thread_pool = pool;
+  }
+
   // Prime pattern operations
   void set_prime_pattern(const std::vector<int> &primes);
   std::vector<int> get_current_pattern() const { return current_pattern; }
@@ -412,6 +494,12 @@ private:
   std::vector<CondensationPoint> active_points;
   std::vector<int> current_pattern;
   CondensationField field;
+  CondensationPointStore point_store;
+  bool point_store_dirty = true;
+  uint64_t condense_calls = 0;
+
+  const CondensationPointStore &get_point_store();
+  size_t worker_count(size_t items) const;
 
   CondensationPoint
   find_condensation_point(const std::array<float, 11> &seed_position);
@@ -470,6 +558,14 @@ private:
 /**
  * Freezes cognitive dynamics into time crystal structures,
  * creating problem capsules for later retrieval
+ *
+ * Capsule metadata (signature, anchor, related atoms) always stays in
+ * memory; only frozen states are tiered. Frozen states live in a pool of
+ * ggml tensors that is recycled as capsules are deleted or evicted. With
+ * CorticalPenConfig::resident_capsules set, the pool is capped, and
+ * freezing or faulting in past the cap spills the least recently used
+ * state to a CapsuleSegmentFile. Signature lookups go through an index and
+ * never fault anything in.
  */
 class CorticalPenFreezer {
 public:
@@ -477,31 +573,79 @@ public:
                      const CorticalPenConfig &config);
   ~CorticalPenFreezer();
 
-  // Freezing operations
+  // Freezing operations. freeze_dynamics returns the capsule id, or "" if
+  // there is no state or no slot to keep it in (context full, no spill file)
   std::string freeze_dynamics(NanoBrainTensor *current_state,
                               const std::vector<std::string> &related_atoms);
   ProblemCapsule *create_problem_capsule(const std::string &problem_id);
 
-  // Capsule management
+  // Capsule management. The non-const get_capsule faults a spilled state
+  // back in and marks it recently used; its frozen_state stays valid until
+  // the capsule is evicted again. The const one only reads metadata.
   ProblemCapsule *get_capsule(const std::string &id);
   const ProblemCapsule *get_capsule(const std::string &id) const;
   bool delete_capsule(const std::string &id);
   std::vector<std::string> get_all_capsule_ids() const;
   size_t capsule_count() const { return capsules.size(); }
 
-  // Retrieval
-  NanoBrainTensor *thaw_capsule(const std::string &id);
+  // Retrieval: thaw_capsule copies the frozen state into destination,
+  // which must hold at least state_size() floats, faulting it in first if
+  // it was spilled. Nothing is allocated from the context.
+  bool thaw_capsule(const std::string &id, NanoBrainTensor *destination);
+  size_t state_size() const { return state_floats(); }
   std::vector<int> get_capsule_signature(const std::string &id) const;
+  std::vector<std::string>
+  find_capsules_by_signature(const std::vector<int> &signature) const;
+
+  // Tiering
+  bool is_resident(const std::string &id) const;
+  CapsuleStoreStats get_store_stats() const;
 
 private:
+  using SignatureIndex = std::map<std::vector<int>, std::set<std::string>>;
+
+  struct CapsuleEntry {
+    std::unique_ptr<ProblemCapsule> capsule;
+    int slot = -1;       // Pool slot holding frozen_state (-1 = spilled)
+    int64_t record = -1; // Segment record holding the spilled state
+    std::list<std::string>::iterator lru; // Valid while resident
+    SignatureIndex::iterator signature;   // Index entry (frozen signature)
+  };
+
   NanoBrainKernel *kernel;
   TimeCrystalKernel *time_crystal;
   CorticalPenConfig config;
-  std::map<std::string, std::unique_ptr<ProblemCapsule>> capsules;
+  std::map<std::string, CapsuleEntry> capsules;
+  SignatureIndex signature_index;
   int capsule_counter = 0;
 
+  // Hot tier: pooled frozen-state tensors, and resident capsule ids with
+  // the most recently used first
+  std::vector<NanoBrainTensor *> slots;
+  std::vector<int> free_slots;
+  std::list<std::string> lru_order;
+
+  // Cold tier
+  CapsuleSegmentFile segment;
+  std::vector<float> transfer_buffer;
+  uint64_t evictions = 0;
+  uint64_t faults = 0;
+  uint64_t spill_failures = 0;
+  LatencyHistogram thaw_latency{4096, 1000};
+
+  CapsuleEntry *insert_capsule(std::unique_ptr<ProblemCapsule> capsule,
+                               int slot);
+  void erase_entry(std::map<std::string, CapsuleEntry>::iterator it);
+  int acquire_slot();
+  int new_slot();
+  bool make_resident(CapsuleEntry &entry);
+  bool evict_lru();
+  void touch(CapsuleEntry &entry);
+  size_t state_floats() const;
+
   std::vector<int> compute_signature(NanoBrainTensor *state);
-  NanoBrainTensor *encode_to_time_crystal(NanoBrainTensor *dynamics);
+  void encode_to_time_crystal(NanoBrainTensor *dynamics,
+                              NanoBrainTensor *encoded);
 };
 
 // ================================================================
@@ -511,6 +655,18 @@ private:
 /**
  * Interface for humanoid avatar with 11D signal sensing
  * and sensor-jelly-muscle-brain triad processing
+ *
+ * With HumanoidAvatarConfig::realtime, a control thread calls
+ * realtime_step() at its loop rate and owns the triad state. Sensors feed
+ * it through a lock-free SPSC ring (push_sensor_signal or
+ * sense_11d_signals, from one thread), motor commands and targets cross
+ * threads through double buffers, and the jelly layer reads a resonance
+ * cache that update_neural_state() refreshes from the simulation's own
+ * cycle. All buffers are sized up front and sensor names are interned
+ * Symbols, so steps do not allocate. get_metrics() and
+ * get_embodiment_index() read the triad summary the last step published;
+ * get_triad_state() and get_integrated_signal() belong to the control
+ * thread.
  */
 class HumanoidAvatarInterface {
 public:
@@ -520,16 +676,19 @@ public:
                           const HumanoidAvatarConfig &config);
   ~HumanoidAvatarInterface();
 
-  // Sensing
+  // Sensing (queued for the next step in real-time mode)
   void sense_11d_signals(const std::vector<Signal11D> &signals);
+  bool push_sensor_signal(const Signal11D &signal); // False if ring full
   Signal11D get_integrated_signal() const;
 
   // Triad processing
   void process_sensor_triad();
+  void realtime_step(); // One sensor -> motor step; real-time mode only
   SensorTriadState get_triad_state() const { return triad_state; }
 
   // Motor output
   std::vector<float> get_motor_commands() const;
+  void read_motor_commands(std::vector<float> &out) const; // Reuses out
   void set_motor_targets(const std::vector<float> &targets);
 
   // Neural network
@@ -549,6 +708,21 @@ private:
   std::vector<float> motor_targets;
   NanoBrainTensor *neural_state;
 
+  // Real-time mode (null/unused otherwise)
+  std::unique_ptr<SpscQueue<Signal11D>> sensor_ring;
+  std::unique_ptr<DoubleBuffer> motor_buffer;  // Step -> readers
+  std::unique_ptr<DoubleBuffer> target_buffer; // set_motor_targets -> step
+  std::unique_ptr<DoubleBuffer> triad_buffer;  // Step -> metrics readers
+  std::unique_ptr<LatencyHistogram> step_latency;
+  std::vector<Signal11D> signal_batch; // Drained ring, swapped into triad
+  Signal11D push_scratch;              // Producer-side copy for the ring
+  uint64_t target_version = 0;         // Last target_buffer version read
+  std::atomic<float> cached_resonance{0.0f};
+  std::atomic<float> cached_consciousness{0.0f};
+  std::atomic<uint64_t> dropped_signals{0};
+
+  void refresh_jelly_cache();
+  void read_triad_summary(float summary[3]) const; // Sensory, motor, mind
   void integrate_sensory_inputs();
   void process_jelly_layer();
   void compute_motor_outputs();
@@ -569,6 +743,10 @@ struct IntegratedBrainJellyConfig {
   BrainJellyConfig jelly_config;
   CorticalPenConfig pen_config;
   HumanoidAvatarConfig avatar_config;
+
+  // Create subsystems on first use (the accessors, or process_cycle for
+  // the devices, jelly and avatar) instead of in initialize()
+  bool lazy_subsystems = true;
 };
 
 /**
@@ -593,6 +771,7 @@ struct BrainJellyMetrics {
   // Capsule metrics
   size_t frozen_capsules;
   float average_complexity;
+  CapsuleStoreStats capsule_store;
 
   // Avatar metrics
   float embodiment_index;
@@ -619,20 +798,15 @@ public:
   // Processing
   void process_cycle(float delta_time);
 
-  // Component access
-  BioMorphicDeviceRegistry *get_device_registry() {
-    return device_registry.get();
-  }
-  FractalCondensation *get_condensation_engine() {
-    return condensation_engine.get();
-  }
-  BrainJellySimulator *get_brain_jelly() { return brain_jelly.get(); }
-  CorticalPenFreezer *get_pen_freezer() { return pen_freezer.get(); }
-  HumanoidAvatarInterface *get_avatar_interface() {
-    return avatar_interface.get();
-  }
+  // Component access; creates the subsystem on first use (nullptr until
+  // initialize())
+  BioMorphicDeviceRegistry *get_device_registry();
+  FractalCondensation *get_condensation_engine();
+  BrainJellySimulator *get_brain_jelly();
+  CorticalPenFreezer *get_pen_freezer();
+  HumanoidAvatarInterface *get_avatar_interface();
 
-  // Metrics
+  // Metrics of the subsystems created so far
   BrainJellyMetrics get_metrics() const;
 
 private:
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 
@@ -14,6 +15,22 @@
 // Helper Functions
 // ================================================================
 
+// PPM coherence of a prime sequence; the product is taken in double, where
+// it stays exact for the sensory sequences
+static float prime_sequence_coherence(const std::vector<int> &primes) {
+  if (primes.empty())
+    return 0.5f;
+
+  double prime_product = 1.0;
+  double prime_sum = 0.0;
+  for (int p : primes) {
+    prime_product *= p;
+    prime_sum += p;
+  }
+  return static_cast<float>(
+      0.5 + 0.5 * std::sin(std::sqrt(prime_product) * M_PI / prime_sum));
+}
+
 static int64_t get_current_time_millis() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(
              std::chrono::system_clock::now().time_since_epoch())
@@ -80,6 +97,10 @@ void SensoryPrimeMapper::setup_prime_assignments() {
   mappings[4].gml_shape_index = 4;           // Octahedron
   mappings[4].encoding_tensor = kernel->create_tensor({128});
   mappings[4].integration_tensor = kernel->create_tensor({64});
+
+  for (auto &mapping : mappings) {
+    mapping.coherence = prime_sequence_coherence(mapping.prime_sequence);
+  }
 }
 
 NanoBrainTensor *SensoryPrimeMapper::map_input(SensoryModality modality,
@@ -88,23 +109,12 @@ NanoBrainTensor *SensoryPrimeMapper::map_input(SensoryModality modality,
   if (idx < 0 || idx >= 5 || !input)
     return nullptr;
 
-  return apply_prime_encoding(input, mappings[idx].prime_sequence);
+  return apply_prime_encoding(input, mappings[idx].coherence);
 }
 
 NanoBrainTensor *
 SensoryPrimeMapper::apply_prime_encoding(NanoBrainTensor *input,
-                                         const std::vector<int> &primes) {
-  // Compute PPM-based coherence from primes
-  float prime_product = 1.0f;
-  float prime_sum = 0.0f;
-  for (int p : primes) {
-    prime_product *= static_cast<float>(p);
-    prime_sum += static_cast<float>(p);
-  }
-
-  float coherence =
-      0.5f + 0.5f * std::sin(std::sqrt(prime_product) * M_PI / prime_sum);
-
+                                         float coherence) {
   // Scale input by coherence
   auto *scaled = kernel->mul_scalar(input, coherence);
   kernel->compute(scaled);
@@ -140,11 +150,14 @@ CrossModalResult SensoryPrimeMapper::cross_modal_integrate(
     // Encode and add weighted contribution
     auto *encoded = map_input(modality, tensor);
     if (encoded) {
-      kernel->compute(encoded);
-      // Sum contribution (simplified - in production would do proper fusion)
-      for (size_t i = 0; i < result.integrated_features.size(); i++) {
-        result.integrated_features[i] +=
-            weight * kernel->get_value(encoded, i % 128);
+      // Sum contribution (simplified - fuse_stream does proper fusion)
+      const float *data =
+          static_cast<const float *>(encoded->ggml_tensor->data);
+      size_t count = std::min<size_t>(
+          128, static_cast<size_t>(ggml_nelements(encoded->ggml_tensor)));
+      for (size_t i = 0; count > 0 && i < result.integrated_features.size();
+           i++) {
+        result.integrated_features[i] += weight * data[i % count];
       }
     }
   }
@@ -162,6 +175,78 @@ CrossModalResult SensoryPrimeMapper::cross_modal_integrate(
   return result;
 }
 
+NanoBrainTensor *SensoryPrimeMapper::stack_modalities(
+    const std::vector<NanoBrainTensor *> &streams) {
+  if (streams.empty() || !streams[0] || !streams[0]->ggml_tensor)
+    return nullptr;
+
+  const struct ggml_tensor *first = streams[0]->ggml_tensor;
+  const int64_t dim = first->ne[0];
+  const int64_t steps = ggml_nelements(first) / dim;
+  const int64_t modalities = static_cast<int64_t>(streams.size());
+  for (auto *stream : streams) {
+    if (!stream || !stream->ggml_tensor ||
+        stream->ggml_tensor->type != GGML_TYPE_F32 ||
+        stream->ggml_tensor->ne[0] != dim ||
+        ggml_nelements(stream->ggml_tensor) != dim * steps)
+      return nullptr;
+  }
+
+  auto *stacked = kernel->create_tensor({dim, modalities, steps},
+                                        TensorInitPolicy::uninitialized());
+  if (!stacked)
+    return nullptr;
+
+  // Row t of modality m goes to slot (t, m)
+  float *out = static_cast<float *>(stacked->ggml_tensor->data);
+  for (int64_t m = 0; m < modalities; m++) {
+    const float *in =
+        static_cast<const float *>(streams[m]->ggml_tensor->data);
+    for (int64_t t = 0; t < steps; t++) {
+      std::memcpy(out + (t * modalities + m) * dim, in + t * dim,
+                  dim * sizeof(float));
+    }
+  }
+  return stacked;
+}
+
+NanoBrainTensor *
+SensoryPrimeMapper::fuse_stream(NanoBrainTensor *stream,
+                                const std::vector<SensoryModality> &order) {
+  if (!stream || !stream->ggml_tensor ||
+      stream->ggml_tensor->ne[1] != static_cast<int64_t>(order.size()))
+    return nullptr;
+
+  // Per-modality weights folded with the cached coherence, normalized by
+  // the total cross-modal weight as in cross_modal_integrate
+  std::vector<float> weights(order.size());
+  float total_weight = 0.0f;
+  for (size_t m = 0; m < order.size(); m++) {
+    int idx = static_cast<int>(order[m]);
+    if (idx < 0 || idx >= 5)
+      return nullptr;
+    weights[m] = mappings[idx].cross_modal_weight * mappings[idx].coherence;
+    total_weight += mappings[idx].cross_modal_weight;
+  }
+  if (total_weight > 0) {
+    for (float &w : weights) {
+      w /= total_weight;
+    }
+  }
+
+  // [D, M, T] -> [M, D, T], then contract the modalities against the
+  // weights in one mul_mat: [1, D, T]
+  auto *by_modality = kernel->transpose(stream);
+  auto *weight_tensor = kernel->create_tensor_from(weights);
+  if (!by_modality || !weight_tensor)
+    return nullptr;
+  auto *fused = kernel->matmul(weight_tensor, by_modality);
+  if (!fused)
+    return nullptr;
+  kernel->compute(fused);
+  return fused;
+}
+
 float SensoryPrimeMapper::calculate_cross_resonance(SensoryModality a,
                                                     SensoryModality b) const {
   int idx_a = static_cast<int>(a);
@@ -402,8 +487,9 @@ NanoBrainTensor *H3DecisionDevice::layer_forward(int layer_idx,
   if (layer_idx < 0 || layer_idx >= 3 || !input)
     return nullptr;
 
+  // weights are [in, out]: mul_mat contracts over ne0, giving [out]
   auto &layer = layers[layer_idx];
-  auto *output = kernel->matmul(input, layer.weights);
+  auto *output = kernel->matmul(layer.weights, input);
   output = kernel->add(output, layer.bias);
   output = kernel->softmax(output);
   kernel->compute(output);
@@ -478,15 +564,144 @@ H3DecisionResult H3DecisionDevice::decide(NanoBrainTensor *input) {
   return result;
 }
 
+std::vector<H3DecisionResult>
+H3DecisionDevice::decide_batch(NanoBrainTensor *inputs) {
+  if (!inputs || !inputs->ggml_tensor ||
+      inputs->ggml_tensor->type != GGML_TYPE_F32 ||
+      inputs->ggml_tensor->ne[0] != input_dim)
+    return {};
+
+  size_t batch = static_cast<size_t>(ggml_nelements(inputs->ggml_tensor)) /
+                 static_cast<size_t>(input_dim);
+  return decide_batch(static_cast<const float *>(inputs->ggml_tensor->data),
+                      batch);
+}
+
+std::vector<H3DecisionResult>
+H3DecisionDevice::decide_batch(const float *inputs, size_t batch) {
+  if (!inputs || batch == 0)
+    return {};
+  BatchGraph *graph = prepare_batch_graph(batch);
+  if (!graph)
+    return {};
+
+  // Rows past batch keep whatever an earlier batch left there
+  std::memcpy(graph->input->ggml_tensor->data, inputs,
+              batch * input_dim * sizeof(float));
+  kernel->compute_graph(graph->graph);
+  return run_batch_graph(*graph, batch);
+}
+
+H3DecisionDevice::BatchGraph *
+H3DecisionDevice::prepare_batch_graph(size_t batch) {
+  size_t capacity = 1;
+  while (capacity < batch)
+    capacity *= 2;
+
+  auto it = batch_graphs.find(capacity);
+  if (it != batch_graphs.end())
+    return &it->second;
+
+  // Graphs stay cached (ggml contexts only grow); together they take at
+  // most twice the largest one
+  BatchGraph graph;
+  graph.capacity = capacity;
+
+  // One input row per situation; each layer maps [in, B] to [out, B] and
+  // softmax normalizes every row
+  NanoBrainTensor *x =
+      kernel->create_tensor({input_dim, static_cast<int64_t>(capacity)},
+                            TensorInitPolicy::zero());
+  if (!x)
+    return nullptr;
+  graph.input = x;
+
+  for (int l = 0; l < 3; l++) {
+    x = kernel->matmul(layers[l].weights, x);
+    x = x ? kernel->add(x, layers[l].bias) : nullptr;
+    x = x ? kernel->softmax(x) : nullptr;
+    if (!x)
+      return nullptr;
+    graph.outputs[l] = x;
+  }
+
+  graph.graph = kernel->build_graph(x);
+  if (!graph.graph)
+    return nullptr;
+  return &batch_graphs.emplace(capacity, graph).first->second;
+}
+
+std::vector<H3DecisionResult>
+H3DecisionDevice::run_batch_graph(const BatchGraph &graph, size_t batch) {
+  const size_t actions = static_cast<size_t>(action_count);
+  std::vector<H3DecisionResult> results(batch);
+
+  // Votes: probabilities[b] = sum over layers of weight * first actions of
+  // the layer's row b
+  std::vector<float> votes(batch * actions, 0.0f);
+  for (int l = 0; l < 3; l++) {
+    const struct ggml_tensor *out = graph.outputs[l]->ggml_tensor;
+    const float *rows = static_cast<const float *>(out->data);
+    const size_t width = static_cast<size_t>(out->ne[0]);
+    const size_t used = std::min(actions, width);
+    const float weight = kernel->get_value(voting_weights, l);
+
+    for (size_t b = 0; b < batch; b++) {
+      const float *row = rows + b * width;
+      float *vote_row = votes.data() + b * actions;
+      float max_val = 0.0f;
+      for (size_t a = 0; a < used; a++) {
+        vote_row[a] += weight * row[a];
+        max_val = std::max(max_val, row[a]);
+      }
+      results[b].layer_contributions[l] = max_val;
+    }
+  }
+
+  const float threshold = layers[2].confidence_threshold;
+  for (size_t b = 0; b < batch; b++) {
+    H3DecisionResult &result = results[b];
+    const float *vote_row = votes.data() + b * actions;
+    result.action_probabilities.assign(vote_row, vote_row + actions);
+
+    // Find best action
+    result.selected_action = 0;
+    float max_prob = 0.0f;
+    for (size_t a = 0; a < actions; a++) {
+      if (vote_row[a] > max_prob) {
+        max_prob = vote_row[a];
+        result.selected_action = static_cast<int>(a);
+      }
+    }
+    result.confidence = max_prob;
+    result.consensus_reached = max_prob > threshold;
+  }
+
+  for (int l = 0; l < 3; l++) {
+    layers[l].activation = graph.outputs[l];
+  }
+  return results;
+}
+
 void H3DecisionDevice::update_weights(int layer_idx, NanoBrainTensor *gradient,
                                       float learning_rate) {
   if (layer_idx < 0 || layer_idx >= 3 || !gradient)
     return;
 
-  auto *scaled_grad = kernel->mul_scalar(gradient, -learning_rate);
-  layers[layer_idx].weights =
-      kernel->add(layers[layer_idx].weights, scaled_grad);
-  kernel->compute(layers[layer_idx].weights);
+  // In place: a new weights tensor would allocate graph nodes on every
+  // update and invalidate the batch graph
+  struct ggml_tensor *weights = layers[layer_idx].weights->ggml_tensor;
+  const struct ggml_tensor *grad = gradient->ggml_tensor;
+  if (grad->type != GGML_TYPE_F32 ||
+      ggml_nelements(grad) != ggml_nelements(weights))
+    return;
+
+  float *w = static_cast<float *>(weights->data);
+  const float *g = static_cast<const float *>(grad->data);
+  const int64_t count = ggml_nelements(weights);
+  for (int64_t i = 0; i < count; i++) {
+    w[i] -= learning_rate * g[i];
+  }
 }
 
 const DecisionLayer *H3DecisionDevice::get_layer(int idx) const {
@@ -565,7 +780,7 @@ NanoBrainTensor *CerebellumSimulator::coordinate(
     return output_tensor;
 
   std::vector<float> output(64, 0.0f);
-  for (const auto *signal : motor_signals) {
+  for (auto *signal : motor_signals) {
     if (signal) {
       kernel->compute(signal);
       for (int i = 0; i < 64; i++) {
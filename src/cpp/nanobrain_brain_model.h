@@ -39,6 +39,7 @@ struct SensoryPrimeMapping {
   SensoryModality modality;
   std::vector<int> prime_sequence;
   float cross_modal_weight;
+  float coherence; // PPM coherence of prime_sequence, cached at setup
   NanoBrainTensor *encoding_tensor;
   NanoBrainTensor *integration_tensor;
   float resonance_frequency;
@@ -75,6 +76,20 @@ public:
   CrossModalResult cross_modal_integrate(
       const std::map<SensoryModality, NanoBrainTensor *> &inputs);
 
+  // Stack per-modality streams of T timesteps (ne0 = D, ne1 = T each, all
+  // the same shape) into one [T x modalities x D] tensor (ne0 = D,
+  // ne1 = modalities, ne2 = T)
+  NanoBrainTensor *
+  stack_modalities(const std::vector<NanoBrainTensor *> &streams);
+
+  // Batched fusion: the coherence-weighted mean over modalities of every
+  // timestep of a [T x modalities x D] stream, as one matmul against the
+  // modality weights. order names the modality of each ne1 slot. Returns
+  // the computed [T x D] result (ne0 = 1, ne1 = D, ne2 = T), or nullptr
+  // if the shapes do not match.
+  NanoBrainTensor *fuse_stream(NanoBrainTensor *stream,
+                               const std::vector<SensoryModality> &order);
+
   // Calculate resonance between two modalities
   float calculate_cross_resonance(SensoryModality a, SensoryModality b) const;
 
@@ -87,7 +102,7 @@ private:
 
   void setup_prime_assignments();
   NanoBrainTensor *apply_prime_encoding(NanoBrainTensor *input,
-                                        const std::vector<int> &primes);
+                                        float coherence);
 };
 
 // ================================================================
@@ -234,6 +249,18 @@ public:
   // Forward pass through all layers
   H3DecisionResult decide(NanoBrainTensor *input);
 
+  // Decide for B situations at once. inputs holds one situation per row
+  // (ne0 = input_dim, ne1 = B). All three layers run as one persistent
+  // graph over the batch; the votes are reduced on the host in one pass.
+  // Same results as B decide() calls. Graphs are cached per power-of-two
+  // size and a batch runs on the smallest that holds it, so a small batch
+  // never pays for a larger one seen earlier.
+  std::vector<H3DecisionResult> decide_batch(NanoBrainTensor *inputs);
+
+  // Same, from B * input_dim host floats, row-major
+  std::vector<H3DecisionResult> decide_batch(const float *inputs,
+                                             size_t batch);
+
   // Forward through single layer
   NanoBrainTensor *layer_forward(int layer_idx, NanoBrainTensor *input);
 
@@ -241,7 +268,9 @@ public:
   std::vector<float>
   vote(const std::array<NanoBrainTensor *, 3> &layer_outputs);
 
-  // Update weights based on feedback
+  // Update weights based on feedback: weights -= learning_rate * gradient,
+  // in place, so graphs built on the weights stay valid. gradient must
+  // hold computed values of the weights' shape.
   void update_weights(int layer_idx, NanoBrainTensor *gradient,
                       float learning_rate);
 
@@ -258,7 +287,21 @@ private:
   std::array<DecisionLayer, 3> layers;
   NanoBrainTensor *voting_weights;
 
+  // Persistent batch graph: input leaf -> three layers, for up to
+  // capacity rows
+  struct BatchGraph {
+    size_t capacity = 0;
+    NanoBrainTensor *input = nullptr;
+    std::array<NanoBrainTensor *, 3> outputs{};
+    NanoBrainGraph *graph = nullptr;
+  };
+  std::map<size_t, BatchGraph> batch_graphs; // By power-of-two capacity
+
   void init_layer(int idx, int in_dim, int out_dim);
+  // Smallest cached graph for batch rows, built on first use
+  BatchGraph *prepare_batch_graph(size_t batch);
+  std::vector<H3DecisionResult> run_batch_graph(const BatchGraph &graph,
+                                                size_t batch);
 };
 
 // ================================================================
@@ -0,0 +1,147 @@
+#include "nanobrain_capsule_store.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t INITIAL_RECORDS = 64;
+
+} // namespace
+
+// ================================================================
+// CapsuleSegmentFile Implementation
+// ================================================================
+
+bool CapsuleSegmentFile::open(const std::string &path, size_t record_floats) {
+  close();
+  if (record_floats == 0)
+    return false;
+
+#if defined(__linux__)
+  if (path.empty()) {
+    const char *dir = std::getenv("TMPDIR");
+    std::string name = std::string(dir && *dir ? dir : "/tmp") +
+                       "/nanobrain_capsules_XXXXXX";
+    std::vector<char> buffer(name.begin(), name.end());
+    buffer.push_back('\0');
+    fd = mkstemp(buffer.data());
+    if (fd >= 0)
+      unlink(buffer.data());
+  } else {
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  }
+  if (fd < 0) {
+    std::cerr << "[CapsuleSegmentFile] Cannot open "
+              << (path.empty() ? "temporary segment" : path) << ": "
+              << std::strerror(errno) << std::endl;
+    return false;
+  }
+#else
+  (void)path;
+#endif
+
+  floats_per_record = record_floats;
+  if (!grow(INITIAL_RECORDS)) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void CapsuleSegmentFile::close() {
+#if defined(__linux__)
+  if (records)
+    munmap(records, file_bytes());
+  if (fd >= 0)
+    ::close(fd);
+#endif
+  fd = -1;
+  records = nullptr;
+  heap.clear();
+  heap.shrink_to_fit();
+  floats_per_record = 0;
+  capacity = 0;
+  next_record = 0;
+  free_records.clear();
+  released.clear();
+}
+
+int64_t CapsuleSegmentFile::allocate() {
+  if (!is_open())
+    return -1;
+  if (!free_records.empty()) {
+    int64_t record = free_records.back();
+    free_records.pop_back();
+    released[record] = 0;
+    return record;
+  }
+  if (next_record == capacity && !grow(capacity * 2))
+    return -1;
+  released.push_back(0);
+  return static_cast<int64_t>(next_record++);
+}
+
+bool CapsuleSegmentFile::release(int64_t record) {
+  if (!valid(record))
+    return false;
+  released[record] = 1;
+  free_records.push_back(record);
+  return true;
+}
+
+bool CapsuleSegmentFile::write(int64_t record, const float *data) {
+  if (!valid(record) || !data)
+    return false;
+  std::memcpy(records + record * floats_per_record, data, record_bytes());
+  return true;
+}
+
+bool CapsuleSegmentFile::read(int64_t record, float *out) const {
+  if (!valid(record) || !out)
+    return false;
+  std::memcpy(out, records + record * floats_per_record, record_bytes());
+  return true;
+}
+
+bool CapsuleSegmentFile::grow(size_t new_capacity) {
+  size_t old_bytes = file_bytes();
+  size_t new_bytes = new_capacity * record_bytes();
+#if defined(__linux__)
+  // Reserve the blocks now: a sparse file that runs out of disk would
+  // only fail later, as SIGBUS on a store through the mapping
+  int error = posix_fallocate(fd, static_cast<off_t>(old_bytes),
+                              static_cast<off_t>(new_bytes - old_bytes));
+  if (error != 0) {
+    std::cerr << "[CapsuleSegmentFile] Cannot grow segment to " << new_bytes
+              << " bytes: " << std::strerror(error) << std::endl;
+    // Drop any partial reservation; the mapping still covers old_bytes
+    if (ftruncate(fd, static_cast<off_t>(old_bytes)) != 0)
+      std::cerr << "[CapsuleSegmentFile] Cannot trim segment: "
+                << std::strerror(errno) << std::endl;
+    return false;
+  }
+  void *mapped = mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, 0);
+  if (mapped == MAP_FAILED) {
+    std::cerr << "[CapsuleSegmentFile] Cannot map segment: "
+              << std::strerror(errno) << std::endl;
+    return false;
+  }
+  if (records)
+    munmap(records, old_bytes);
+  records = static_cast<float *>(mapped);
+#else
+  heap.resize(new_capacity * floats_per_record);
+  records = heap.data();
+#endif
+  capacity = new_capacity;
+  return true;
+}
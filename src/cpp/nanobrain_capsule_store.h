@@ -0,0 +1,72 @@
+#ifndef NANOBRAIN_CAPSULE_STORE_H
+#define NANOBRAIN_CAPSULE_STORE_H
+
+/**
+ * NanoBrain Capsule Segment File
+ *
+ * Cold tier for CorticalPenFreezer: frozen capsule states spilled out of
+ * the ggml context as fixed-size float records in one segment file. The
+ * file is mapped with mmap (MAP_SHARED), so a spill or fault-in is a
+ * memcpy against the page cache, and the kernel is free to write spilled
+ * pages back and drop them under memory pressure.
+ *
+ * - Every record holds record_floats floats; released records go on a
+ *   free list and are reused before the file grows
+ * - The file grows by doubling (posix_fallocate + remap), so running out
+ *   of disk fails the allocation instead of faulting a later store
+ * - With an empty path the segment is an unlinked temporary file that
+ *   disappears with the process
+ *
+ * Off Linux the records live in a heap vector instead of a mapped file.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class CapsuleSegmentFile {
+public:
+  CapsuleSegmentFile() = default;
+  ~CapsuleSegmentFile() { close(); }
+
+  CapsuleSegmentFile(const CapsuleSegmentFile &) = delete;
+  CapsuleSegmentFile &operator=(const CapsuleSegmentFile &) = delete;
+
+  // Create (or truncate) the segment at path; an empty path makes an
+  // unlinked file under $TMPDIR (or /tmp)
+  bool open(const std::string &path, size_t record_floats);
+  void close();
+  bool is_open() const { return floats_per_record > 0; }
+
+  // Record index for a new record, or -1 if the file could not grow
+  int64_t allocate();
+  // False for records that are not live (including double releases)
+  bool release(int64_t record);
+
+  bool write(int64_t record, const float *data);
+  bool read(int64_t record, float *out) const;
+
+  size_t record_floats() const { return floats_per_record; }
+  size_t live_records() const { return next_record - free_records.size(); }
+  size_t file_bytes() const { return capacity * record_bytes(); }
+
+private:
+  size_t record_bytes() const { return floats_per_record * sizeof(float); }
+  bool valid(int64_t record) const {
+    return record >= 0 && static_cast<size_t>(record) < next_record &&
+           !released[record];
+  }
+  bool grow(size_t records);
+
+  int fd = -1;
+  float *records = nullptr; // Mapped file (or heap.data() off Linux)
+  std::vector<float> heap;
+  size_t floats_per_record = 0;
+  size_t capacity = 0;    // Records the file can hold
+  size_t next_record = 0; // Records ever handed out
+  std::vector<int64_t> free_records;
+  std::vector<uint8_t> released; // Per handed-out record: on the free list
+};
+
+#endif // NANOBRAIN_CAPSULE_STORE_H
@@ -0,0 +1,213 @@
+#include "nanobrain_circuit_pipeline.h"
+#include <algorithm>
+#include <iostream>
+
+// ================================================================
+// CircuitPipeline Implementation
+// ================================================================
+
+CircuitPipeline::CircuitPipeline(const CircuitPipelineConfig &config)
+    : config(config) {}
+
+CircuitPipeline::~CircuitPipeline() { wait(); }
+
+int CircuitPipeline::add_stage(TimeCircuit *circuit,
+                               const std::vector<int> &inputs) {
+  if (running || !circuit)
+    return -1;
+  for (const auto &stage : stages) {
+    if (stage->circuit == circuit)
+      return -1;
+  }
+  for (int input : inputs) {
+    if (input < 0 || input >= static_cast<int>(stages.size()))
+      return -1;
+  }
+
+  auto stage = std::make_unique<Stage>();
+  stage->id = static_cast<int>(stages.size());
+  stage->circuit = circuit;
+  stage->name = circuit->get_name();
+  stage->inputs = inputs;
+  if (metrics_cache)
+    circuit->set_metrics_cache(metrics_cache);
+  stages.push_back(std::move(stage));
+  return stages.back()->id;
+}
+
+void CircuitPipeline::set_metrics_cache(const CircuitMetricsCache *cache) {
+  metrics_cache = cache;
+  for (auto &stage : stages) {
+    stage->circuit->set_metrics_cache(cache);
+  }
+}
+
+bool CircuitPipeline::start() {
+  if (running || closed || stages.empty())
+    return false;
+  if (!metrics_cache) {
+    // Workers would call get_metrics() while the kernel thread mutates
+    std::cerr << "[CircuitPipeline] start() needs a metrics cache"
+              << std::endl;
+    return false;
+  }
+
+  // One queue per edge; sources share nothing, each gets its own queue
+  for (auto &stage : stages) {
+    if (stage->inputs.empty()) {
+      queues.push_back(
+          std::make_unique<SpscQueue<CircuitItem>>(config.queue_capacity));
+      stage->in_queues.push_back(queues.back().get());
+      source_queues.push_back(queues.back().get());
+      continue;
+    }
+    for (int input : stage->inputs) {
+      queues.push_back(
+          std::make_unique<SpscQueue<CircuitItem>>(config.queue_capacity));
+      stage->in_queues.push_back(queues.back().get());
+      stages[input]->out_queues.push_back(queues.back().get());
+    }
+  }
+
+  running = true;
+  for (auto &stage : stages) {
+    Stage *s = stage.get();
+    stage->worker = std::thread([this, s] { run_stage(*s); });
+  }
+
+  std::cout << "[CircuitPipeline] Started " << stages.size()
+            << " stages with " << queues.size() << " queues" << std::endl;
+  return true;
+}
+
+bool CircuitPipeline::submit(const std::vector<float> &input) {
+  if (!running || closed)
+    return false;
+
+  CircuitItem item;
+  for (auto *queue : source_queues) {
+    item.sequence = next_sequence;
+    item.data = input;
+    int spins = 0;
+    while (!queue->try_push(item)) {
+      submit_waits++;
+      pause(spins);
+    }
+  }
+  next_sequence++;
+  return true;
+}
+
+void CircuitPipeline::close() {
+  if (!running || closed)
+    return;
+  closed = true;
+  for (auto *queue : source_queues) {
+    queue->close();
+  }
+}
+
+void CircuitPipeline::wait() {
+  close();
+  for (auto &stage : stages) {
+    if (stage->worker.joinable())
+      stage->worker.join();
+  }
+  running = false;
+}
+
+CircuitPipelineStats CircuitPipeline::get_stats() const {
+  CircuitPipelineStats stats;
+  stats.submitted = next_sequence;
+  stats.submit_waits = submit_waits;
+  stats.emitted = emitted.load(std::memory_order_relaxed);
+  for (const auto &stage : stages) {
+    CircuitStageStats s;
+    s.name = stage->name;
+    s.processed = stage->processed.load(std::memory_order_relaxed);
+    s.input_waits = stage->input_waits.load(std::memory_order_relaxed);
+    s.output_waits = stage->output_waits.load(std::memory_order_relaxed);
+    stats.stages.push_back(s);
+  }
+  return stats;
+}
+
+void CircuitPipeline::run_stage(Stage &stage) {
+  std::vector<float> combined;
+  CircuitItem item;
+
+  while (true) {
+    // One item from each input, concatenated in input order
+    bool drained = false;
+    uint64_t sequence = 0;
+    combined.clear();
+    for (size_t i = 0; i < stage.in_queues.size(); i++) {
+      if (!pop_input(stage, i, item)) {
+        drained = true;
+        break;
+      }
+      sequence = item.sequence;
+      if (stage.in_queues.size() == 1) {
+        combined.swap(item.data);
+      } else {
+        combined.insert(combined.end(), item.data.begin(), item.data.end());
+      }
+    }
+    if (drained)
+      break;
+
+    stage.circuit->process_input(combined);
+    CircuitItem output;
+    output.sequence = sequence;
+    output.data = stage.circuit->generate_output();
+    stage.processed.fetch_add(1, std::memory_order_relaxed);
+
+    if (stage.out_queues.empty()) {
+      if (sink)
+        sink(stage.id, output);
+      emitted.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    // Broadcast: copies for all consumers but the last
+    for (size_t q = 0; q + 1 < stage.out_queues.size(); q++) {
+      push_output(stage, *stage.out_queues[q], output);
+    }
+    push_output(stage, *stage.out_queues.back(), std::move(output));
+  }
+
+  for (auto *queue : stage.out_queues) {
+    queue->close();
+  }
+}
+
+bool CircuitPipeline::pop_input(Stage &stage, size_t input,
+                                CircuitItem &item) {
+  SpscQueue<CircuitItem> &queue = *stage.in_queues[input];
+  int spins = 0;
+  while (!queue.try_pop(item)) {
+    // Every push happens before close(), so an empty closed queue is done
+    if (queue.is_closed())
+      return queue.try_pop(item);
+    stage.input_waits.fetch_add(1, std::memory_order_relaxed);
+    pause(spins);
+  }
+  return true;
+}
+
+void CircuitPipeline::push_output(Stage &stage, SpscQueue<CircuitItem> &queue,
+                                  CircuitItem item) {
+  int spins = 0;
+  while (!queue.try_push(item)) {
+    stage.output_waits.fetch_add(1, std::memory_order_relaxed);
+    pause(spins);
+  }
+}
+
+void CircuitPipeline::pause(int &spins) const {
+  if (spins < config.spin_limit) {
+    spins++;
+    return;
+  }
+  std::this_thread::yield();
+}
@@ -0,0 +1,163 @@
+#ifndef NANOBRAIN_CIRCUIT_PIPELINE_H
+#define NANOBRAIN_CIRCUIT_PIPELINE_H
+
+/**
+ * NanoBrain Time Circuit Pipeline
+ *
+ * Streams inputs through a DAG of TimeCircuits. Every stage runs on its own
+ * worker thread; stages are connected by bounded lock-free single-producer
+ * single-consumer queues, one per edge, so a slow stage stalls its
+ * producers instead of letting queues grow (backpressure).
+ *
+ * - A stage without inputs is a source: it receives every submit()ted
+ *   vector
+ * - A stage with several inputs takes one item from each, in input order,
+ *   and concatenates them (items stay aligned by sequence number)
+ * - A stage's output goes to every stage that lists it as an input; outputs
+ *   of sink stages (no consumers) go to the sink callback
+ *
+ * Circuits read kernel metrics from one shared CircuitMetricsCache that
+ * TimeCrystalKernel::process_cycle() refreshes, never from the kernel
+ * directly: the kernel's thread keeps cycling while stages run.
+ */
+
+#include "nanobrain_consciousness.h"
+#include "nanobrain_realtime.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * One input or output vector travelling through the pipeline
+ */
+struct CircuitItem {
+  uint64_t sequence = 0; // Position in the submitted stream
+  std::vector<float> data;
+};
+
+/**
+ * Pipeline configuration
+ */
+struct CircuitPipelineConfig {
+  size_t queue_capacity = 1024; // Items per edge (power of two)
+  int spin_limit = 64;          // Busy polls before a waiting worker yields
+};
+
+/**
+ * Per-stage counters
+ */
+struct CircuitStageStats {
+  std::string name;
+  size_t processed = 0;
+  size_t input_waits = 0;  // Polls that found an input queue empty
+  size_t output_waits = 0; // Pushes stalled by a full queue (backpressure)
+};
+
+/**
+ * Pipeline counters
+ */
+struct CircuitPipelineStats {
+  size_t submitted = 0;
+  size_t submit_waits = 0; // submit() stalls on a full source queue
+  size_t emitted = 0;      // Sink outputs
+  std::vector<CircuitStageStats> stages;
+};
+
+/**
+ * Time Circuit Pipeline Executor
+ *
+ * Build the DAG with add_stage() (inputs must be added first, so stages
+ * are in topological order), then start(), submit() a stream, close() and
+ * wait(). submit()/close()/wait() must be called from one thread. A circuit
+ * belongs to one stage and is only touched by that stage's worker while
+ * the pipeline runs.
+ */
+class CircuitPipeline {
+public:
+  using Sink = std::function<void(int stage, const CircuitItem &output)>;
+
+  explicit CircuitPipeline(const CircuitPipelineConfig &config = {});
+  ~CircuitPipeline();
+
+  CircuitPipeline(const CircuitPipeline &) = delete;
+  CircuitPipeline &operator=(const CircuitPipeline &) = delete;
+
+  // ================================================================
+  // Graph
+  // ================================================================
+
+  // Add a stage fed by earlier stages (none: a source). Returns the stage
+  // id, or -1 for an unknown input, a circuit already in the pipeline, or
+  // a running pipeline.
+  int add_stage(TimeCircuit *circuit, const std::vector<int> &inputs = {});
+
+  // Called on the sink stage's worker thread, in sequence order per stage
+  void set_sink(Sink sink) { this->sink = std::move(sink); }
+
+  // Point every circuit at a shared metrics cache; required before start()
+  void set_metrics_cache(const CircuitMetricsCache *cache);
+
+  // ================================================================
+  // Streaming
+  // ================================================================
+
+  // Start one worker per stage; false if already started, empty or
+  // without a metrics cache
+  bool start();
+
+  // Send one input to every source stage, waiting while a source queue is
+  // full. False if the pipeline is not running.
+  bool submit(const std::vector<float> &input);
+
+  // End of stream: workers drain their queues and exit
+  void close();
+
+  // close() and wait for every worker
+  void wait();
+
+  bool is_running() const { return running; }
+  size_t get_stage_count() const { return stages.size(); }
+  CircuitPipelineStats get_stats() const;
+
+private:
+  struct Stage {
+    int id = -1;
+    TimeCircuit *circuit = nullptr;
+    std::string name;
+    std::vector<int> inputs;
+    std::vector<SpscQueue<CircuitItem> *> in_queues;  // One per input
+    std::vector<SpscQueue<CircuitItem> *> out_queues; // One per consumer
+    std::thread worker;
+
+    std::atomic<size_t> processed{0};
+    std::atomic<size_t> input_waits{0};
+    std::atomic<size_t> output_waits{0};
+  };
+
+  CircuitPipelineConfig config;
+  std::vector<std::unique_ptr<Stage>> stages;
+  std::vector<std::unique_ptr<SpscQueue<CircuitItem>>> queues;
+  std::vector<SpscQueue<CircuitItem> *> source_queues;
+  Sink sink;
+  const CircuitMetricsCache *metrics_cache = nullptr;
+
+  bool running = false;
+  bool closed = false;
+  uint64_t next_sequence = 0;
+  size_t submit_waits = 0;
+  std::atomic<size_t> emitted{0};
+
+  void run_stage(Stage &stage);
+  bool pop_input(Stage &stage, size_t input, CircuitItem &item);
+  void push_output(Stage &stage, SpscQueue<CircuitItem> &queue,
+                   CircuitItem item);
+  void pause(int &spins) const;
+};
+
+#endif // NANOBRAIN_CIRCUIT_PIPELINE_H
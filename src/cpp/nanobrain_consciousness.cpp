@@ -4,7 +4,6 @@
 #include <cmath>
 #include <iostream>
 #include <numeric>
-#include <random>
 
 // ================================================================
 // ConsciousnessUploader Implementation
@@ -40,8 +39,13 @@ ConsciousnessState ConsciousnessUploader::capture_state() {
 
   // Capture 11D time crystal state
   if (time_crystal_kernel && time_crystal_kernel->is_active()) {
+    // A published snapshot is read without touching the live AtomSpace, so
+    // capture can run alongside the writer's cycles
+    auto snapshot = time_crystal_kernel->acquire_snapshot();
+
     // Get current quantum state from time crystal
-    auto metrics = time_crystal_kernel->get_metrics();
+    auto metrics = snapshot ? snapshot->get_metrics()
+                            : time_crystal_kernel->get_metrics();
 
     // Fill 11D snapshot from time crystal
     for (int i = 0; i < CONSCIOUSNESS_DIMENSIONS; ++i) {
@@ -58,12 +62,19 @@ ConsciousnessState ConsciousnessUploader::capture_state() {
     state.prime_signature = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31};
 
     // Build atom coherence map from all atoms
-    auto atom_ids = time_crystal_kernel->get_all_atom_ids();
-    for (const auto &id : atom_ids) {
-      const TimeCrystalAtom *atom = time_crystal_kernel->get_atom(id);
-      if (atom) {
-        state.atom_coherence_map[id] =
-            atom->time_crystal_state.temporal_coherence;
+    if (snapshot) {
+      snapshot->for_each_atom([&](const TimeCrystalAtom &atom) {
+        state.atom_coherence_map[atom.id] =
+            atom.time_crystal_state.temporal_coherence;
+      });
+    } else {
+      auto atom_ids = time_crystal_kernel->get_all_atom_ids();
+      for (const auto &id : atom_ids) {
+        const TimeCrystalAtom *atom = time_crystal_kernel->get_atom(id);
+        if (atom) {
+          state.atom_coherence_map[id] =
+              atom->time_crystal_state.temporal_coherence;
+        }
       }
     }
   }
@@ -115,10 +126,7 @@ void ConsciousnessUploader::serialize_to_time_crystal(
 
   // Store atom coherence data by updating existing atoms
   for (const auto &[atom_id, coherence] : state.atom_coherence_map) {
-    TimeCrystalAtom *atom = time_crystal_kernel->get_atom(atom_id);
-    if (atom) {
-      atom->time_crystal_state.temporal_coherence = coherence;
-    }
+    time_crystal_kernel->set_temporal_coherence(atom_id, coherence);
   }
 
   current_status = ConsciousnessStatus::Ready;
@@ -152,10 +160,8 @@ bool ConsciousnessUploader::restore_to_substrate(
 
   // Restore atom coherence values
   for (const auto &[atom_id, coherence] : state.atom_coherence_map) {
-    TimeCrystalAtom *atom = time_crystal_kernel->get_atom(atom_id);
-    if (atom) {
-      atom->time_crystal_state.temporal_coherence = coherence;
-      atom->time_crystal_state.quantum_phase = state.consciousness_level;
+    if (time_crystal_kernel->set_temporal_coherence(atom_id, coherence)) {
+      time_crystal_kernel->set_quantum_phase(atom_id, state.consciousness_level);
     }
   }
 
@@ -458,8 +464,9 @@ float DimensionalFolder::compute_dimensional_distance(int dim1,
 // ================================================================
 
 BrainEvolutionSimulator::BrainEvolutionSimulator(TimeCrystalKernel *tc_kernel)
-    : time_crystal_kernel(tc_kernel), mutation_rate(0.1f),
-      selection_pressure(0.5f) {
+    : time_crystal_kernel(tc_kernel),
+      seed(tc_kernel ? tc_kernel->get_seed() : NANOBRAIN_DEFAULT_SEED),
+      mutation_rate(0.1f), selection_pressure(0.5f) {
 
   reset();
 }
@@ -481,12 +488,12 @@ void BrainEvolutionSimulator::evolve_step() {
       current_state.phase, static_cast<EvolutionaryPhase>(
                                static_cast<int>(current_state.phase) + 1));
 
-  // Random transition based on fitness and probability
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(0.0, 1.0);
+  // Random transition based on fitness and probability, one draw per
+  // generation
+  CounterRng rng(seed, RandomSubsystem::Consciousness, 0,
+                 static_cast<uint64_t>(current_state.generation));
 
-  if (dis(gen) < transition_prob * fitness) {
+  if (rng.uniform() < transition_prob * fitness) {
     int phase_int = static_cast<int>(current_state.phase);
     if (phase_int < static_cast<int>(EvolutionaryPhase::Unified)) {
       next_phase = static_cast<EvolutionaryPhase>(phase_int + 1);
@@ -693,6 +700,47 @@ int BrainEvolutionSimulator::reduce_to_single_digit(int number) const {
   return number;
 }
 
+// ================================================================
+// CircuitMetricsCache / TimeCircuit Implementation
+// ================================================================
+
+CircuitMetricsCache::CircuitMetricsCache(TimeCrystalKernel *kernel)
+    : kernel(kernel) {
+  if (kernel) {
+    kernel->subscribe_metrics();
+    kernel->publish_metrics();
+  }
+}
+
+CircuitMetricsCache::~CircuitMetricsCache() {
+  if (kernel)
+    kernel->unsubscribe_metrics();
+}
+
+void CircuitMetricsCache::refresh() {
+  if (kernel)
+    kernel->publish_metrics();
+}
+
+std::shared_ptr<const NanoBrainMetrics> CircuitMetricsCache::get() const {
+  return kernel ? kernel->acquire_metrics() : nullptr;
+}
+
+bool TimeCircuit::read_metrics(TimeCrystalKernel *kernel,
+                               NanoBrainMetrics &out) const {
+  if (metrics_cache) {
+    auto metrics = metrics_cache->get();
+    if (!metrics)
+      return false;
+    out = *metrics;
+    return true;
+  }
+  if (!kernel || !kernel->is_active())
+    return false;
+  out = kernel->get_metrics();
+  return true;
+}
+
 // ================================================================
 // DiagnosisInterface Implementation
 // ================================================================
@@ -716,9 +764,8 @@ std::vector<float> DiagnosisInterface::generate_output() {
   std::vector<float> output(CONSCIOUSNESS_DIMENSIONS);
 
   // Run diagnostic processing through time crystal
-  if (kernel && kernel->is_active()) {
-    auto metrics = kernel->get_metrics();
-
+  NanoBrainMetrics metrics;
+  if (read_metrics(kernel, metrics)) {
     for (int i = 0; i < CONSCIOUSNESS_DIMENSIONS; ++i) {
       float diagnostic = internal_state[i];
       float coherence_check = metrics.quantum_coherence;
@@ -786,9 +833,8 @@ std::vector<float> DecisionSupportInterface::generate_output() {
   std::vector<float> output(CONSCIOUSNESS_DIMENSIONS);
 
   // Decision processing through time crystal
-  if (kernel && kernel->is_active()) {
-    auto metrics = kernel->get_metrics();
-
+  NanoBrainMetrics metrics;
+  if (read_metrics(kernel, metrics)) {
     for (int i = 0; i < CONSCIOUSNESS_DIMENSIONS; ++i) {
       // Weight by consciousness emergence
       output[i] = internal_state[i] * metrics.consciousness_emergence;
@@ -810,6 +856,10 @@ int DecisionSupportInterface::recommend_decision(
 
   std::vector<float> scores(options.size());
 
+  // Time crystal modulation, read once for every option
+  NanoBrainMetrics metrics;
+  bool modulate = read_metrics(kernel, metrics);
+
   // Score each option using time crystal metrics
   for (size_t i = 0; i < options.size(); ++i) {
     float score = 0.0f;
@@ -822,8 +872,7 @@ int DecisionSupportInterface::recommend_decision(
     }
 
     // Modulate by time crystal if available
-    if (kernel && kernel->is_active()) {
-      auto metrics = kernel->get_metrics();
+    if (modulate) {
       score *= metrics.consciousness_emergence;
     }
 
@@ -851,7 +900,8 @@ int DecisionSupportInterface::recommend_decision(
 
 CreativeGenerationInterface::CreativeGenerationInterface(
     TimeCrystalKernel *tc_kernel)
-    : kernel(tc_kernel), creativity_level(0.5f) {
+    : kernel(tc_kernel), creativity_level(0.5f),
+      rng_seed(tc_kernel ? tc_kernel->get_seed() : NANOBRAIN_DEFAULT_SEED) {
   ready_state = (kernel != nullptr);
   internal_state.resize(CONSCIOUSNESS_DIMENSIONS, 0.0f);
 }
@@ -875,20 +925,21 @@ CreativeGenerationInterface::generate_creative(const std::vector<float> &seed,
   creativity_level = creativity;
   std::vector<float> output(CONSCIOUSNESS_DIMENSIONS);
 
-  // Random generator for creative variations
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::normal_distribution<float> noise(0.0f, creativity);
+  // Random generator for creative variations, a new stream per call
+  CounterRng rng(rng_seed, RandomSubsystem::Creativity, 0,
+                 creative_calls++);
+
+  NanoBrainMetrics metrics;
+  bool modulate = read_metrics(kernel, metrics);
 
   for (int i = 0; i < CONSCIOUSNESS_DIMENSIONS; ++i) {
     float base = (i < static_cast<int>(seed.size())) ? seed[i] : 0.0f;
 
     // Apply creative transformation
-    float creative_mod = noise(gen);
+    float creative_mod = rng.normal(0.0f, creativity);
 
     // Time crystal modulation for coherent creativity
-    if (kernel && kernel->is_active()) {
-      auto metrics = kernel->get_metrics();
+    if (modulate) {
       // Creativity is enhanced by consciousness
       creative_mod *= metrics.consciousness_emergence;
       // But bounded by coherence
@@ -379,6 +379,7 @@ public:
 private:
   TimeCrystalKernel *time_crystal_kernel;
   EvolutionaryState current_state;
+  uint64_t seed; // Counter RNG seed, from the kernel config
 
   // Evolution parameters
   float mutation_rate;
@@ -395,6 +396,35 @@ private:
 // Time Circuit Interface (Abstract Base)
 // ================================================================
 
+/**
+ * Kernel metrics shared by time circuits
+ *
+ * get_metrics() scans the whole AtomSpace, so instead of every circuit
+ * calling it per input, the cache subscribes to the kernel and
+ * TimeCrystalKernel::process_cycle() publishes one snapshot per cycle
+ * that circuits on any thread read.
+ */
+class CircuitMetricsCache {
+public:
+  // Subscribes and publishes an initial snapshot; construct on the
+  // kernel's thread
+  explicit CircuitMetricsCache(TimeCrystalKernel *kernel);
+  ~CircuitMetricsCache();
+
+  CircuitMetricsCache(const CircuitMetricsCache &) = delete;
+  CircuitMetricsCache &operator=(const CircuitMetricsCache &) = delete;
+
+  // Republish outside a cycle; call from the kernel's thread between cycles
+  void refresh();
+
+  // Latest snapshot, nullptr if the kernel was inactive at the last
+  // publish. Safe from any thread.
+  std::shared_ptr<const NanoBrainMetrics> get() const;
+
+private:
+  TimeCrystalKernel *kernel;
+};
+
 /**
  * Time Circuit Abstraction
  *
@@ -405,6 +435,14 @@ class TimeCircuit {
 public:
   virtual ~TimeCircuit() = default;
 
+  /**
+   * Read kernel metrics from a shared cache instead of the kernel
+   * @param cache Cache to read, nullptr to query the kernel directly
+   */
+  void set_metrics_cache(const CircuitMetricsCache *cache) {
+    metrics_cache = cache;
+  }
+
   /**
    * Process input through time circuit
    * @param input Input vector
@@ -430,6 +468,11 @@ public:
 protected:
   std::vector<float> internal_state;
   bool ready_state = false;
+  const CircuitMetricsCache *metrics_cache = nullptr;
+
+  // Current metrics, from the cache when set; false if there are none (no
+  // kernel, or an inactive one)
+  bool read_metrics(TimeCrystalKernel *kernel, NanoBrainMetrics &out) const;
 };
 
 // ================================================================
@@ -532,6 +575,8 @@ public:
 private:
   TimeCrystalKernel *kernel;
   float creativity_level;
+  uint64_t rng_seed;           // Counter RNG seed, from the kernel config
+  uint64_t creative_calls = 0; // Counter RNG step
 };
 
 // ================================================================
@@ -0,0 +1,1026 @@
+#include "nanobrain_distributed.h"
+#include "nanobrain_trace.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// ================================================================
+// Helpers
+// ================================================================
+
+namespace {
+
+constexpr uint32_t PROTOCOL_VERSION = 0x4E424432; // "NBD2"
+constexpr uint32_t MAX_FRAME_BYTES = 1u << 30;
+
+enum class MessageType : uint8_t {
+  Hello = 1,       // Shard assignment
+  Ack,             // Success reply, with a request-specific body
+  Error,           // Failure reply: message
+  CreateAtom,      // Atom fields -> local id
+  GetAtom,         // Local id -> found flag + atom record
+  CreateInference, // Premises (local, or remote with record) -> link id
+  Cycle,           // Inbox batch
+  CycleDone,       // Outboxes, candidates and shard status
+  Shutdown,
+  DeclareType      // Atom type name, interned before records use it
+};
+
+float elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<float, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+/**
+ * Frame builder: message type byte followed by the body
+ */
+class WireWriter {
+public:
+  explicit WireWriter(MessageType type) {
+    buffer.push_back(static_cast<uint8_t>(type));
+  }
+
+  template <typename T> void pod(const T &value) {
+    static_assert(std::is_trivially_copyable<T>::value, "POD fields only");
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  void string(const std::string &str) {
+    pod(static_cast<uint32_t>(str.size()));
+    buffer.insert(buffer.end(), str.begin(), str.end());
+  }
+
+  void ints(PrimeView values) {
+    pod(static_cast<uint32_t>(values.size()));
+    const auto *bytes = reinterpret_cast<const uint8_t *>(values.data());
+    buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(int));
+  }
+
+  std::vector<uint8_t> buffer;
+};
+
+/**
+ * Frame parser. Reading past the end zero-fills and makes ok() false, so
+ * decoders check once at the end.
+ */
+class WireReader {
+public:
+  explicit WireReader(const std::vector<uint8_t> &frame)
+      : data(frame.data()), size(frame.size()), pos(1) {
+    valid = !frame.empty();
+  }
+
+  MessageType type() const {
+    return size ? static_cast<MessageType>(data[0]) : MessageType::Error;
+  }
+  bool ok() const { return valid; }
+
+  template <typename T> void pod(T &value) {
+    static_assert(std::is_trivially_copyable<T>::value, "POD fields only");
+    if (!take(sizeof(T))) {
+      std::memset(&value, 0, sizeof(T));
+      return;
+    }
+    std::memcpy(&value, data + pos - sizeof(T), sizeof(T));
+  }
+
+  template <typename T> T pod() {
+    T value;
+    pod(value);
+    return value;
+  }
+
+  void string(std::string &str) {
+    uint32_t len = pod<uint32_t>();
+    if (!take(len)) {
+      str.clear();
+      return;
+    }
+    str.assign(reinterpret_cast<const char *>(data + pos - len), len);
+  }
+
+  std::string string() {
+    std::string str;
+    string(str);
+    return str;
+  }
+
+  void ints(std::vector<int> &values) {
+    uint32_t count = pod<uint32_t>();
+    size_t bytes = static_cast<size_t>(count) * sizeof(int);
+    if (!take(bytes)) {
+      values.clear();
+      return;
+    }
+    values.resize(count);
+    std::memcpy(values.data(), data + pos - bytes, bytes);
+  }
+
+  // Inline sets hold PRIME_SET_CAPACITY primes; a longer list is invalid
+  // rather than silently truncated
+  void ints(PrimeSet &values) {
+    uint32_t count = pod<uint32_t>();
+    size_t bytes = static_cast<size_t>(count) * sizeof(int);
+    values.clear();
+    if (count > PRIME_SET_CAPACITY)
+      valid = false;
+    if (!take(bytes))
+      return;
+    const uint8_t *src = data + pos - bytes;
+    for (uint32_t i = 0; i < count; i++) {
+      int prime;
+      std::memcpy(&prime, src + i * sizeof(int), sizeof(int));
+      values.push_back(prime);
+    }
+  }
+
+  // Atom types must already be known (lookup_atom_type) so peers cannot
+  // grow the process-wide symbol table
+  void symbol(Symbol &symbol) {
+    std::string text = string();
+    if (valid && !lookup_atom_type(text, symbol))
+      valid = false;
+  }
+
+  // Atom types named by the coordinator's own create_atom() are interned,
+  // as ShardedNanoBrainKernel::create_atom does
+  void declared_symbol(Symbol &symbol) {
+    std::string text = string();
+    if (valid)
+      symbol = Symbol(text);
+  }
+
+  // Element count of a following array, bounded by the bytes left so a
+  // corrupt frame cannot trigger a huge allocation
+  size_t count(size_t min_element_bytes) {
+    uint32_t n = pod<uint32_t>();
+    if (valid && static_cast<size_t>(n) * min_element_bytes > size - pos) {
+      valid = false;
+    }
+    return valid ? n : 0;
+  }
+
+private:
+  const uint8_t *data;
+  size_t size;
+  size_t pos;
+  bool valid;
+
+  bool take(size_t n) {
+    if (!valid || n > size - pos) {
+      valid = false;
+      return false;
+    }
+    pos += n;
+    return true;
+  }
+};
+
+void write_geometry(WireWriter &out, const GeometricPattern &geometry) {
+  out.pod(static_cast<int32_t>(geometry.shape));
+  out.pod(static_cast<int32_t>(geometry.dimensions));
+  out.string(geometry.symmetry_group);
+  out.pod(static_cast<int32_t>(geometry.musical_note));
+  out.ints(geometry.prime_resonance);
+  out.pod(geometry.scale_factor);
+}
+
+void read_geometry(WireReader &in, GeometricPattern &geometry) {
+  geometry.shape = static_cast<GMLShape>(in.pod<int32_t>());
+  geometry.dimensions = in.pod<int32_t>();
+  in.string(geometry.symmetry_group);
+  geometry.musical_note = static_cast<MusicalNote>(in.pod<int32_t>());
+  in.ints(geometry.prime_resonance);
+  in.pod(geometry.scale_factor);
+}
+
+// Boundary atom record: everything but the kernel-local slot index
+void write_atom(WireWriter &out, const TimeCrystalAtom &atom) {
+  out.string(atom.id);
+  out.string(atom.type);
+  out.string(atom.name);
+  out.pod(atom.truth_value);
+  out.pod(atom.attention_value);
+
+  const TimeCrystalQuantumState &state = atom.time_crystal_state;
+  out.pod(state.dimensions);
+  out.ints(state.prime_signature);
+  out.pod(state.temporal_coherence);
+  out.pod(state.fractal_dimension);
+  out.pod(state.resonance_frequency);
+  out.pod(state.quantum_phase);
+
+  out.ints(atom.prime_encoding);
+  write_geometry(out, atom.fractal_geometry);
+}
+
+void read_atom(WireReader &in, TimeCrystalAtom &atom) {
+  in.string(atom.id);
+  in.symbol(atom.type);
+  in.string(atom.name);
+  in.pod(atom.truth_value);
+  in.pod(atom.attention_value);
+
+  TimeCrystalQuantumState &state = atom.time_crystal_state;
+  in.pod(state.dimensions);
+  in.ints(state.prime_signature);
+  in.pod(state.temporal_coherence);
+  in.pod(state.fractal_dimension);
+  in.pod(state.resonance_frequency);
+  in.pod(state.quantum_phase);
+
+  in.ints(atom.prime_encoding);
+  read_geometry(in, atom.fractal_geometry);
+}
+
+void write_mailbox(WireWriter &out, const ShardMailbox &mailbox) {
+  out.pod(static_cast<uint32_t>(mailbox.subscriptions.size()));
+  for (const auto &sub : mailbox.subscriptions) {
+    out.string(sub.atom_id);
+    out.pod(static_cast<int32_t>(sub.subscriber));
+  }
+
+  out.pod(static_cast<uint32_t>(mailbox.replica_updates.size()));
+  for (const auto &update : mailbox.replica_updates) {
+    out.string(update.source_id);
+    out.pod(update.attention);
+    out.pod(update.temporal_coherence);
+    out.pod(update.quantum_phase);
+  }
+
+  out.pod(static_cast<uint32_t>(mailbox.attention_deltas.size()));
+  for (const auto &delta : mailbox.attention_deltas) {
+    out.string(delta.target_id);
+    out.pod(delta.sti_delta);
+  }
+
+  out.pod(static_cast<uint32_t>(mailbox.inference_requests.size()));
+  for (const auto &request : mailbox.inference_requests) {
+    out.string(request.local_premise);
+    out.string(request.remote_id);
+    write_atom(out, request.remote_record);
+    out.pod(static_cast<int32_t>(request.rule));
+  }
+}
+
+void read_mailbox(WireReader &in, ShardMailbox &mailbox) {
+  // Minimum encoded sizes bound the counts (an empty string is 4 bytes)
+  size_t n = in.count(8);
+  mailbox.subscriptions.resize(n);
+  for (auto &sub : mailbox.subscriptions) {
+    in.string(sub.atom_id);
+    sub.subscriber = in.pod<int32_t>();
+  }
+
+  n = in.count(24);
+  mailbox.replica_updates.resize(n);
+  for (auto &update : mailbox.replica_updates) {
+    in.string(update.source_id);
+    in.pod(update.attention);
+    in.pod(update.temporal_coherence);
+    in.pod(update.quantum_phase);
+  }
+
+  n = in.count(8);
+  mailbox.attention_deltas.resize(n);
+  for (auto &delta : mailbox.attention_deltas) {
+    in.string(delta.target_id);
+    in.pod(delta.sti_delta);
+  }
+
+  n = in.count(12);
+  mailbox.inference_requests.resize(n);
+  for (auto &request : mailbox.inference_requests) {
+    in.string(request.local_premise);
+    in.string(request.remote_id);
+    read_atom(in, request.remote_record);
+    request.rule = static_cast<InferenceRuleType>(in.pod<int32_t>());
+  }
+}
+
+std::vector<uint8_t> error_frame(const std::string &message) {
+  WireWriter out(MessageType::Error);
+  out.string(message);
+  return out.buffer;
+}
+
+bool write_fully(int fd, const uint8_t *data, size_t len) {
+  int flags = 0;
+#ifdef MSG_NOSIGNAL
+  flags = MSG_NOSIGNAL; // A dead peer is a send() failure, not SIGPIPE
+#endif
+  while (len > 0) {
+    ssize_t n = ::send(fd, data, len, flags);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    len -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+bool read_fully(int fd, uint8_t *data, size_t len) {
+  while (len > 0) {
+    ssize_t n = ::recv(fd, data, len, 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    len -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+bool make_unix_address(const std::string &path, sockaddr_un &addr) {
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(addr.sun_path))
+    return false;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  return true;
+}
+
+} // namespace
+
+// ================================================================
+// SocketTransport Implementation
+// ================================================================
+
+SocketTransport::SocketTransport(int socket_fd) : fd(socket_fd) {}
+
+SocketTransport::~SocketTransport() { close(); }
+
+bool SocketTransport::create_pair(std::unique_ptr<SocketTransport> &first,
+                                  std::unique_ptr<SocketTransport> &second) {
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    return false;
+  first = std::make_unique<SocketTransport>(fds[0]);
+  second = std::make_unique<SocketTransport>(fds[1]);
+  return true;
+}
+
+std::unique_ptr<SocketTransport>
+SocketTransport::connect(const std::string &path) {
+  sockaddr_un addr;
+  if (!make_unix_address(path, addr))
+    return nullptr;
+
+  int socket_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (socket_fd < 0)
+    return nullptr;
+  if (::connect(socket_fd, reinterpret_cast<sockaddr *>(&addr),
+                sizeof(addr)) != 0) {
+    ::close(socket_fd);
+    return nullptr;
+  }
+  return std::make_unique<SocketTransport>(socket_fd);
+}
+
+bool SocketTransport::send(const std::vector<uint8_t> &frame) {
+  if (fd < 0 || frame.size() > MAX_FRAME_BYTES)
+    return false;
+  uint32_t len = static_cast<uint32_t>(frame.size());
+  return write_fully(fd, reinterpret_cast<const uint8_t *>(&len),
+                     sizeof(len)) &&
+         write_fully(fd, frame.data(), frame.size());
+}
+
+bool SocketTransport::receive(std::vector<uint8_t> &frame) {
+  uint32_t len = 0;
+  if (fd < 0 ||
+      !read_fully(fd, reinterpret_cast<uint8_t *>(&len), sizeof(len)) ||
+      len > MAX_FRAME_BYTES)
+    return false;
+  frame.resize(len);
+  return read_fully(fd, frame.data(), len);
+}
+
+void SocketTransport::close() {
+  if (fd >= 0) {
+    ::close(fd);
+    fd = -1;
+  }
+}
+
+// ================================================================
+// SocketListener Implementation
+// ================================================================
+
+SocketListener::~SocketListener() { close(); }
+
+bool SocketListener::listen(const std::string &socket_path) {
+  close();
+
+  sockaddr_un addr;
+  if (!make_unix_address(socket_path, addr))
+    return false;
+
+  fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    return false;
+
+  ::unlink(socket_path.c_str());
+  if (::bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      ::listen(fd, 16) != 0) {
+    ::close(fd);
+    fd = -1;
+    return false;
+  }
+  path = socket_path;
+  return true;
+}
+
+std::unique_ptr<SocketTransport> SocketListener::accept() {
+  while (fd >= 0) {
+    int client = ::accept(fd, nullptr, nullptr);
+    if (client >= 0)
+      return std::make_unique<SocketTransport>(client);
+    if (errno != EINTR)
+      break;
+  }
+  return nullptr;
+}
+
+void SocketListener::close() {
+  if (fd >= 0) {
+    ::close(fd);
+    fd = -1;
+    ::unlink(path.c_str());
+  }
+  path.clear();
+}
+
+// ================================================================
+// LoopbackTransport Implementation
+// ================================================================
+
+void LoopbackTransport::create_pair(
+    std::unique_ptr<LoopbackTransport> &first,
+    std::unique_ptr<LoopbackTransport> &second) {
+  auto a_to_b = std::make_shared<Channel>();
+  auto b_to_a = std::make_shared<Channel>();
+
+  first = std::make_unique<LoopbackTransport>();
+  first->outgoing = a_to_b;
+  first->incoming = b_to_a;
+
+  second = std::make_unique<LoopbackTransport>();
+  second->outgoing = b_to_a;
+  second->incoming = a_to_b;
+}
+
+bool LoopbackTransport::send(const std::vector<uint8_t> &frame) {
+  if (!outgoing)
+    return false;
+  {
+    std::lock_guard<std::mutex> lock(outgoing->mutex);
+    if (outgoing->closed)
+      return false;
+    outgoing->frames.push_back(frame);
+  }
+  outgoing->ready.notify_one();
+  return true;
+}
+
+bool LoopbackTransport::receive(std::vector<uint8_t> &frame) {
+  if (!incoming)
+    return false;
+  std::unique_lock<std::mutex> lock(incoming->mutex);
+  incoming->ready.wait(
+      lock, [this] { return incoming->closed || !incoming->frames.empty(); });
+  if (incoming->frames.empty())
+    return false;
+  frame = std::move(incoming->frames.front());
+  incoming->frames.pop_front();
+  return true;
+}
+
+void LoopbackTransport::close() {
+  for (auto *channel : {incoming.get(), outgoing.get()}) {
+    if (!channel)
+      continue;
+    {
+      std::lock_guard<std::mutex> lock(channel->mutex);
+      channel->closed = true;
+    }
+    channel->ready.notify_all();
+  }
+}
+
+// ================================================================
+// DistributedWorker Implementation
+// ================================================================
+
+DistributedWorker::DistributedWorker(
+    const ShardedNanoBrainConfig &cfg,
+    std::unique_ptr<DistributedTransport> link)
+    : config(cfg), transport(std::move(link)) {}
+
+bool DistributedWorker::serve() {
+  std::vector<uint8_t> frame;
+  while (transport->receive(frame)) {
+    WireReader in(frame);
+    MessageType type = in.type();
+
+    if (type == MessageType::Shutdown) {
+      transport->send(WireWriter(MessageType::Ack).buffer);
+      if (shard) {
+        std::cout << "[DistributedWorker] Shard " << shard->index
+                  << " shut down" << std::endl;
+      }
+      return true;
+    }
+
+    if (type == MessageType::Hello) {
+      uint32_t version = in.pod<uint32_t>();
+      int32_t index = in.pod<int32_t>();
+      int32_t count = in.pod<int32_t>();
+      if (!in.ok() || version != PROTOCOL_VERSION || index < 0 ||
+          index >= count) {
+        if (!transport->send(error_frame("Bad hello")))
+          return false;
+        continue;
+      }
+      shard = std::make_unique<AtomSpaceShard>(index, count, config);
+      shard->kernel->initialize();
+      if (!transport->send(WireWriter(MessageType::Ack).buffer))
+        return false;
+      continue;
+    }
+
+    if (!shard) {
+      if (!transport->send(error_frame("No shard assigned")))
+        return false;
+      continue;
+    }
+
+    TimeCrystalKernel &kernel = *shard->kernel;
+    WireWriter out(MessageType::Ack);
+    bool known = true;
+
+    switch (type) {
+    case MessageType::DeclareType: {
+      Symbol declared;
+      in.declared_symbol(declared);
+      break;
+    }
+
+    case MessageType::CreateAtom: {
+      Symbol atom_type;
+      in.declared_symbol(atom_type);
+      std::string name = in.string();
+      TruthValue tv = in.pod<TruthValue>();
+      AttentionValue av = in.pod<AttentionValue>();
+      PrimeSet primes;
+      in.ints(primes);
+      GeometricPattern geometry;
+      read_geometry(in, geometry);
+      if (!in.ok())
+        break;
+      out.string(kernel.create_atom(atom_type, name, tv, av, primes, geometry));
+      break;
+    }
+
+    case MessageType::GetAtom: {
+      std::string id = in.string();
+      const TimeCrystalAtom *atom = kernel.get_atom(id);
+      out.pod(static_cast<uint8_t>(atom != nullptr));
+      if (atom) {
+        write_atom(out, *atom);
+      }
+      break;
+    }
+
+    case MessageType::CreateInference: {
+      std::string premise = in.string();
+      uint8_t remote = in.pod<uint8_t>();
+      std::string other = in.string();
+      TimeCrystalAtom record;
+      if (remote) {
+        read_atom(in, record);
+      }
+      auto rule = static_cast<InferenceRuleType>(in.pod<int32_t>());
+      if (!in.ok())
+        break;
+      out.string(remote ? shard->link_remote(premise, other, record, rule)
+                        : kernel.create_inference(premise, other, rule));
+      break;
+    }
+
+    case MessageType::Cycle: {
+      read_mailbox(in, shard->inbox);
+      if (!in.ok()) {
+        shard->inbox.clear();
+        break;
+      }
+      shard->step();
+
+      out = WireWriter(MessageType::CycleDone);
+      out.pod(static_cast<uint32_t>(shard->outbox.size()));
+      for (auto &mailbox : shard->outbox) {
+        write_mailbox(out, mailbox);
+        mailbox.clear();
+      }
+      out.pod(static_cast<uint32_t>(shard->candidates.size()));
+      for (const auto &candidate : shard->candidates) {
+        out.string(candidate.id);
+        write_atom(out, candidate.atom);
+      }
+      ShardStatus status = shard->status();
+      out.pod(status.metrics);
+      out.pod(static_cast<uint64_t>(status.ghost_atoms));
+      out.pod(static_cast<uint64_t>(status.cross_shard_links));
+      out.pod(status.step_ms);
+      break;
+    }
+
+    default:
+      known = false;
+      break;
+    }
+
+    bool valid = known && in.ok();
+    if (!transport->send(valid ? out.buffer : error_frame("Bad request")))
+      return false;
+  }
+  return false;
+}
+
+// ================================================================
+// DistributedCoordinator Implementation
+// ================================================================
+
+DistributedCoordinator::DistributedCoordinator(
+    const ShardedNanoBrainConfig &cfg)
+    : config(cfg) {}
+
+DistributedCoordinator::~DistributedCoordinator() { shutdown(); }
+
+void DistributedCoordinator::add_worker(
+    std::unique_ptr<DistributedTransport> transport) {
+  WorkerLink link;
+  link.transport = std::move(transport);
+  workers.push_back(std::move(link));
+}
+
+bool DistributedCoordinator::spawn_local_workers(int n) {
+  for (int i = 0; i < n; i++) {
+    std::unique_ptr<SocketTransport> parent_end, child_end;
+    if (!SocketTransport::create_pair(parent_end, child_end))
+      return fail("socketpair failed: " + std::string(std::strerror(errno)));
+
+    std::cout.flush(); // Buffered output would be written by both processes
+    pid_t pid = ::fork();
+    if (pid < 0)
+      return fail("fork failed: " + std::string(std::strerror(errno)));
+
+    if (pid == 0) {
+      // Worker process: drop the coordinator's links, serve, and exit
+      // without running the coordinator's destructors
+      parent_end->close();
+      for (auto &worker : workers) {
+        if (worker.transport) {
+          worker.transport->close();
+        }
+      }
+      DistributedWorker worker(config, std::move(child_end));
+      bool clean = worker.serve();
+      std::cout.flush();
+      ::_exit(clean ? 0 : 1);
+    }
+
+    child_end.reset();
+    add_worker(std::move(parent_end));
+    workers.back().pid = static_cast<int>(pid);
+  }
+  return true;
+}
+
+bool DistributedCoordinator::initialize() {
+  if (active)
+    return true;
+  if (workers.empty())
+    return fail("No workers attached");
+
+  size_t n = workers.size();
+  exchange = std::make_unique<ShardExchange>(n, config);
+  declared_types.clear();
+
+  for (size_t i = 0; i < n; i++) {
+    WorkerLink &worker = workers[i];
+    worker.inbox.clear();
+    worker.outbox.assign(n, ShardMailbox{});
+    worker.candidates.clear();
+    worker.status = ShardStatus{};
+
+    WireWriter out(MessageType::Hello);
+    out.pod(PROTOCOL_VERSION);
+    out.pod(static_cast<int32_t>(i));
+    out.pod(static_cast<int32_t>(n));
+    std::vector<uint8_t> reply;
+    if (!call(i, out.buffer, reply))
+      return false;
+  }
+
+  active = true;
+  std::cout << "[DistributedCoordinator] Initialized " << n << " workers"
+            << std::endl;
+  return true;
+}
+
+void DistributedCoordinator::shutdown() {
+  for (auto &worker : workers) {
+    if (!worker.transport)
+      continue;
+
+    std::vector<uint8_t> reply;
+    if (worker.transport->send(WireWriter(MessageType::Shutdown).buffer)) {
+      worker.transport->receive(reply);
+    }
+    worker.transport->close();
+    worker.transport.reset();
+
+    if (worker.pid > 0) {
+      ::waitpid(static_cast<pid_t>(worker.pid), nullptr, 0);
+      worker.pid = -1;
+    }
+  }
+
+  if (active) {
+    std::cout << "[DistributedCoordinator] Shutdown after " << cycle_count
+              << " cycles" << std::endl;
+  }
+  active = false;
+}
+
+// ================================================================
+// Atom Management
+// ================================================================
+
+std::string DistributedCoordinator::create_atom(
+    const std::string &type, const std::string &name, const TruthValue &tv,
+    const AttentionValue &av, const std::vector<int> &prime_encoding,
+    const GeometricPattern &geometry) {
+  if (!active)
+    return "";
+
+  // Every worker may decode this atom's record (ghosts, candidates), so a
+  // type is declared to all of them before its first atom
+  Symbol atom_type(type);
+  if (declared_types.count(atom_type) == 0) {
+    WireWriter declare(MessageType::DeclareType);
+    declare.string(type);
+    std::vector<uint8_t> reply;
+    for (size_t i = 0; i < workers.size(); i++) {
+      if (!call(i, declare.buffer, reply))
+        return "";
+    }
+    declared_types.insert(atom_type);
+  }
+
+  int index = select_shard(name, prime_encoding);
+  WireWriter out(MessageType::CreateAtom);
+  out.string(type);
+  out.string(name);
+  out.pod(tv);
+  out.pod(av);
+  out.ints(prime_encoding);
+  write_geometry(out, geometry);
+
+  std::vector<uint8_t> reply;
+  if (!call(index, out.buffer, reply))
+    return "";
+  WireReader in(reply);
+  std::string local = in.string();
+  return local.empty() ? local : make_shard_id(index, local);
+}
+
+bool DistributedCoordinator::get_atom(const std::string &id,
+                                      TimeCrystalAtom &out_atom) {
+  int index;
+  std::string local;
+  if (!active || !split_shard_id(id, get_worker_count(), index, local))
+    return false;
+
+  WireWriter out(MessageType::GetAtom);
+  out.string(local);
+  std::vector<uint8_t> reply;
+  if (!call(index, out.buffer, reply))
+    return false;
+
+  WireReader in(reply);
+  if (!in.pod<uint8_t>())
+    return false;
+  read_atom(in, out_atom);
+  return in.ok();
+}
+
+std::string DistributedCoordinator::create_inference(
+    const std::string &atom1_id, const std::string &atom2_id,
+    InferenceRuleType rule) {
+  int count = get_worker_count();
+  int shard1, shard2;
+  std::string local1, local2;
+  if (!active || !split_shard_id(atom1_id, count, shard1, local1) ||
+      !split_shard_id(atom2_id, count, shard2, local2))
+    return "";
+
+  WireWriter out(MessageType::CreateInference);
+  out.string(local1);
+  if (shard1 == shard2) {
+    out.pod(static_cast<uint8_t>(0));
+    out.string(local2);
+  } else {
+    // The home shard needs the second premise's record for its ghost
+    TimeCrystalAtom remote;
+    if (!get_atom(atom2_id, remote))
+      return "";
+    out.pod(static_cast<uint8_t>(1));
+    out.string(atom2_id);
+    write_atom(out, remote);
+  }
+  out.pod(static_cast<int32_t>(rule));
+
+  std::vector<uint8_t> reply;
+  if (!call(shard1, out.buffer, reply))
+    return "";
+  WireReader in(reply);
+  std::string link = in.string();
+  return link.empty() ? link : make_shard_id(shard1, link);
+}
+
+// ================================================================
+// Processing Cycle
+// ================================================================
+
+bool DistributedCoordinator::process_cycle() {
+  if (!active)
+    return false;
+
+  NB_TRACE_SCOPE("distributed", "DistributedCoordinator::process_cycle");
+  auto cycle_start = std::chrono::steady_clock::now();
+  size_t n = workers.size();
+
+  // 1. Deliver last cycle's mail
+  {
+    std::vector<std::vector<ShardMailbox> *> outboxes;
+    std::vector<ShardMailbox *> inboxes;
+    for (auto &worker : workers) {
+      outboxes.push_back(&worker.outbox);
+      inboxes.push_back(&worker.inbox);
+    }
+    last_messages = exchange->route(outboxes, inboxes);
+  }
+
+  // 2. Send every inbox first, so all workers step concurrently
+  size_t bytes_sent = 0;
+  std::vector<bool> awaiting(n, false);
+  for (size_t i = 0; i < n; i++) {
+    WireWriter out(MessageType::Cycle);
+    write_mailbox(out, workers[i].inbox);
+    workers[i].inbox.clear();
+    bytes_sent += out.buffer.size();
+    if (!workers[i].transport || !workers[i].transport->send(out.buffer))
+      return abort_cycle(awaiting,
+                         "Worker " + std::to_string(i) + " unreachable");
+    awaiting[i] = true;
+  }
+
+  // 3. Lockstep barrier: wait for every worker's results
+  size_t bytes_received = 0;
+  std::vector<uint8_t> frame;
+  for (size_t i = 0; i < n; i++) {
+    WorkerLink &worker = workers[i];
+    awaiting[i] = false;
+    if (!worker.transport->receive(frame))
+      return abort_cycle(awaiting,
+                         "Worker " + std::to_string(i) + " disconnected");
+    bytes_received += frame.size();
+
+    WireReader in(frame);
+    if (in.type() != MessageType::CycleDone)
+      return abort_cycle(awaiting, "Worker " + std::to_string(i) +
+                                       " failed to cycle");
+
+    size_t destinations = in.count(16);
+    for (size_t dst = 0; dst < destinations && dst < n; dst++) {
+      read_mailbox(in, worker.outbox[dst]);
+    }
+
+    worker.candidates.resize(in.count(8));
+    for (auto &candidate : worker.candidates) {
+      in.string(candidate.id);
+      read_atom(in, candidate.atom);
+    }
+
+    in.pod(worker.status.metrics);
+    worker.status.ghost_atoms = static_cast<size_t>(in.pod<uint64_t>());
+    worker.status.cross_shard_links = static_cast<size_t>(in.pod<uint64_t>());
+    in.pod(worker.status.step_ms);
+
+    if (!in.ok() || destinations != n)
+      return abort_cycle(awaiting, "Malformed cycle result from worker " +
+                                       std::to_string(i));
+  }
+
+  // 4. Pair top atoms across shards for the next cycle
+  std::vector<const std::vector<ShardCandidate> *> candidates;
+  for (const auto &worker : workers) {
+    candidates.push_back(&worker.candidates);
+  }
+  exchange->pair(candidates);
+
+  last_bytes_sent = bytes_sent;
+  last_bytes_received = bytes_received;
+  last_cycle_ms = elapsed_ms(cycle_start);
+  cycle_count++;
+  return true;
+}
+
+bool DistributedCoordinator::run_cycles(int n) {
+  for (int i = 0; i < n; i++) {
+    if (!process_cycle())
+      return false;
+  }
+  return true;
+}
+
+// ================================================================
+// Partitioning
+// ================================================================
+
+int DistributedCoordinator::select_shard(
+    const std::string &name, const std::vector<int> &prime_encoding) const {
+  return assign_shard(name, prime_encoding, config.partitioning,
+                      get_worker_count());
+}
+
+DistributedNanoBrainMetrics DistributedCoordinator::get_metrics() const {
+  std::vector<ShardStatus> statuses;
+  for (const auto &worker : workers) {
+    statuses.push_back(worker.status);
+  }
+
+  DistributedNanoBrainMetrics metrics;
+  metrics.sharded = combine_shard_metrics(statuses);
+  metrics.sharded.messages_delivered = last_messages;
+  metrics.sharded.cycle_ms = last_cycle_ms;
+  metrics.sharded.exchange_ms =
+      std::max(0.0f, last_cycle_ms - metrics.sharded.max_shard_ms);
+  metrics.worker_count = workers.size();
+  metrics.bytes_sent = last_bytes_sent;
+  metrics.bytes_received = last_bytes_received;
+  return metrics;
+}
+
+// ================================================================
+// Private Helpers
+// ================================================================
+
+bool DistributedCoordinator::call(size_t worker,
+                                  const std::vector<uint8_t> &request,
+                                  std::vector<uint8_t> &reply) {
+  auto &transport = workers[worker].transport;
+  if (!transport || !transport->send(request) || !transport->receive(reply))
+    return fail("Worker " + std::to_string(worker) + " unreachable");
+
+  WireReader in(reply);
+  if (in.type() == MessageType::Error)
+    return fail("Worker " + std::to_string(worker) + ": " + in.string());
+  if (in.type() != MessageType::Ack)
+    return fail("Unexpected reply from worker " + std::to_string(worker));
+  return true;
+}
+
+bool DistributedCoordinator::fail(const std::string &message) {
+  last_error = message;
+  std::cout << "[DistributedCoordinator] " << message << std::endl;
+  return false;
+}
+
+bool DistributedCoordinator::abort_cycle(const std::vector<bool> &awaiting,
+                                         const std::string &message) {
+  std::vector<uint8_t> frame;
+  for (size_t i = 0; i < awaiting.size(); i++) {
+    if (awaiting[i] && workers[i].transport) {
+      workers[i].transport->receive(frame);
+    }
+  }
+  active = false;
+  return fail(message);
+}
@@ -0,0 +1,290 @@
+#ifndef NANOBRAIN_DISTRIBUTED_H
+#define NANOBRAIN_DISTRIBUTED_H
+
+/**
+ * NanoBrain Distributed AtomSpace
+ *
+ * Runs the sharded AtomSpace (nanobrain_sharded.h) with every shard in its
+ * own worker process. A coordinator drives the workers in lockstep over a
+ * pluggable transport: each cycle it sends every worker its inbox, waits
+ * for all of them to step, then routes the returned outboxes and pairs
+ * cross-shard candidates through the same ShardExchange the in-process
+ * kernel uses.
+ *
+ * Everything crossing a partition (ghost subscriptions and refreshes,
+ * attention deltas, cross-shard inference requests with their boundary
+ * atom records) travels as one batched binary frame per worker per cycle.
+ * The wire format is host-endian, like AtomSpacePersistence's files: it is
+ * meant for local transports between processes of the same build.
+ */
+
+#include "nanobrain_sharded.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// ================================================================
+// Transports
+// ================================================================
+
+/**
+ * Reliable, ordered, point-to-point frame channel between the coordinator
+ * and one worker
+ */
+class DistributedTransport {
+public:
+  virtual ~DistributedTransport() = default;
+
+  // Send or receive one whole frame; false once the link is closed
+  virtual bool send(const std::vector<uint8_t> &frame) = 0;
+  virtual bool receive(std::vector<uint8_t> &frame) = 0;
+
+  virtual void close() = 0;
+};
+
+/**
+ * Stream socket transport (Unix-domain or any connected stream fd).
+ * Frames are length-prefixed.
+ */
+class SocketTransport : public DistributedTransport {
+public:
+  explicit SocketTransport(int fd); // Takes ownership of fd
+  ~SocketTransport() override;
+
+  SocketTransport(const SocketTransport &) = delete;
+  SocketTransport &operator=(const SocketTransport &) = delete;
+
+  // Connected pair over socketpair(), e.g. for a forked worker
+  static bool create_pair(std::unique_ptr<SocketTransport> &first,
+                          std::unique_ptr<SocketTransport> &second);
+
+  // Connect to a SocketListener; nullptr on failure
+  static std::unique_ptr<SocketTransport> connect(const std::string &path);
+
+  bool send(const std::vector<uint8_t> &frame) override;
+  bool receive(std::vector<uint8_t> &frame) override;
+  void close() override;
+
+  int get_fd() const { return fd; }
+
+private:
+  int fd;
+};
+
+/**
+ * Unix-domain socket listener, for workers started separately from the
+ * coordinator
+ */
+class SocketListener {
+public:
+  SocketListener() = default;
+  ~SocketListener();
+
+  SocketListener(const SocketListener &) = delete;
+  SocketListener &operator=(const SocketListener &) = delete;
+
+  // Bind and listen at path (an existing socket file is replaced)
+  bool listen(const std::string &path);
+
+  // Block until a worker connects; nullptr on failure
+  std::unique_ptr<SocketTransport> accept();
+
+  void close();
+
+private:
+  int fd = -1;
+  std::string path;
+};
+
+/**
+ * In-process transport pair, for running workers on threads (tests and
+ * benchmarks of the protocol without process overhead)
+ */
+class LoopbackTransport : public DistributedTransport {
+public:
+  static void create_pair(std::unique_ptr<LoopbackTransport> &first,
+                          std::unique_ptr<LoopbackTransport> &second);
+
+  bool send(const std::vector<uint8_t> &frame) override;
+  bool receive(std::vector<uint8_t> &frame) override;
+  void close() override;
+
+private:
+  struct Channel {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::vector<uint8_t>> frames;
+    bool closed = false;
+  };
+
+  std::shared_ptr<Channel> incoming;
+  std::shared_ptr<Channel> outgoing;
+};
+
+// ================================================================
+// Worker
+// ================================================================
+
+/**
+ * Distributed worker: owns one AtomSpaceShard and serves coordinator
+ * requests until shut down
+ */
+class DistributedWorker {
+public:
+  DistributedWorker(const ShardedNanoBrainConfig &config,
+                    std::unique_ptr<DistributedTransport> transport);
+
+  // Serve until a shutdown request (true) or a transport/protocol failure
+  // (false)
+  bool serve();
+
+  // Available once the coordinator has assigned the shard
+  AtomSpaceShard *get_shard() { return shard.get(); }
+
+private:
+  ShardedNanoBrainConfig config;
+  std::unique_ptr<DistributedTransport> transport;
+  std::unique_ptr<AtomSpaceShard> shard;
+};
+
+// ================================================================
+// Coordinator
+// ================================================================
+
+/**
+ * Distributed kernel metrics
+ */
+struct DistributedNanoBrainMetrics {
+  // Per-shard statistics as reported by the workers with their last cycle;
+  // exchange_ms is everything but the slowest worker's step (encoding,
+  // transport, routing and pairing)
+  ShardedNanoBrainMetrics sharded;
+
+  size_t worker_count = 0;
+  size_t bytes_sent = 0;     // Last cycle, all workers
+  size_t bytes_received = 0; // Last cycle, all workers
+};
+
+/**
+ * Distributed NanoBrain Coordinator
+ *
+ * Mirrors the ShardedNanoBrainKernel API, with one worker per shard.
+ * Workers are attached in shard order before initialize(); the shard count
+ * is the number of workers (config.shard_count is ignored). All methods
+ * must be called from one thread.
+ *
+ * Unlike the in-process kernel, a cross-shard create_inference() registers
+ * its ghost with the owning worker at the next cycle boundary, so the ghost
+ * is first refreshed one cycle later.
+ */
+class DistributedCoordinator {
+public:
+  explicit DistributedCoordinator(const ShardedNanoBrainConfig &config);
+  ~DistributedCoordinator();
+
+  DistributedCoordinator(const DistributedCoordinator &) = delete;
+  DistributedCoordinator &operator=(const DistributedCoordinator &) = delete;
+
+  // ================================================================
+  // Lifecycle
+  // ================================================================
+
+  void add_worker(std::unique_ptr<DistributedTransport> transport);
+
+  // Fork n local worker processes connected over socketpairs. Call before
+  // the coordinator process starts any threads. POSIX only.
+  bool spawn_local_workers(int n);
+
+  // Assign shards to the attached workers and initialize their kernels
+  bool initialize();
+
+  // Stop the workers (and reap spawned processes)
+  void shutdown();
+
+  bool is_active() const { return active; }
+  const std::string &get_last_error() const { return last_error; }
+
+  // ================================================================
+  // Atom Management
+  // ================================================================
+
+  std::string create_atom(const std::string &type, const std::string &name,
+                          const TruthValue &tv, const AttentionValue &av,
+                          const std::vector<int> &prime_encoding,
+                          const GeometricPattern &geometry);
+
+  // Copy of an atom from its owning worker
+  bool get_atom(const std::string &id, TimeCrystalAtom &out);
+
+  // Link two atoms; a cross-shard link lives on the first atom's shard
+  std::string create_inference(const std::string &atom1_id,
+                               const std::string &atom2_id,
+                               InferenceRuleType rule);
+
+  // ================================================================
+  // Processing Cycle
+  // ================================================================
+
+  // Send every worker its inbox, wait for all of them to step (the
+  // lockstep barrier), then route their outboxes and pair top atoms across
+  // shards for the next cycle. False if a worker failed; the coordinator is
+  // then inactive until initialize() assigns fresh shards.
+  bool process_cycle();
+  bool run_cycles(int n);
+
+  // ================================================================
+  // Partitioning
+  // ================================================================
+
+  int get_worker_count() const { return static_cast<int>(workers.size()); }
+  int select_shard(const std::string &name,
+                   const std::vector<int> &prime_encoding) const;
+
+  DistributedNanoBrainMetrics get_metrics() const;
+  size_t get_cycle_count() const { return cycle_count; }
+
+private:
+  struct WorkerLink {
+    std::unique_ptr<DistributedTransport> transport;
+    int pid = -1; // Spawned process, if any
+
+    ShardMailbox inbox;
+    std::vector<ShardMailbox> outbox; // Indexed by destination shard
+    std::vector<ShardCandidate> candidates;
+    ShardStatus status;
+  };
+
+  ShardedNanoBrainConfig config;
+  std::vector<WorkerLink> workers;
+  std::unique_ptr<ShardExchange> exchange;
+  bool active = false;
+  size_t cycle_count = 0;
+  std::string last_error;
+
+  // Atom types declared to every worker since initialize()
+  std::unordered_set<Symbol> declared_types;
+
+  // Last cycle statistics
+  size_t last_messages = 0;
+  size_t last_bytes_sent = 0;
+  size_t last_bytes_received = 0;
+  float last_cycle_ms = 0.0f;
+
+  // Send a request and wait for its reply (payload left in reply)
+  bool call(size_t worker, const std::vector<uint8_t> &request,
+            std::vector<uint8_t> &reply);
+  bool fail(const std::string &message);
+
+  // Drop the CycleDone frames still queued by the awaiting workers and
+  // deactivate, so no later request reads a stale reply
+  bool abort_cycle(const std::vector<bool> &awaiting,
+                   const std::string &message);
+};
+
+#endif // NANOBRAIN_DISTRIBUTED_H
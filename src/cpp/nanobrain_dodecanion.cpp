@@ -12,7 +12,7 @@
 // 12x12 multiplication table for dodecanion basis elements
 // e_i * e_j = sign * e_k
 // Based on Cayley-Dickson construction extended from octonions
-static const int DODECANION_MULT_TABLE[12][12] = {
+static constexpr int DODECANION_MULT_TABLE[12][12] = {
     // e0   e1   e2   e3   e4   e5   e6   e7   e8   e9  e10  e11
     {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},           // e0
     {1, -0, 3, -2, 5, -4, -7, 6, 9, -8, -11, 10},     // e1
@@ -29,7 +29,7 @@ static const int DODECANION_MULT_TABLE[12][12] = {
 };
 
 // Sign table for products
-static const int DODECANION_SIGN_TABLE[12][12] = {
+static constexpr int DODECANION_SIGN_TABLE[12][12] = {
     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},         // e0
     {1, -1, 1, -1, 1, -1, -1, 1, 1, -1, -1, 1},   // e1
     {1, -1, -1, 1, 1, 1, -1, -1, 1, 1, -1, -1},   // e2
@@ -44,17 +44,34 @@ static const int DODECANION_SIGN_TABLE[12][12] = {
     {1, -1, 1, 1, -1, -1, -1, -1, -1, -1, 1, -1}  // e11
 };
 
-BasisProduct get_basis_product(int i, int j) {
-  BasisProduct result;
-  int table_val = DODECANION_MULT_TABLE[i][j];
-  if (table_val >= 0) {
-    result.result_index = table_val;
-    result.sign = DODECANION_SIGN_TABLE[i][j];
-  } else {
-    result.result_index = -table_val;
-    result.sign = -DODECANION_SIGN_TABLE[i][j];
+// Products decoded from the two tables at compile time
+struct BasisProductTable {
+  BasisProduct products[12][12];
+};
+
+static constexpr BasisProductTable build_basis_products() {
+  BasisProductTable table{};
+  for (int i = 0; i < 12; i++) {
+    for (int j = 0; j < 12; j++) {
+      int table_val = DODECANION_MULT_TABLE[i][j];
+      BasisProduct &result = table.products[i][j];
+      if (table_val >= 0) {
+        result.result_index = table_val;
+        result.sign = DODECANION_SIGN_TABLE[i][j];
+      } else {
+        result.result_index = -table_val;
+        result.sign = -DODECANION_SIGN_TABLE[i][j];
+      }
+    }
   }
-  return result;
+  return table;
+}
+
+static constexpr BasisProductTable DODECANION_BASIS_PRODUCTS =
+    build_basis_products();
+
+BasisProduct get_basis_product(int i, int j) {
+  return DODECANION_BASIS_PRODUCTS.products[i][j];
 }
 
 // ================================================================
@@ -271,10 +288,7 @@ std::array<float, 11> Dodecanion::imaginary() const {
 // ================================================================
 
 NanoBrainTensor *Dodecanion::to_tensor(NanoBrainKernel *kernel) const {
-  NanoBrainTensor *tensor = kernel->create_tensor({12});
-  std::vector<float> data(components.begin(), components.end());
-  kernel->set_data(tensor, data);
-  return tensor;
+  return kernel->create_tensor_from(components.data(), components.size());
 }
 
 Dodecanion Dodecanion::from_tensor(NanoBrainTensor *tensor,
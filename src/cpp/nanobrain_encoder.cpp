@@ -74,26 +74,20 @@ size_t AtomSpaceTensorEncoder::hash_string(const std::string &str) const {
 // ================================================================
 
 NanoBrainTensor *AtomSpaceTensorEncoder::encode_truth_value(const float *tv) {
-  NanoBrainTensor *tensor = kernel->create_tensor({3});
-  std::vector<float> data = {
+  return kernel->create_tensor_from({
       tv[0],                         // strength
       tv[1],                         // confidence
       std::log(tv[2] + 1.0f) / 10.0f // count (log-scaled)
-  };
-  kernel->set_data(tensor, data);
-  return tensor;
+  });
 }
 
 NanoBrainTensor *
 AtomSpaceTensorEncoder::encode_attention_value(const float *av) {
-  NanoBrainTensor *tensor = kernel->create_tensor({3});
-  std::vector<float> data = {
+  return kernel->create_tensor_from({
       av[0] / 1000.0f,           // STI (normalized)
       av[1] / 1000.0f,           // LTI (normalized)
       av[2] > 0.5f ? 1.0f : 0.0f // VLTI (binary)
-  };
-  kernel->set_data(tensor, data);
-  return tensor;
+  });
 }
 
 // ================================================================
@@ -111,8 +105,7 @@ NodeTensor *AtomSpaceTensorEncoder::encode_atom(const Atom &atom) {
   nodeTensor->id = "node_tensor_" + atom.id;
   nodeTensor->atom_id = atom.id;
 
-  // Create 128-dimensional embedding tensor
-  nodeTensor->embedding = kernel->create_tensor({128}, GGML_TYPE_F32, true);
+  // 128-dimensional embedding, built on the host and copied in once
   nodeTensor->shape = {128};
 
   std::vector<float> embed_data(128, 0.0f);
@@ -154,18 +147,17 @@ NodeTensor *AtomSpaceTensorEncoder::encode_atom(const Atom &atom) {
 
   // Remaining positions are zero-initialized for future extensions
 
-  kernel->set_data(nodeTensor->embedding, embed_data);
+  nodeTensor->embedding = kernel->create_tensor_from(embed_data, true);
 
   // Create separate tensors for truth value and attention
   nodeTensor->truth_value_tensor = encode_truth_value(atom.truth_value);
   nodeTensor->attention_weights = encode_attention_value(atom.attention_value);
 
   // Create symbolic features tensor
-  nodeTensor->symbolic_features = kernel->create_tensor({128});
   std::vector<float> symbolic_data(128, 0.0f);
   // Symbolic features based on type
   symbolic_data[typeId % 128] = 1.0f; // One-hot for type
-  kernel->set_data(nodeTensor->symbolic_features, symbolic_data);
+  nodeTensor->symbolic_features = kernel->create_tensor_from(symbolic_data);
 
   // Cache and return
   node_embeddings[atom.id] = nodeTensor;
@@ -207,7 +199,6 @@ LinkTensor *AtomSpaceTensorEncoder::encode_link(const Link &link) {
   }
 
   // Create relation tensor (64-dimensional edge embedding)
-  linkTensor->relation_tensor = kernel->create_tensor({64});
   std::vector<float> relation_data(64, 0.0f);
 
   // Position 0: Link type encoding
@@ -250,12 +241,11 @@ LinkTensor *AtomSpaceTensorEncoder::encode_link(const Link &link) {
     }
   }
 
-  kernel->set_data(linkTensor->relation_tensor, relation_data);
+  linkTensor->relation_tensor = kernel->create_tensor_from(relation_data);
 
   // Create attention weights tensor
-  linkTensor->attention_weights = kernel->create_tensor({1});
-  std::vector<float> att_data = {link.attention_value[0] / 1000.0f};
-  kernel->set_data(linkTensor->attention_weights, att_data);
+  linkTensor->attention_weights =
+      kernel->create_tensor_from({link.attention_value[0] / 1000.0f});
 
   // Create truth value tensor
   linkTensor->truth_value_tensor = encode_truth_value(link.truth_value);
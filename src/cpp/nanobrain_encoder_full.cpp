@@ -114,11 +114,7 @@ AtomSpaceTensorEncoderFull::encode_atom(const AtomSpaceAtom &atom) {
   node_tensor->id = generate_node_tensor_id(atom.id);
   node_tensor->atom_id = atom.id;
 
-  // Create base embedding tensor
-  node_tensor->embedding =
-      kernel->create_tensor({static_cast<int64_t>(config.node_embedding_dim)});
-
-  // Initialize embedding data
+  // Base embedding, built on the host and copied in once
   std::vector<float> embed_data(config.node_embedding_dim, 0.0f);
 
   // Encode atom type (feature 0)
@@ -152,7 +148,7 @@ AtomSpaceTensorEncoderFull::encode_atom(const AtomSpaceAtom &atom) {
                                      (1000.0f * 60.0f * 60.0f * 24.0f));
   embed_data[9] = recency;
 
-  kernel->set_data(node_tensor->embedding, embed_data);
+  node_tensor->embedding = kernel->create_tensor_from(embed_data);
 
   // Encode truth value tensor
   node_tensor->truth_value_tensor = encode_truth_value(
@@ -220,11 +216,8 @@ AtomSpaceTensorEncoderFull::decode_atom(const NodeTensorFull *node_tensor) {
 NanoBrainTensor *
 AtomSpaceTensorEncoderFull::encode_truth_value(float strength, float confidence,
                                                float count) {
-  auto *tensor = kernel->create_tensor({3});
-  std::vector<float> data = {strength, confidence,
-                             std::log(count + 1.0f) / 10.0f};
-  kernel->set_data(tensor, data);
-  return tensor;
+  return kernel->create_tensor_from(
+      {strength, confidence, std::log(count + 1.0f) / 10.0f});
 }
 
 void AtomSpaceTensorEncoderFull::decode_truth_value(
@@ -247,10 +240,8 @@ void AtomSpaceTensorEncoderFull::decode_truth_value(
 NanoBrainTensor *AtomSpaceTensorEncoderFull::encode_attention_value(float sti,
                                                                     float lti,
                                                                     bool vlti) {
-  auto *tensor = kernel->create_tensor({3});
-  std::vector<float> data = {sti / 100.0f, lti / 100.0f, vlti ? 1.0f : 0.0f};
-  kernel->set_data(tensor, data);
-  return tensor;
+  return kernel->create_tensor_from(
+      {sti / 100.0f, lti / 100.0f, vlti ? 1.0f : 0.0f});
 }
 
 void AtomSpaceTensorEncoderFull::decode_attention_value(
@@ -284,11 +275,7 @@ AtomSpaceTensorEncoderFull::encode_link(const AtomSpaceLink &link) {
   link_tensor->id = generate_link_tensor_id(link.id);
   link_tensor->atom_id = link.id;
 
-  // Create relation tensor
-  link_tensor->relation_tensor =
-      kernel->create_tensor({static_cast<int64_t>(config.link_embedding_dim)});
-
-  // Initialize embedding data
+  // Relation embedding, built on the host and copied in once
   std::vector<float> embed_data(config.link_embedding_dim, 0.0f);
 
   // Encode link type (feature 0)
@@ -312,7 +299,7 @@ AtomSpaceTensorEncoderFull::encode_link(const AtomSpaceLink &link) {
   embed_data[9] = link.truth_confidence;
   embed_data[10] = std::log(link.truth_count + 1.0f) / 10.0f;
 
-  kernel->set_data(link_tensor->relation_tensor, embed_data);
+  link_tensor->relation_tensor = kernel->create_tensor_from(embed_data);
 
   // Parse source and target nodes
   // Convention: all but last outgoing are sources, last is target
@@ -389,9 +376,6 @@ AtomSpaceTensorEncoderFull::decode_link(const LinkTensorFull *link_tensor) {
 
 NanoBrainTensor *AtomSpaceTensorEncoderFull::create_symbolic_features(
     const AtomSpaceAtom &atom) {
-  auto *features = kernel->create_tensor(
-      {static_cast<int64_t>(config.symbolic_feature_dim)});
-
   std::vector<float> feat_data(config.symbolic_feature_dim, 0.0f);
 
   // Feature 0: Type complexity (length of type name)
@@ -420,15 +404,11 @@ NanoBrainTensor *AtomSpaceTensorEncoderFull::create_symbolic_features(
   // Feature 7: VLTI flag
   feat_data[7] = atom.vlti ? 1.0f : 0.0f;
 
-  kernel->set_data(features, feat_data);
-  return features;
+  return kernel->create_tensor_from(feat_data);
 }
 
 NanoBrainTensor *AtomSpaceTensorEncoderFull::create_link_symbolic_features(
     const AtomSpaceLink &link) {
-  auto *features = kernel->create_tensor(
-      {static_cast<int64_t>(config.symbolic_feature_dim)});
-
   std::vector<float> feat_data(config.symbolic_feature_dim, 0.0f);
 
   // Feature 0: Type complexity
@@ -455,8 +435,7 @@ NanoBrainTensor *AtomSpaceTensorEncoderFull::create_link_symbolic_features(
   // Feature 7: Truth combined score
   feat_data[7] = link.truth_strength * link.truth_confidence;
 
-  kernel->set_data(features, feat_data);
-  return features;
+  return kernel->create_tensor_from(feat_data);
 }
 
 int AtomSpaceTensorEncoderFull::calculate_symbolic_depth(
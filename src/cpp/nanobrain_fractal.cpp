@@ -4,7 +4,6 @@
 #include <cmath>
 #include <iostream>
 #include <numeric>
-#include <random>
 
 // ================================================================
 // CFGAOperator Implementation
@@ -98,7 +97,6 @@ NanoBrainTensor *CFGAOperator::diff(NanoBrainTensor *input, float dt) {
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> diff_data(n, 0.0f);
 
   // Forward difference for first element, central for middle, backward for last
@@ -117,8 +115,7 @@ NanoBrainTensor *CFGAOperator::diff(NanoBrainTensor *input, float dt) {
     }
   }
 
-  kernel->set_data(result, diff_data);
-  return result;
+  return kernel->create_tensor_from(diff_data);
 }
 
 NanoBrainTensor *CFGAOperator::integrate(NanoBrainTensor *input, float dt) {
@@ -126,7 +123,6 @@ NanoBrainTensor *CFGAOperator::integrate(NanoBrainTensor *input, float dt) {
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> int_data(n, 0.0f);
 
   float cumsum = 0.0f;
@@ -138,8 +134,7 @@ NanoBrainTensor *CFGAOperator::integrate(NanoBrainTensor *input, float dt) {
     int_data[i] = cumsum;
   }
 
-  kernel->set_data(result, int_data);
-  return result;
+  return kernel->create_tensor_from(int_data);
 }
 
 NanoBrainTensor *CFGAOperator::partial_diff(NanoBrainTensor *input,
@@ -157,9 +152,7 @@ NanoBrainTensor *CFGAOperator::rotate(NanoBrainTensor *input,
 
 NanoBrainTensor *CFGAOperator::scale(NanoBrainTensor *input,
                                      float scale_factor) {
-  NanoBrainTensor *scale_tensor = kernel->create_tensor({1});
-  std::vector<float> scale_data = {scale_factor};
-  kernel->set_data(scale_tensor, scale_data);
+  NanoBrainTensor *scale_tensor = kernel->create_tensor_from({scale_factor});
   return kernel->mul(input, scale_tensor);
 }
 
@@ -179,9 +172,7 @@ NanoBrainTensor *CFGAOperator::reflect(NanoBrainTensor *input,
   auto *norm_sq = kernel->sum(kernel->mul(normal, normal));
   auto *scale_val = kernel->div(dot, norm_sq);
 
-  NanoBrainTensor *two = kernel->create_tensor({1});
-  std::vector<float> two_data = {2.0f};
-  kernel->set_data(two, two_data);
+  NanoBrainTensor *two = kernel->create_tensor_from({2.0f});
 
   auto *scaled_normal = kernel->mul(kernel->mul(two, scale_val), normal);
   return kernel->sub(input, scaled_normal);
@@ -199,9 +190,6 @@ CFGAOperator::decompose(NanoBrainTensor *input) {
   int n = ggml_nelements(input->ggml_tensor);
   int half = n / 2;
 
-  NanoBrainTensor *first = kernel->create_tensor({half});
-  NanoBrainTensor *second = kernel->create_tensor({n - half});
-
   std::vector<float> first_data(half), second_data(n - half);
   for (int i = 0; i < half; i++) {
     first_data[i] = kernel->get_value(input, i);
@@ -210,8 +198,8 @@ CFGAOperator::decompose(NanoBrainTensor *input) {
     second_data[i - half] = kernel->get_value(input, i);
   }
 
-  kernel->set_data(first, first_data);
-  kernel->set_data(second, second_data);
+  NanoBrainTensor *first = kernel->create_tensor_from(first_data);
+  NanoBrainTensor *second = kernel->create_tensor_from(second_data);
 
   return {first, second};
 }
@@ -235,9 +223,8 @@ CFGAOperator::make_pipeline(const std::vector<CFGAOperation> &ops) {
 }
 
 float CFGAOperator::benchmark_operation(CFGAOperation op, int iterations) {
-  auto *test_tensor = kernel->create_tensor({100});
   std::vector<float> test_data(100, 1.0f);
-  kernel->set_data(test_tensor, test_data);
+  auto *test_tensor = kernel->create_tensor_from(test_data);
 
   auto start = std::chrono::high_resolution_clock::now();
 
@@ -276,9 +263,6 @@ void FractalHarmonicOscillator::initialize(
     const std::vector<float> &initial_position,
     const std::vector<float> &initial_momentum) {
 
-  state.position = kernel->create_tensor({static_cast<int64_t>(dimension)});
-  state.momentum = kernel->create_tensor({static_cast<int64_t>(dimension)});
-
   std::vector<float> pos_data(dimension, 0.0f);
   std::vector<float> mom_data(dimension, 0.0f);
 
@@ -293,8 +277,8 @@ void FractalHarmonicOscillator::initialize(
     mom_data[i] = initial_momentum[i];
   }
 
-  kernel->set_data(state.position, pos_data);
-  kernel->set_data(state.momentum, mom_data);
+  state.position = kernel->create_tensor_from(pos_data);
+  state.momentum = kernel->create_tensor_from(mom_data);
 
   state.energy = compute_hamiltonian();
   state.phase = 0.0f;
@@ -432,7 +416,6 @@ FractalHarmonicOscillator::apply_fractal_filter(NanoBrainTensor *input) {
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> filtered(n);
 
   // Self-similar averaging at multiple scales
@@ -461,8 +444,7 @@ FractalHarmonicOscillator::apply_fractal_filter(NanoBrainTensor *input) {
     filtered[i] = (weight > 0) ? sum / weight : kernel->get_value(input, i);
   }
 
-  kernel->set_data(result, filtered);
-  return result;
+  return kernel->create_tensor_from(filtered);
 }
 
 float FractalHarmonicOscillator::get_fractal_dimension() const {
@@ -505,18 +487,18 @@ float FractalHarmonicOscillator::get_time() const { return simulation_time; }
 // ================================================================
 
 FractalInterference::FractalInterference(NanoBrainKernel *kernel)
-    : kernel(kernel), interference_pattern(nullptr), simulation_steps(0) {
+    : kernel(kernel), interference_pattern(nullptr), simulation_steps(0),
+      seed(kernel ? kernel->get_seed() : NANOBRAIN_DEFAULT_SEED) {
   tubulin_states.resize(100, 0.5f);
 }
 
 void FractalInterference::simulate_microtubule(int steps) {
   // Simulate tubulin conformational dynamics
-  static std::mt19937 rng(42);
-  static std::uniform_real_distribution<float> dist(-0.1f, 0.1f);
-
   for (int step = 0; step < steps; step++) {
     // Update each tubulin based on neighbors (cellular automaton style)
     std::vector<float> new_states(tubulin_states.size());
+    CounterRng rng(seed, RandomSubsystem::Microtubule, 0,
+                   static_cast<uint64_t>(simulation_steps + step));
 
     for (size_t i = 0; i < tubulin_states.size(); i++) {
       float left = (i > 0) ? tubulin_states[i - 1] : tubulin_states.back();
@@ -526,7 +508,8 @@ void FractalInterference::simulate_microtubule(int steps) {
 
       // Fractal interference rule
       float interference = 0.5f * (left + right) - current;
-      new_states[i] = current + 0.1f * interference + dist(rng);
+      new_states[i] =
+          current + 0.1f * interference + rng.uniform(-0.1f, 0.1f);
 
       // Clamp to [0, 1]
       new_states[i] = std::max(0.0f, std::min(1.0f, new_states[i]));
@@ -538,9 +521,7 @@ void FractalInterference::simulate_microtubule(int steps) {
   simulation_steps += steps;
 
   // Update interference pattern tensor
-  interference_pattern =
-      kernel->create_tensor({static_cast<int64_t>(tubulin_states.size())});
-  kernel->set_data(interference_pattern, tubulin_states);
+  interference_pattern = kernel->create_tensor_from(tubulin_states);
 }
 
 NanoBrainTensor *FractalInterference::get_interference_pattern() const {
@@ -624,7 +605,6 @@ RegulatoryEquations::project_from_infinity(NanoBrainTensor *input) {
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *output = kernel->create_tensor({n});
   std::vector<float> projected(n);
 
   float max_val = 0.0f;
@@ -639,7 +619,7 @@ RegulatoryEquations::project_from_infinity(NanoBrainTensor *input) {
     projected[i] = val * projection_factor;
   }
 
-  kernel->set_data(output, projected);
+  NanoBrainTensor *output = kernel->create_tensor_from(projected);
 
   result.output = output;
   result.projection_factor = projection_factor;
@@ -658,7 +638,6 @@ RegulatoryEquations::future_to_present_impact(NanoBrainTensor *future_state,
   kernel->compute(future_state);
   int n = ggml_nelements(future_state->ggml_tensor);
 
-  NanoBrainTensor *output = kernel->create_tensor({n});
   std::vector<float> attenuated(n);
 
   float decay = std::exp(-time_horizon);
@@ -667,7 +646,7 @@ RegulatoryEquations::future_to_present_impact(NanoBrainTensor *future_state,
     attenuated[i] = kernel->get_value(future_state, i) * decay;
   }
 
-  kernel->set_data(output, attenuated);
+  NanoBrainTensor *output = kernel->create_tensor_from(attenuated);
 
   result.output = output;
   result.projection_factor = decay;
@@ -681,15 +660,13 @@ NanoBrainTensor *RegulatoryEquations::time_reversal(NanoBrainTensor *state) {
   kernel->compute(state);
   int n = ggml_nelements(state->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> reversed(n);
 
   for (int i = 0; i < n; i++) {
     reversed[i] = kernel->get_value(state, n - 1 - i);
   }
 
-  kernel->set_data(result, reversed);
-  return result;
+  return kernel->create_tensor_from(reversed);
 }
 
 NanoBrainTensor *
@@ -698,7 +675,6 @@ RegulatoryEquations::boundary_at_infinity(NanoBrainTensor *input) {
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> bounded(n);
 
   int center = n / 2;
@@ -708,8 +684,7 @@ RegulatoryEquations::boundary_at_infinity(NanoBrainTensor *input) {
     bounded[i] = kernel->get_value(input, i) * decay;
   }
 
-  kernel->set_data(result, bounded);
-  return result;
+  return kernel->create_tensor_from(bounded);
 }
 
 NanoBrainTensor *
@@ -720,9 +695,7 @@ RegulatoryEquations::asymptotic_regulation(NanoBrainTensor *input) {
 
 NanoBrainTensor *RegulatoryEquations::scale_invariance(NanoBrainTensor *input,
                                                        float scale) {
-  NanoBrainTensor *scale_tensor = kernel->create_tensor({1});
-  std::vector<float> scale_data = {1.0f / scale};
-  kernel->set_data(scale_tensor, scale_data);
+  NanoBrainTensor *scale_tensor = kernel->create_tensor_from({1.0f / scale});
   return kernel->mul(input, scale_tensor);
 }
 
@@ -730,8 +703,7 @@ NanoBrainTensor *RegulatoryEquations::fractal_recursion(NanoBrainTensor *input,
                                                         int depth) {
   NanoBrainTensor *result = input;
   for (int d = 0; d < depth; d++) {
-    auto *half = kernel->mul(result, kernel->create_tensor({1}));
-    kernel->set_data(half, std::vector<float>{0.5f});
+    auto *half = kernel->mul(result, kernel->create_tensor_from({0.5f}));
     result = kernel->add(result, half);
     kernel->compute(result);
   }
@@ -745,7 +717,6 @@ RegulatoryEquations::prime_resonance(NanoBrainTensor *input,
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> resonated(n);
 
   for (int i = 0; i < n; i++) {
@@ -757,8 +728,7 @@ RegulatoryEquations::prime_resonance(NanoBrainTensor *input,
         kernel->get_value(input, i) * (1.0f + 0.1f * sum / primes.size());
   }
 
-  kernel->set_data(result, resonated);
-  return result;
+  return kernel->create_tensor_from(resonated);
 }
 
 NanoBrainTensor *
@@ -772,7 +742,6 @@ NanoBrainTensor *RegulatoryEquations::phase_alignment(NanoBrainTensor *input,
   kernel->compute(input);
   int n = ggml_nelements(input->ggml_tensor);
 
-  NanoBrainTensor *result = kernel->create_tensor({n});
   std::vector<float> aligned(n);
 
   for (int i = 0; i < n; i++) {
@@ -782,8 +751,7 @@ NanoBrainTensor *RegulatoryEquations::phase_alignment(NanoBrainTensor *input,
     aligned[i] = val * std::cos(phase_diff);
   }
 
-  kernel->set_data(result, aligned);
-  return result;
+  return kernel->create_tensor_from(aligned);
 }
 
 NanoBrainTensor *
@@ -795,8 +763,7 @@ RegulatoryEquations::energy_conservation(NanoBrainTensor *input,
 
   if (current_energy > 1e-10f) {
     float scale = std::sqrt(total_energy / current_energy);
-    NanoBrainTensor *scale_tensor = kernel->create_tensor({1});
-    kernel->set_data(scale_tensor, std::vector<float>{scale});
+    NanoBrainTensor *scale_tensor = kernel->create_tensor_from({scale});
     return kernel->mul(input, scale_tensor);
   }
   return input;
@@ -810,8 +777,7 @@ RegulatoryEquations::information_preservation(NanoBrainTensor *input) {
   float n = kernel->get_value(norm, 0);
 
   if (n > 1e-10f) {
-    NanoBrainTensor *inv_norm = kernel->create_tensor({1});
-    kernel->set_data(inv_norm, std::vector<float>{1.0f / n});
+    NanoBrainTensor *inv_norm = kernel->create_tensor_from({1.0f / n});
     return kernel->mul(input, inv_norm);
   }
   return input;
@@ -832,7 +798,7 @@ RegulatoryEquations::coherence_maximization(NanoBrainTensor *input) {
 NanoBrainTensor *RegulatoryEquations::unity_boundary(
     const std::vector<NanoBrainTensor *> &inputs) {
   if (inputs.empty()) {
-    return kernel->create_tensor({1});
+    return kernel->create_tensor({1}, TensorInitPolicy::zero());
   }
 
   NanoBrainTensor *result = inputs[0];
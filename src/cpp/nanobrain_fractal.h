@@ -294,6 +294,7 @@ private:
   NanoBrainTensor *interference_pattern;
   std::vector<float> tubulin_states;
   int simulation_steps;
+  uint64_t seed; // Counter RNG seed, from the kernel config
 };
 
 // ================================================================
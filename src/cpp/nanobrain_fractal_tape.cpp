@@ -443,11 +443,15 @@ SelfAssemblyState FractalTape::step_assembly() {
   // Get copy of cell IDs to avoid modifying during iteration
   auto cell_ids = get_all_cell_ids();
 
-  for (const auto &cell_id : cell_ids) {
-    auto *cell = get_cell(cell_id);
+  for (size_t c = 0; c < cell_ids.size(); c++) {
+    auto *cell = get_cell(cell_ids[c]);
     if (!cell)
       continue;
 
+    // One stream per (cell, generation), one draw per matching rule
+    CounterRng rng(config.seed, RandomSubsystem::FractalTape, c,
+                   static_cast<uint64_t>(assembly_state.generation));
+
     for (auto &[rule_id, rule] : rules) {
       // Check if rule can apply to this cell
       bool primes_match = false;
@@ -464,8 +468,7 @@ SelfAssemblyState FractalTape::step_assembly() {
 
       if (primes_match) {
         // Apply with probability
-        float r = static_cast<float>(rand()) / RAND_MAX;
-        if (r < rule.probability) {
+        if (rng.uniform() < rule.probability) {
           apply_rule(rule, *cell);
           assembly_state.applied_rules.push_back(rule_id);
           rules_applied++;
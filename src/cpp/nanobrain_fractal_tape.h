@@ -37,6 +37,7 @@ struct FractalTapeConfig {
   float scale_ratio = 0.618f; // Golden ratio inverse
   bool enable_self_assembly = true;
   bool enable_sphere_surgery = true;
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED; // Self-assembly rule draws
 };
 
 // ================================================================
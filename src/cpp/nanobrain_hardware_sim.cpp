@@ -2,7 +2,6 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
-#include <random>
 
 // ================================================================
 // HardwareSimulator Implementation
@@ -24,6 +23,7 @@ HardwareSimulator::~HardwareSimulator() = default;
 void HardwareSimulator::initialize() {
   microtubules.clear();
   simulation_time = 0.0f;
+  thermal_steps = 0;
   mt_counter = 0;
   thermal_state.current_temperature = thermal_config.base_temperature;
   initialized = true;
@@ -56,9 +56,8 @@ float HardwareSimulator::current_temperature() const {
 }
 
 void HardwareSimulator::update_thermal(float dt) {
-  static std::random_device rd;
-  static std::mt19937 gen(rd());
-  std::normal_distribution<float> noise(0.0f, thermal_config.thermal_noise);
+  CounterRng rng(thermal_config.seed, RandomSubsystem::HardwareThermal, 0,
+                 thermal_steps++);
 
   float phase = simulation_time * thermal_config.frequency * 2.0f * M_PI;
   float base = thermal_config.base_temperature;
@@ -101,7 +100,8 @@ void HardwareSimulator::update_thermal(float dt) {
   }
 
   // Add noise
-  thermal_state.current_temperature += noise(gen);
+  thermal_state.current_temperature +=
+      rng.normal(0.0f, thermal_config.thermal_noise);
 
   // Update thermodynamic quantities
   float T = thermal_state.current_temperature;
@@ -45,6 +45,7 @@ struct ThermalConfig {
   BreathingMode mode = BreathingMode::Sinusoidal;
   float frequency = 0.1f; // Hz
   float thermal_noise = 0.01f;
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED; // Thermal noise draws
 };
 
 struct ThermalState {
@@ -183,6 +184,7 @@ private:
   ThermalState thermal_state;
   bool initialized = false;
   float simulation_time = 0.0f;
+  uint64_t thermal_steps = 0; // Counter RNG step
 
   // Microtubule storage
   std::vector<Microtubule> microtubules;
@@ -328,7 +328,6 @@ MagneticKnot MagneticKnotGenerator::generate_spin_knot(KnotType type) {
   }
 
   // Create embedding tensor (N x 3)
-  knot.embedding = kernel->create_tensor({static_cast<int>(curve.size()), 3});
   std::vector<float> embed_data;
   embed_data.reserve(curve.size() * 3);
   for (const auto &p : curve) {
@@ -336,7 +335,9 @@ MagneticKnot MagneticKnotGenerator::generate_spin_knot(KnotType type) {
     embed_data.push_back(p[1]);
     embed_data.push_back(p[2]);
   }
-  kernel->set_data(knot.embedding, embed_data);
+  knot.embedding = kernel->create_tensor_from(
+      {static_cast<int64_t>(curve.size()), 3}, embed_data.data(),
+      embed_data.size());
 
   // Compute rope length (arc length)
   float length = 0.0f;
@@ -392,8 +393,14 @@ MagneticKnot MagneticKnotGenerator::generate_custom_knot(
   }
 
   // Create tensor as for standard knots
-  knot.embedding = kernel->create_tensor({static_cast<int>(curve.size()), 3});
-  // ... populate tensor
+  std::vector<float> embed_data;
+  embed_data.reserve(curve.size() * 3);
+  for (const auto &p : curve) {
+    embed_data.insert(embed_data.end(), p.begin(), p.end());
+  }
+  knot.embedding = kernel->create_tensor_from(
+      {static_cast<int64_t>(curve.size()), 3}, embed_data.data(),
+      embed_data.size());
 
   return knot;
 }
@@ -511,15 +518,10 @@ NanoBrainTensor *
 MagneticKnotGenerator::compute_magnetic_field(const MagneticKnot &knot) {
   // Create field tensor (grid resolution x 3)
   int grid_size = 32;
-  NanoBrainTensor *field =
-      kernel->create_tensor({grid_size, grid_size, grid_size, 3});
-
   // Simplified Biot-Savart calculation would go here
   // For now, return zero-initialized tensor
-  std::vector<float> field_data(grid_size * grid_size * grid_size * 3, 0.0f);
-  kernel->set_data(field, field_data);
-
-  return field;
+  return kernel->create_tensor({grid_size, grid_size, grid_size, 3},
+                               TensorInitPolicy::zero());
 }
 
 // ================================================================
@@ -1,14 +1,22 @@
 #include "nanobrain_kernel.h"
+#include "nanobrain_trace.h"
+#include <algorithm>
 #include <cmath>
-#include <ctime>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <random>
+#include <sstream>
+
+NanoBrainKernel::NanoBrainKernel(NanoBrainConfig config) : config(config) {
+  // Provisioned memory is ready (faulted, locked, bound) before the first
+  // cycle; without provisioning ggml allocates the context itself
+  if (config.memory_provisioning.enabled()) {
+    context_memory.allocate(config.memory_size, config.memory_provisioning);
+  }
 
-NanoBrainKernel::NanoBrainKernel(NanoBrainConfig config) {
   struct ggml_init_params params = {
       /*.mem_size   =*/config.memory_size,
-      /*.mem_buffer =*/NULL,
+      /*.mem_buffer =*/context_memory.data(),
       /*.no_alloc   =*/false,
   };
 
@@ -17,14 +25,30 @@ NanoBrainKernel::NanoBrainKernel(NanoBrainConfig config) {
     std::cerr << "Failed to initialize GGML context" << std::endl;
   }
 
-  // Seed random number generator
-  std::srand(static_cast<unsigned int>(std::time(nullptr)));
+  if (config.scratch_size > 0 &&
+      scratch_memory.allocate(config.scratch_size,
+                              config.memory_provisioning)) {
+    struct ggml_init_params scratch_params = {
+        /*.mem_size   =*/scratch_memory.size(),
+        /*.mem_buffer =*/scratch_memory.data(),
+        /*.no_alloc   =*/false,
+    };
+    scratch_ctx = ggml_init(scratch_params);
+    if (!scratch_ctx) {
+      std::cerr << "Failed to initialize GGML scratch context" << std::endl;
+    }
+  }
+
+  cycle_start_time = std::chrono::steady_clock::now();
 }
 
 NanoBrainKernel::~NanoBrainKernel() {
   if (this->ctx) {
     ggml_free(this->ctx);
   }
+  if (scratch_ctx) {
+    ggml_free(scratch_ctx);
+  }
   // Clean up NanoBrainTensor wrappers
   for (auto const &[id, tensor] : this->tensors) {
     delete tensor;
@@ -36,6 +60,36 @@ std::string NanoBrainKernel::generate_id() {
   return "tensor_" + std::to_string(counter++);
 }
 
+void NanoBrainKernel::init_tensor(NanoBrainTensor *tensor,
+                                  const TensorInitPolicy &init) {
+  struct ggml_tensor *t = tensor->ggml_tensor;
+  const size_t count = static_cast<size_t>(ggml_nelements(t));
+  float *data = static_cast<float *>(t->data);
+
+  if (t->type != GGML_TYPE_F32) {
+    if (init.mode != TensorInit::Uninitialized)
+      memset(t->data, 0, ggml_nbytes(t));
+    return;
+  }
+
+  switch (init.mode) {
+  case TensorInit::Uninitialized:
+    break;
+  case TensorInit::Zero:
+    memset(data, 0, count * sizeof(float));
+    break;
+  case TensorInit::Constant:
+    std::fill(data, data + count, init.value);
+    break;
+  case TensorInit::Xavier:
+    random_init(tensor);
+    break;
+  case TensorInit::FromBuffer:
+    memcpy(data, init.data, count * sizeof(float));
+    break;
+  }
+}
+
 void NanoBrainKernel::random_init(NanoBrainTensor *tensor) {
   if (!tensor || !tensor->ggml_tensor)
     return;
@@ -52,9 +106,10 @@ void NanoBrainKernel::random_init(NanoBrainTensor *tensor) {
                               ? t->ne[1]
                               : 1))); // ne is number of elements per dimension
 
-  for (int64_t i = 0; i < size; i++) {
-    data[i] = ((float)std::rand() / RAND_MAX - 0.5f) * 2.0f * limit;
-  }
+  CounterRng rng(config.seed, RandomSubsystem::TensorInit,
+                 tensors_initialized++);
+  rng.fill_uniform(data, static_cast<size_t>(size), -limit, limit,
+                   config.thread_pool);
 }
 
 void NanoBrainKernel::set_data(NanoBrainTensor *tensor,
@@ -75,21 +130,45 @@ void NanoBrainKernel::set_data(NanoBrainTensor *tensor,
 NanoBrainTensor *NanoBrainKernel::create_tensor(std::vector<int64_t> shape,
                                                 ggml_type dtype,
                                                 bool requires_grad) {
+  // A buffer fill needs a buffer
+  TensorInitPolicy init{config.default_init};
+  if (init.mode == TensorInit::FromBuffer)
+    init.mode = TensorInit::Zero;
+  return create_tensor(std::move(shape), init, dtype, requires_grad);
+}
+
+NanoBrainTensor *NanoBrainKernel::create_tensor(std::vector<int64_t> shape,
+                                                const TensorInitPolicy &init,
+                                                ggml_type dtype,
+                                                bool requires_grad) {
+  size_t elements = 1;
+  for (int64_t dim : shape) {
+    elements *= static_cast<size_t>(dim);
+  }
+  if (init.mode == TensorInit::FromBuffer &&
+      (dtype != GGML_TYPE_F32 || !init.data || init.size != elements)) {
+    std::cerr << "[NanoBrainKernel] Buffer of " << init.size
+              << " floats does not match a tensor of " << elements
+              << " elements" << std::endl;
+    return nullptr;
+  }
+  reserve(elements * ggml_type_size(dtype));
+
   NanoBrainTensor *tensor = new NanoBrainTensor();
   tensor->id = generate_id();
   tensor->requires_grad = requires_grad;
   tensor->gradient = nullptr;
 
   if (shape.size() == 1) {
-    tensor->ggml_tensor = ggml_new_tensor_1d(this->ctx, dtype, shape[0]);
+    tensor->ggml_tensor = ggml_new_tensor_1d(alloc_ctx(), dtype, shape[0]);
   } else if (shape.size() == 2) {
     tensor->ggml_tensor =
-        ggml_new_tensor_2d(this->ctx, dtype, shape[0], shape[1]);
+        ggml_new_tensor_2d(alloc_ctx(), dtype, shape[0], shape[1]);
   } else if (shape.size() == 3) {
-    tensor->ggml_tensor =
-        ggml_new_tensor_3d(this->ctx, dtype, shape[0], shape[1], shape[2]);
+    tensor->ggml_tensor = ggml_new_tensor_3d(alloc_ctx(), dtype, shape[0],
+                                             shape[1], shape[2]);
   } else if (shape.size() == 4) {
-    tensor->ggml_tensor = ggml_new_tensor_4d(this->ctx, dtype, shape[0],
+    tensor->ggml_tensor = ggml_new_tensor_4d(alloc_ctx(), dtype, shape[0],
                                              shape[1], shape[2], shape[3]);
   } else {
     std::cerr << "Unsupported tensor dimension: " << shape.size() << std::endl;
@@ -102,46 +181,95 @@ NanoBrainTensor *NanoBrainKernel::create_tensor(std::vector<int64_t> shape,
     // tensor->gradient = ...
   }
 
-  // Initialize data
-  random_init(tensor);
+  init_tensor(tensor, init);
 
-  this->tensors[tensor->id] = tensor;
+  register_tensor(tensor);
   return tensor;
 }
 
+NanoBrainTensor *NanoBrainKernel::create_tensor_from(const float *data,
+                                                     size_t count,
+                                                     bool requires_grad) {
+  return create_tensor({static_cast<int64_t>(count)},
+                       TensorInitPolicy::from_buffer(data, count),
+                       GGML_TYPE_F32, requires_grad);
+}
+
+NanoBrainTensor *
+NanoBrainKernel::create_tensor_from(const std::vector<float> &data,
+                                    bool requires_grad) {
+  return create_tensor_from(data.data(), data.size(), requires_grad);
+}
+
+NanoBrainTensor *
+NanoBrainKernel::create_tensor_from(std::initializer_list<float> data) {
+  return create_tensor_from(data.begin(), data.size());
+}
+
+NanoBrainTensor *NanoBrainKernel::create_tensor_from(
+    std::vector<int64_t> shape, const float *data, size_t count,
+    bool requires_grad) {
+  return create_tensor(std::move(shape),
+                       TensorInitPolicy::from_buffer(data, count),
+                       GGML_TYPE_F32, requires_grad);
+}
+
 NanoBrainTensor *NanoBrainKernel::matmul(NanoBrainTensor *a,
                                          NanoBrainTensor *b) {
+  // mul_mat yields [a.ne1, b.ne1, b.ne2, b.ne3] in F32
+  const struct ggml_tensor *ta = a->ggml_tensor;
+  const struct ggml_tensor *tb = b->ggml_tensor;
+  reserve(sizeof(float) * ta->ne[1] * tb->ne[1] * tb->ne[2] * tb->ne[3]);
+
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad || b->requires_grad;
 
   // ggml_mul_mat computes A * B^T typically, or standard matmul depending on
   // newness. Assuming standard matrix multiplication A * B
-  result->ggml_tensor = ggml_mul_mat(this->ctx, a->ggml_tensor, b->ggml_tensor);
+  result->ggml_tensor =
+      ggml_mul_mat(alloc_ctx(), a->ggml_tensor, b->ggml_tensor);
 
-  this->tensors[result->id] = result;
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::add(NanoBrainTensor *a, NanoBrainTensor *b) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad || b->requires_grad;
 
-  result->ggml_tensor = ggml_add(this->ctx, a->ggml_tensor, b->ggml_tensor);
+  result->ggml_tensor = ggml_add(alloc_ctx(), a->ggml_tensor, b->ggml_tensor);
 
-  this->tensors[result->id] = result;
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::softmax(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
 
-  result->ggml_tensor = ggml_soft_max(this->ctx, a->ggml_tensor);
+  result->ggml_tensor = ggml_soft_max(alloc_ctx(), a->ggml_tensor);
 
-  this->tensors[result->id] = result;
+  register_tensor(result);
+  return result;
+}
+
+NanoBrainTensor *NanoBrainKernel::transpose(NanoBrainTensor *a) {
+  // Two tensor objects: the transposed view, and its contiguous copy with
+  // the copy's data
+  reserve(ggml_nbytes(a->ggml_tensor) + 2 * ggml_tensor_overhead());
+  NanoBrainTensor *result = new NanoBrainTensor();
+  result->id = generate_id();
+  result->requires_grad = a->requires_grad;
+
+  result->ggml_tensor =
+      ggml_cont(alloc_ctx(), ggml_transpose(alloc_ctx(), a->ggml_tensor));
+
+  register_tensor(result);
   return result;
 }
 
@@ -159,101 +287,122 @@ NanoBrainTensor *NanoBrainKernel::contract(NanoBrainTensor *a,
 }
 
 NanoBrainTensor *NanoBrainKernel::sub(NanoBrainTensor *a, NanoBrainTensor *b) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad || b->requires_grad;
-  result->ggml_tensor = ggml_sub(this->ctx, a->ggml_tensor, b->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_sub(alloc_ctx(), a->ggml_tensor, b->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::mul(NanoBrainTensor *a, NanoBrainTensor *b) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad || b->requires_grad;
-  result->ggml_tensor = ggml_mul(this->ctx, a->ggml_tensor, b->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_mul(alloc_ctx(), a->ggml_tensor, b->ggml_tensor);
+  register_tensor(result);
+  return result;
+}
+
+NanoBrainTensor *NanoBrainKernel::mul_scalar(NanoBrainTensor *a, float s) {
+  reserve(ggml_nbytes(a->ggml_tensor));
+  NanoBrainTensor *result = new NanoBrainTensor();
+  result->id = generate_id();
+  result->requires_grad = a->requires_grad;
+  result->ggml_tensor = ggml_scale(alloc_ctx(), a->ggml_tensor, s);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::div(NanoBrainTensor *a, NanoBrainTensor *b) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad || b->requires_grad;
-  result->ggml_tensor = ggml_div(this->ctx, a->ggml_tensor, b->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_div(alloc_ctx(), a->ggml_tensor, b->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::sin(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_sin(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_sin(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::cos(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_cos(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_cos(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::sqrt(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_sqrt(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_sqrt(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::abs(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_abs(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_abs(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::log(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_log(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_log(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::exp(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_exp(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_exp(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::sum(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_sum(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_sum(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
 NanoBrainTensor *NanoBrainKernel::mean(NanoBrainTensor *a) {
+  reserve(ggml_nbytes(a->ggml_tensor));
   NanoBrainTensor *result = new NanoBrainTensor();
   result->id = generate_id();
   result->requires_grad = a->requires_grad;
-  result->ggml_tensor = ggml_mean(this->ctx, a->ggml_tensor);
-  this->tensors[result->id] = result;
+  result->ggml_tensor = ggml_mean(alloc_ctx(), a->ggml_tensor);
+  register_tensor(result);
   return result;
 }
 
@@ -271,11 +420,8 @@ NanoBrainTensor *NanoBrainKernel::compute_coherence(NanoBrainTensor *primes) {
   NanoBrainTensor *p_sum = sum(primes);
   NanoBrainTensor *p_sqrt_prod = sqrt(p_prod);
 
-  NanoBrainTensor *t_pi = create_tensor({1});
-  ((float *)t_pi->ggml_tensor->data)[0] = 3.1415926535f;
-
-  NanoBrainTensor *t_half = create_tensor({1});
-  ((float *)t_half->ggml_tensor->data)[0] = 0.5f;
+  NanoBrainTensor *t_pi = create_tensor_from({3.1415926535f});
+  NanoBrainTensor *t_half = create_tensor_from({0.5f});
 
   NanoBrainTensor *num = mul(p_sqrt_prod, t_pi);
   NanoBrainTensor *arg = div(num, p_sum);
@@ -288,9 +434,73 @@ NanoBrainTensor *NanoBrainKernel::compute_coherence(NanoBrainTensor *primes) {
 }
 
 void NanoBrainKernel::compute(NanoBrainTensor *target) {
-  struct ggml_cgraph *gf = ggml_new_graph(this->ctx);
+  NB_TRACE_SCOPE("kernel", "NanoBrainKernel::compute");
+  if (!target)
+    return;
+  reserve(ggml_graph_overhead());
+
+  // The graph comes out of the context; the work buffer is kept by the
+  // kernel, as for persistent graphs, so a full context cannot trip ggml
+  struct ggml_context *graph_ctx = alloc_ctx();
+  size_t used_before = ggml_used_mem(graph_ctx);
+
+  struct ggml_cgraph *gf = ggml_new_graph(graph_ctx);
   ggml_build_forward_expand(gf, target->ggml_tensor);
-  ggml_graph_compute_with_ctx(this->ctx, gf, 1); // 1 thread for simplicity
+  struct ggml_cplan plan = ggml_graph_plan(gf, 1); // 1 thread for simplicity
+  if (plan.work_size > compute_work.size())
+    compute_work.resize(plan.work_size);
+  plan.work_data = compute_work.empty() ? nullptr : compute_work.data();
+  ggml_graph_compute(gf, &plan);
+
+  size_t graph_bytes = ggml_used_mem(graph_ctx) - used_before;
+  tag_stats[allocation_tag].bytes += graph_bytes;
+  memory.allocated_bytes += graph_bytes;
+}
+
+NanoBrainGraph *NanoBrainKernel::build_graph(NanoBrainTensor *target,
+                                             int threads) {
+  if (!target)
+    return nullptr;
+  reserve(ggml_graph_overhead());
+
+  struct ggml_context *graph_ctx = alloc_ctx();
+  size_t used_before = ggml_used_mem(graph_ctx);
+
+  auto graph = std::make_unique<NanoBrainGraph>();
+  graph->graph = ggml_new_graph(graph_ctx);
+  ggml_build_forward_expand(graph->graph, target->ggml_tensor);
+  graph->output = target;
+  graph->threads = std::max(1, threads);
+
+  size_t graph_bytes = ggml_used_mem(graph_ctx) - used_before;
+  tag_stats[allocation_tag].bytes += graph_bytes;
+  memory.allocated_bytes += graph_bytes;
+
+  graphs.push_back(std::move(graph));
+  return graphs.back().get();
+}
+
+void NanoBrainKernel::compute_graph(NanoBrainGraph *graph) {
+  NB_TRACE_SCOPE("kernel", "NanoBrainKernel::compute_graph");
+  if (!graph || !graph->graph)
+    return;
+
+  // The work buffer lives with the graph instead of the context
+  struct ggml_cplan plan = ggml_graph_plan(graph->graph, graph->threads);
+  if (plan.work_size > graph->work_buffer.size())
+    graph->work_buffer.resize(plan.work_size);
+  plan.work_data =
+      graph->work_buffer.empty() ? nullptr : graph->work_buffer.data();
+  ggml_graph_compute(graph->graph, &plan);
+}
+
+void NanoBrainKernel::release_graph(NanoBrainGraph *graph) {
+  auto it = std::find_if(graphs.begin(), graphs.end(),
+                         [graph](const std::unique_ptr<NanoBrainGraph> &g) {
+                           return g.get() == graph;
+                         });
+  if (it != graphs.end())
+    graphs.erase(it);
 }
 
 void NanoBrainKernel::print_tensor(NanoBrainTensor *tensor) {
@@ -327,6 +537,16 @@ float NanoBrainKernel::get_value(NanoBrainTensor *tensor, int idx) {
   return 0.0f;
 }
 
+void NanoBrainKernel::set_value(NanoBrainTensor *tensor, int idx,
+                                float value) {
+  if (!tensor || !tensor->ggml_tensor)
+    return;
+  float *data = (float *)tensor->ggml_tensor->data;
+  if (idx >= 0 && idx < ggml_nelements(tensor->ggml_tensor)) {
+    data[idx] = value;
+  }
+}
+
 void NanoBrainKernel::set_data(NanoBrainTensor *tensor,
                                const std::vector<float> &data) {
   if (!tensor || !tensor->ggml_tensor)
@@ -347,3 +567,188 @@ void NanoBrainKernel::set_data(NanoBrainTensor *tensor,
     t_data[i] = data[i];
   }
 }
+
+// ================================================================
+// Memory Accounting
+// ================================================================
+
+struct ggml_context *NanoBrainKernel::alloc_ctx() const {
+  return (scratch_depth > 0 && scratch_ctx) ? scratch_ctx : ctx;
+}
+
+const char *NanoBrainKernel::set_allocation_tag(const char *tag) {
+  const char *previous = allocation_tag;
+  allocation_tag = tag ? tag : "untagged";
+  return previous;
+}
+
+void NanoBrainKernel::begin_scratch() { scratch_depth++; }
+
+void NanoBrainKernel::end_scratch() {
+  if (scratch_depth > 0)
+    scratch_depth--;
+}
+
+int NanoBrainKernel::suspend_scratch() {
+  int depth = scratch_depth;
+  scratch_depth = 0;
+  return depth;
+}
+
+void NanoBrainKernel::resume_scratch(int depth) { scratch_depth = depth; }
+
+void NanoBrainKernel::reset_scratch() {
+  if (!scratch_ctx)
+    return;
+
+  for (auto *tensor : scratch_tensors) {
+    auto it = tag_stats.find(tensor->allocation_tag);
+    if (it != tag_stats.end()) {
+      size_t bytes = ggml_nbytes(tensor->ggml_tensor) + ggml_tensor_overhead();
+      it->second.bytes -= std::min(it->second.bytes, bytes);
+      it->second.tensors -= std::min<size_t>(it->second.tensors, 1);
+    }
+    tensors.erase(tensor->id);
+    delete tensor;
+  }
+  scratch_tensors.clear();
+
+  // Re-create the context over the same buffer to rewind it
+  ggml_free(scratch_ctx);
+  struct ggml_init_params scratch_params = {
+      /*.mem_size   =*/scratch_memory.size(),
+      /*.mem_buffer =*/scratch_memory.data(),
+      /*.no_alloc   =*/false,
+  };
+  scratch_ctx = ggml_init(scratch_params);
+  memory.scratch_resets++;
+}
+
+void NanoBrainKernel::reserve(size_t bytes) {
+  struct ggml_context *target = alloc_ctx();
+  if (!target)
+    throw NanoBrainMemoryError("[NanoBrainKernel] No ggml context");
+
+  // ggml pads each object and its data; keep a little slack on top
+  size_t request = bytes + ggml_tensor_overhead() + 64;
+  size_t used = ggml_used_mem(target);
+  size_t capacity = ggml_get_mem_size(target);
+  size_t soft_limit = static_cast<size_t>(capacity * config.budget_fraction);
+  bool scratch = target == scratch_ctx;
+
+  if (used + request > capacity) {
+    memory.failed_allocations++;
+    std::ostringstream message;
+    message << "[NanoBrainKernel] Out of " << (scratch ? "scratch" : "ggml")
+            << " memory: " << request << " bytes requested for tag '"
+            << allocation_tag << "'";
+    std::cerr << message.str() << std::endl;
+    report_memory(std::cerr);
+    throw NanoBrainMemoryError(message.str());
+  }
+
+  if (used + request > soft_limit) {
+    // The scratch arena is rewound every cycle, so only the main context
+    // fails fast
+    if (config.budget_policy == MemoryBudgetPolicy::FailFast && !scratch) {
+      memory.failed_allocations++;
+      std::ostringstream message;
+      message << "[NanoBrainKernel] Memory budget exceeded ("
+              << config.budget_fraction * 100.0f << "% of " << capacity
+              << " bytes): refusing " << request << " bytes for tag '"
+              << allocation_tag << "'";
+      std::cerr << message.str() << std::endl;
+      report_memory(std::cerr);
+      throw NanoBrainMemoryError(message.str());
+    }
+    if (!warned_this_cycle) {
+      warned_this_cycle = true;
+      memory.budget_warnings++;
+      std::cerr << "[NanoBrainKernel] Warning: "
+                << (scratch ? "scratch" : "ggml") << " context at "
+                << (100.0 * (used + request) / capacity) << "% ("
+                << used + request << " / " << capacity << " bytes), tag '"
+                << allocation_tag << "'" << std::endl;
+    }
+  }
+}
+
+void NanoBrainKernel::register_tensor(NanoBrainTensor *tensor) {
+  this->tensors[tensor->id] = tensor;
+
+  size_t bytes = ggml_nbytes(tensor->ggml_tensor) + ggml_tensor_overhead();
+  tensor->allocation_tag = allocation_tag;
+  MemoryTagStats &tag = tag_stats[allocation_tag];
+  tag.bytes += bytes;
+  tag.tensors++;
+  memory.allocated_bytes += bytes;
+
+  if (scratch_depth > 0 && scratch_ctx) {
+    scratch_tensors.push_back(tensor);
+  }
+
+  size_t in_use = ggml_used_mem(ctx) + (scratch_ctx ? ggml_used_mem(scratch_ctx)
+                                                    : 0);
+  memory.peak_bytes = std::max(memory.peak_bytes, in_use);
+  memory.cycle_peak_bytes = std::max(memory.cycle_peak_bytes, in_use);
+}
+
+void NanoBrainKernel::begin_cycle() {
+  auto now = std::chrono::steady_clock::now();
+  float seconds = std::chrono::duration<float>(now - cycle_start_time).count();
+  size_t allocated = memory.allocated_bytes - cycle_start_allocated;
+  memory.allocation_rate = seconds > 0.0f ? allocated / seconds : 0.0f;
+
+  cycle_start_time = now;
+  cycle_start_allocated = memory.allocated_bytes;
+  warned_this_cycle = false;
+
+  // Per-cycle tensors from the last cycle are dead by now
+  if (scratch_ctx && ggml_used_mem(scratch_ctx) > 0)
+    reset_scratch();
+
+  memory.cycle_peak_bytes =
+      ggml_used_mem(ctx) + (scratch_ctx ? ggml_used_mem(scratch_ctx) : 0);
+}
+
+MemoryStats NanoBrainKernel::get_memory_stats() const {
+  MemoryStats stats = memory;
+  if (ctx) {
+    stats.capacity_bytes = ggml_get_mem_size(ctx);
+    stats.used_bytes = ggml_used_mem(ctx);
+  }
+  if (scratch_ctx) {
+    stats.scratch_capacity_bytes = ggml_get_mem_size(scratch_ctx);
+    stats.scratch_used_bytes = ggml_used_mem(scratch_ctx);
+  }
+  stats.tensor_count = tensors.size();
+  stats.context_memory = context_memory.get_info();
+  for (const auto &[tag, tag_memory] : tag_stats) {
+    MemoryTagStats &merged = stats.by_tag[tag];
+    merged.bytes += tag_memory.bytes;
+    merged.tensors += tag_memory.tensors;
+  }
+  return stats;
+}
+
+void NanoBrainKernel::report_memory(std::ostream &out) const {
+  MemoryStats stats = get_memory_stats();
+  out << "  ggml context: " << stats.used_bytes << " / " << stats.capacity_bytes
+      << " bytes, peak " << stats.peak_bytes << ", " << stats.tensor_count
+      << " tensors" << std::endl;
+  if (stats.context_memory.bytes > 0) {
+    out << "  context pages: "
+        << huge_page_policy_to_string(stats.context_memory.huge_pages) << " ("
+        << stats.context_memory.page_size << " bytes)"
+        << (stats.context_memory.prefaulted ? ", prefaulted" : "")
+        << (stats.context_memory.locked ? ", locked" : "") << std::endl;
+  }
+  if (stats.scratch_capacity_bytes > 0) {
+    out << "  scratch arena: " << stats.scratch_used_bytes << " / "
+        << stats.scratch_capacity_bytes << " bytes" << std::endl;
+  }
+  for (const auto &[tag, tag_memory] : stats.by_tag) {
+    out << "    " << tag << ": " << tag_memory.bytes << " bytes in "
+        << tag_memory.tensors << " tensors" << std::endl;
+  }
+}
@@ -2,9 +2,16 @@
 #define NANOBRAIN_KERNEL_H
 
 #include "ggml/ggml.h"
+#include "nanobrain_memory.h"
+#include "nanobrain_random.h"
+#include <chrono>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <ostream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct NanoBrainTensor {
@@ -12,11 +19,128 @@ struct NanoBrainTensor {
   struct ggml_tensor *gradient; // Optional gradient
   bool requires_grad;
   struct ggml_tensor *ggml_tensor; // Pointer to the underlying ggml tensor
+  const char *allocation_tag = nullptr; // Memory accounting tag
+};
+
+/**
+ * What to do as the ggml context approaches its memory budget
+ *
+ * Allocations that would overflow the context are always refused: the
+ * kernel prints a diagnostic and a per-tag report, then throws
+ * NanoBrainMemoryError (ggml itself would abort). The policy governs the
+ * soft limit at budget_fraction * memory_size. The scratch arena is
+ * rewound at every cycle boundary whatever the policy.
+ */
+enum class MemoryBudgetPolicy {
+  Warn,        // Log once per cycle above the soft limit
+  FailFast,    // Refuse main-context allocations above the soft limit
+  ScratchReset // Warn; per-cycle tensors belong in the scratch arena,
+               // which begin_cycle() rewinds
+};
+
+/**
+ * Thrown by NanoBrainKernel when an allocation is refused, after the
+ * diagnostic has been printed
+ */
+class NanoBrainMemoryError : public std::runtime_error {
+public:
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * How create_tensor fills a new tensor
+ *
+ * Most callers overwrite the contents right away, so filling them first
+ * only costs bandwidth. Fills other than Uninitialized and Zero apply to
+ * F32 tensors; other types are zeroed instead.
+ */
+enum class TensorInit {
+  Uninitialized, // Contents undefined; the caller writes every element
+  Zero,
+  Constant,  // Every element set to TensorInitPolicy::value
+  Xavier,    // Uniform Xavier/Glorot weights from the counter RNG
+  FromBuffer // Copied from TensorInitPolicy::data
+};
+
+struct TensorInitPolicy {
+  TensorInit mode = TensorInit::Xavier;
+  float value = 0.0f;          // Constant
+  const float *data = nullptr; // FromBuffer: one float per element
+  size_t size = 0;             // FromBuffer: must match the element count
+
+  static TensorInitPolicy uninitialized() {
+    return {TensorInit::Uninitialized};
+  }
+  static TensorInitPolicy zero() { return {TensorInit::Zero}; }
+  static TensorInitPolicy constant(float value) {
+    return {TensorInit::Constant, value};
+  }
+  static TensorInitPolicy xavier() { return {TensorInit::Xavier}; }
+  static TensorInitPolicy from_buffer(const float *data, size_t size) {
+    return {TensorInit::FromBuffer, 0.0f, data, size};
+  }
 };
 
 struct NanoBrainConfig {
   size_t memory_size; // size in bytes
   bool use_gpu;
+
+  // Memory accounting
+  size_t scratch_size = 0; // Per-cycle scratch arena in bytes (0 = none)
+  MemoryBudgetPolicy budget_policy = MemoryBudgetPolicy::Warn;
+  float budget_fraction = 0.9f; // Soft limit as a fraction of capacity
+
+  // Tensor initialization: create_tensor without a policy uses
+  // default_init. The n-th Xavier tensor a kernel creates always gets the
+  // same weights for a given seed.
+  TensorInit default_init = TensorInit::Xavier;
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED;
+  NanoBrainThreadPool *thread_pool = nullptr; // Fills large tensors (not
+                                              // owned; nullptr = serial)
+
+  // Backing memory for the context and scratch arena. With the defaults
+  // ggml mallocs the context; otherwise both come from a MemoryRegion
+  // (hugepages, pre-faulting, mlock, NUMA binding, with fallbacks).
+  MemoryProvisioning memory_provisioning;
+};
+
+/**
+ * Tensor memory attributed to one allocation tag
+ */
+struct MemoryTagStats {
+  size_t bytes = 0;
+  size_t tensors = 0;
+};
+
+/**
+ * ggml context memory accounting snapshot
+ */
+struct MemoryStats {
+  size_t capacity_bytes = 0; // Main context size
+  size_t used_bytes = 0;     // Main context bytes in use
+  size_t scratch_capacity_bytes = 0;
+  size_t scratch_used_bytes = 0;
+  size_t peak_bytes = 0;       // High-water mark (main + scratch)
+  size_t cycle_peak_bytes = 0; // High-water mark of the last cycle
+  size_t tensor_count = 0;     // Live tensor wrappers
+  size_t allocated_bytes = 0;  // Cumulative bytes handed out
+  float allocation_rate = 0.0f; // Bytes/second over the last cycle
+  size_t budget_warnings = 0;
+  size_t failed_allocations = 0;
+  size_t scratch_resets = 0;
+  std::map<std::string, MemoryTagStats> by_tag;
+  MemoryRegionInfo context_memory; // Provisioned backing (bytes 0 = ggml's)
+};
+
+/**
+ * Compute graph built once by NanoBrainKernel::build_graph and rerun in
+ * place by compute_graph, with its own work buffer
+ */
+struct NanoBrainGraph {
+  struct ggml_cgraph *graph = nullptr;
+  NanoBrainTensor *output = nullptr;
+  int threads = 1;
+  std::vector<uint8_t> work_buffer; // Sized by the first compute
 };
 
 class NanoBrainKernel {
@@ -24,10 +148,26 @@ public:
   NanoBrainKernel(NanoBrainConfig config);
   ~NanoBrainKernel();
 
-  // Tensor Creation
+  // Tensor Creation. Allocations the memory budget refuses throw
+  // NanoBrainMemoryError; nullptr only means invalid arguments.
   NanoBrainTensor *create_tensor(std::vector<int64_t> shape,
                                  ggml_type dtype = GGML_TYPE_F32,
                                  bool requires_grad = false);
+  NanoBrainTensor *create_tensor(std::vector<int64_t> shape,
+                                 const TensorInitPolicy &init,
+                                 ggml_type dtype = GGML_TYPE_F32,
+                                 bool requires_grad = false);
+
+  // F32 tensor holding a copy of data, in one pass. Without a shape the
+  // tensor is 1-D; with one, count must match its element count.
+  NanoBrainTensor *create_tensor_from(const float *data, size_t count,
+                                      bool requires_grad = false);
+  NanoBrainTensor *create_tensor_from(const std::vector<float> &data,
+                                      bool requires_grad = false);
+  NanoBrainTensor *create_tensor_from(std::initializer_list<float> data);
+  NanoBrainTensor *create_tensor_from(std::vector<int64_t> shape,
+                                      const float *data, size_t count,
+                                      bool requires_grad = false);
 
   // Operations
   NanoBrainTensor *matmul(NanoBrainTensor *a, NanoBrainTensor *b);
@@ -35,10 +175,12 @@ public:
   NanoBrainTensor *softmax(NanoBrainTensor *a);
   NanoBrainTensor *contract(NanoBrainTensor *a,
                             NanoBrainTensor *b); // Dot product for now
+  NanoBrainTensor *transpose(NanoBrainTensor *a); // Swap ne0/ne1 (copied)
 
   // Element-wise Operations
   NanoBrainTensor *sub(NanoBrainTensor *a, NanoBrainTensor *b);
   NanoBrainTensor *mul(NanoBrainTensor *a, NanoBrainTensor *b);
+  NanoBrainTensor *mul_scalar(NanoBrainTensor *a, float s); // a * s
   NanoBrainTensor *div(NanoBrainTensor *a, NanoBrainTensor *b);
   NanoBrainTensor *sin(NanoBrainTensor *a);
   NanoBrainTensor *cos(NanoBrainTensor *a);
@@ -69,18 +211,151 @@ public:
 
   // Utilities
   void compute(NanoBrainTensor *target); // Execute the graph ending at target
+
+  // Persistent graphs: build the graph ending at target once, then rerun
+  // it after writing new data into its leaf tensors. Reruns allocate
+  // nothing from the context. The kernel owns the graph; build it outside
+  // scratch scopes, from tensors that are not scratch tensors.
+  NanoBrainGraph *build_graph(NanoBrainTensor *target, int threads = 1);
+  void compute_graph(NanoBrainGraph *graph);
+
+  // Drop a graph and its work buffer when it is superseded. The context
+  // memory its nodes used is not reclaimed.
+  void release_graph(NanoBrainGraph *graph);
+
   void print_tensor(NanoBrainTensor *tensor);
   float get_value(NanoBrainTensor *tensor, int idx);
+  void set_value(NanoBrainTensor *tensor, int idx, float value); // In place
   void set_data(NanoBrainTensor *tensor, const std::vector<float> &data);
 
+  // Memory Accounting
+  // Tag attributed to subsequent allocations; tags must be string literals.
+  // Returns the previous tag.
+  const char *set_allocation_tag(const char *tag);
+  const char *get_allocation_tag() const { return allocation_tag; }
+
+  // Seed for counter-based random streams derived from this kernel
+  uint64_t get_seed() const { return config.seed; }
+
+  // Route subsequent allocations to the scratch arena (nests)
+  void begin_scratch();
+  void end_scratch();
+  bool has_scratch() const { return scratch_ctx != nullptr; }
+
+  // Route allocations to the main context inside scratch scopes, for
+  // tensors that outlive the cycle. Returns the depth to pass back to
+  // resume_scratch.
+  int suspend_scratch();
+  void resume_scratch(int depth);
+
+  // Discard every scratch tensor. Callers must not hold scratch tensors.
+  void reset_scratch();
+
+  // Mark a cycle boundary: rolls the per-cycle peak and allocation rate
+  // and rewinds the scratch arena. Callers must not hold scratch tensors.
+  void begin_cycle();
+
+  MemoryStats get_memory_stats() const;
+
+  // Shared pool for large Xavier fills (nullptr = serial); must outlive
+  // the kernel
+  void set_thread_pool(NanoBrainThreadPool *pool) {
+    config.thread_pool = pool;
+  }
+
 private:
   struct ggml_context *ctx;
-  std::vector<uint8_t> buffer; // Memory buffer for ggml
+  MemoryRegion context_memory; // Provisioned ggml buffer (else ggml's)
   std::map<std::string, NanoBrainTensor *>
       tensors; // Keep track of created tensors
+  std::vector<std::unique_ptr<NanoBrainGraph>> graphs; // Persistent graphs
+  std::vector<uint8_t> compute_work; // compute()'s work buffer, reused
+
+  // Memory accounting state
+  NanoBrainConfig config;
+  struct ggml_context *scratch_ctx = nullptr;
+  MemoryRegion scratch_memory;
+  std::vector<NanoBrainTensor *> scratch_tensors;
+  int scratch_depth = 0;
+  const char *allocation_tag = "untagged";
+  std::unordered_map<const char *, MemoryTagStats> tag_stats;
+  MemoryStats memory;
+  size_t cycle_start_allocated = 0;
+  std::chrono::steady_clock::time_point cycle_start_time;
+  bool warned_this_cycle = false;
+  uint64_t tensors_initialized = 0; // Counter RNG entity for random_init
 
   std::string generate_id();
+  void init_tensor(NanoBrainTensor *tensor, const TensorInitPolicy &init);
   void random_init(NanoBrainTensor *tensor); // Xavier initialization
+
+  struct ggml_context *alloc_ctx() const;
+  void reserve(size_t bytes); // Throws NanoBrainMemoryError if refused
+  void register_tensor(NanoBrainTensor *tensor);
+  void report_memory(std::ostream &out) const;
+};
+
+/**
+ * Attributes allocations made in a scope to a subsystem tag
+ */
+class AllocationTagScope {
+public:
+  AllocationTagScope(NanoBrainKernel *kernel, const char *tag)
+      : kernel(kernel),
+        previous(kernel ? kernel->set_allocation_tag(tag) : nullptr) {}
+  ~AllocationTagScope() {
+    if (kernel)
+      kernel->set_allocation_tag(previous);
+  }
+
+  AllocationTagScope(const AllocationTagScope &) = delete;
+  AllocationTagScope &operator=(const AllocationTagScope &) = delete;
+
+private:
+  NanoBrainKernel *kernel;
+  const char *previous;
+};
+
+/**
+ * Routes allocations made in a scope to the kernel's scratch arena
+ */
+class ScratchScope {
+public:
+  explicit ScratchScope(NanoBrainKernel *kernel) : kernel(kernel) {
+    if (kernel)
+      kernel->begin_scratch();
+  }
+  ~ScratchScope() {
+    if (kernel)
+      kernel->end_scratch();
+  }
+
+  ScratchScope(const ScratchScope &) = delete;
+  ScratchScope &operator=(const ScratchScope &) = delete;
+
+private:
+  NanoBrainKernel *kernel;
+};
+
+/**
+ * Routes allocations made in a scope to the main context, even inside a
+ * ScratchScope
+ */
+class MainContextScope {
+public:
+  explicit MainContextScope(NanoBrainKernel *kernel)
+      : kernel(kernel), depth(kernel ? kernel->suspend_scratch() : 0) {}
+  ~MainContextScope() {
+    if (kernel)
+      kernel->resume_scratch(depth);
+  }
+
+  MainContextScope(const MainContextScope &) = delete;
+  MainContextScope &operator=(const MainContextScope &) = delete;
+
+private:
+  NanoBrainKernel *kernel;
+  int depth;
 };
 
 #endif // NANOBRAIN_KERNEL_H
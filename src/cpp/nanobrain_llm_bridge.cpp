@@ -48,14 +48,13 @@ void NanoBrainLLMBridge::initialize_projections() {
 
   // Create projection matrix: LLM dim -> NanoBrain dim
   projection_to_nb = kernel->create_tensor(
-      {config.embedding_dim, config.projection_dim}, GGML_TYPE_F32, true);
+      {config.embedding_dim, config.projection_dim},
+      TensorInitPolicy::xavier(), GGML_TYPE_F32, true);
 
   // Create inverse projection: NanoBrain dim -> LLM dim
   projection_to_llm = kernel->create_tensor(
-      {config.projection_dim, config.embedding_dim}, GGML_TYPE_F32, true);
-
-  // Initialize with random orthogonal-ish values (Xavier already done by
-  // kernel)
+      {config.projection_dim, config.embedding_dim},
+      TensorInitPolicy::xavier(), GGML_TYPE_F32, true);
 }
 
 std::vector<float> NanoBrainLLMBridge::project_to_nanobrain(
@@ -64,13 +63,8 @@ std::vector<float> NanoBrainLLMBridge::project_to_nanobrain(
     return std::vector<float>(config.projection_dim, 0.0f);
   }
 
-  auto *kernel = nanobrain->get_time_crystal_kernel()->get_tensor_kernel();
-
-  // Create input tensor
-  auto *input = kernel->create_tensor({(int64_t)llm_embedding.size()});
-  kernel->set_data(input, llm_embedding);
-
-  // For now, simple mean pooling to reduce dimension
+  // For now, simple mean pooling to reduce dimension, on the host: a
+  // tensor copy of the input would only grow the ggml context per token.
   // In a full implementation, this would be a proper matrix multiplication
   std::vector<float> result(config.projection_dim, 0.0f);
 
@@ -0,0 +1,269 @@
+#include "nanobrain_memory.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t PAGE_2MB = size_t(1) << 21;
+constexpr size_t PAGE_1GB = size_t(1) << 30;
+
+size_t round_up(size_t bytes, size_t page) {
+  return (bytes + page - 1) / page * page;
+}
+
+size_t base_page_size() {
+#if defined(__linux__)
+  long page = sysconf(_SC_PAGESIZE);
+  return page > 0 ? static_cast<size_t>(page) : 4096;
+#else
+  return 4096;
+#endif
+}
+
+#if defined(__linux__)
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+// Fallback notices are printed once per process, not per region
+std::atomic<bool> hugetlb_notice_printed{false};
+
+void print_fallback_notice(const char *message) {
+  if (!hugetlb_notice_printed.exchange(true))
+    std::cerr << "[MemoryRegion] " << message << std::endl;
+}
+
+// hugetlb mapping of `page`-sized pages; nullptr if none are reserved
+void *map_hugetlb(size_t bytes, size_t page) {
+  int log2_page = page == PAGE_1GB ? 30 : 21;
+  void *ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                       (log2_page << MAP_HUGE_SHIFT),
+                   -1, 0);
+  return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+// Regular mapping; with `align`, over-map and trim so the start is aligned
+void *map_regular(size_t bytes, size_t align) {
+  size_t length = align > 0 ? bytes + align : bytes;
+  void *raw = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == MAP_FAILED)
+    return nullptr;
+  if (align == 0)
+    return raw;
+
+  uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+  uintptr_t aligned = (start + align - 1) & ~(uintptr_t(align) - 1);
+  size_t head = aligned - start;
+  size_t tail = length - head - bytes;
+  if (head > 0)
+    munmap(raw, head);
+  if (tail > 0)
+    munmap(reinterpret_cast<void *>(aligned + bytes), tail);
+  return reinterpret_cast<void *>(aligned);
+}
+
+// MPOL_BIND the range to one node; must run before the pages are touched
+bool bind_to_node(void *ptr, size_t bytes, int node) {
+#if defined(SYS_mbind)
+  constexpr int MPOL_BIND_MODE = 2;
+  constexpr int MAX_NODES = 1024;
+  constexpr int WORD_BITS = 8 * sizeof(unsigned long);
+  if (node < 0 || node >= MAX_NODES)
+    return false;
+  unsigned long mask[MAX_NODES / WORD_BITS] = {};
+  mask[node / WORD_BITS] = 1UL << (node % WORD_BITS);
+  return syscall(SYS_mbind, ptr, bytes, MPOL_BIND_MODE, mask, MAX_NODES + 1,
+                 0) == 0;
+#else
+  (void)ptr;
+  (void)bytes;
+  (void)node;
+  return false;
+#endif
+}
+
+#endif // __linux__
+
+} // namespace
+
+// ================================================================
+// MemoryRegion Implementation
+// ================================================================
+
+MemoryRegion::MemoryRegion(MemoryRegion &&other) noexcept
+    : ptr(other.ptr), mapped(other.mapped), info(other.info) {
+  other.ptr = nullptr;
+  other.info = MemoryRegionInfo();
+}
+
+MemoryRegion &MemoryRegion::operator=(MemoryRegion &&other) noexcept {
+  if (this != &other) {
+    release();
+    ptr = std::exchange(other.ptr, nullptr);
+    mapped = other.mapped;
+    info = std::exchange(other.info, MemoryRegionInfo());
+  }
+  return *this;
+}
+
+bool MemoryRegion::allocate(size_t bytes,
+                            const MemoryProvisioning &provisioning) {
+  release();
+  if (bytes == 0)
+    return false;
+
+  auto start = std::chrono::steady_clock::now();
+  const size_t base_page = base_page_size();
+
+#if defined(__linux__)
+  HugePagePolicy policy = provisioning.huge_pages;
+  size_t length = 0; // Bytes actually mapped
+
+  // Reserved hugepages first, each tier falling back to the next
+  if (policy == HugePagePolicy::Huge1GB) {
+    length = round_up(bytes, PAGE_1GB);
+    ptr = map_hugetlb(length, PAGE_1GB);
+    if (ptr) {
+      info.page_size = PAGE_1GB;
+    } else {
+      print_fallback_notice("1GB hugepages unavailable, falling back");
+      policy = HugePagePolicy::Huge2MB;
+    }
+  }
+  if (!ptr && policy == HugePagePolicy::Huge2MB) {
+    length = round_up(bytes, PAGE_2MB);
+    ptr = map_hugetlb(length, PAGE_2MB);
+    if (ptr) {
+      info.page_size = PAGE_2MB;
+    } else {
+      print_fallback_notice("2MB hugepages unavailable, using transparent "
+                            "hugepages");
+      policy = HugePagePolicy::Transparent;
+    }
+  }
+
+  if (!ptr && policy == HugePagePolicy::Transparent) {
+    length = round_up(bytes, PAGE_2MB);
+    ptr = map_regular(length, PAGE_2MB);
+#if defined(MADV_HUGEPAGE)
+    if (ptr && madvise(ptr, length, MADV_HUGEPAGE) == 0) {
+      info.page_size = PAGE_2MB;
+    } else
+#endif
+    {
+      policy = HugePagePolicy::None;
+    }
+  }
+
+  if (!ptr) {
+    policy = HugePagePolicy::None;
+    length = round_up(bytes, base_page);
+    ptr = map_regular(length, 0);
+  }
+  if (!ptr) {
+    std::cerr << "[MemoryRegion] Failed to map " << bytes << " bytes"
+              << std::endl;
+    info = MemoryRegionInfo();
+    return false;
+  }
+
+  mapped = true;
+  info.huge_pages = policy;
+  if (info.page_size == 0)
+    info.page_size = base_page;
+  info.mapped_bytes = length;
+
+  if (provisioning.numa_node >= 0) {
+    if (bind_to_node(ptr, info.mapped_bytes, provisioning.numa_node)) {
+      info.numa_node = provisioning.numa_node;
+    } else {
+      std::cerr << "[MemoryRegion] Could not bind to NUMA node "
+                << provisioning.numa_node << std::endl;
+    }
+  }
+#else
+  ptr = std::malloc(bytes);
+  if (!ptr) {
+    std::cerr << "[MemoryRegion] Failed to allocate " << bytes << " bytes"
+              << std::endl;
+    return false;
+  }
+  mapped = false;
+  info.page_size = base_page;
+  info.mapped_bytes = bytes;
+#endif
+  info.bytes = bytes;
+
+  // One write per base page faults every page in (a hugepage takes its
+  // first write, the rest hit it)
+  if (provisioning.prefault || provisioning.lock) {
+    volatile unsigned char *pages = static_cast<unsigned char *>(ptr);
+    for (size_t offset = 0; offset < info.mapped_bytes; offset += base_page) {
+      pages[offset] = 0;
+    }
+    info.prefaulted = true;
+  }
+
+#if defined(__linux__)
+  if (provisioning.lock) {
+    if (mlock(ptr, info.mapped_bytes) == 0) {
+      info.locked = true;
+    } else {
+      std::cerr << "[MemoryRegion] mlock of " << info.mapped_bytes
+                << " bytes failed: " << std::strerror(errno)
+                << " (raise RLIMIT_MEMLOCK)" << std::endl;
+    }
+  }
+#endif
+
+  info.provision_ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  return true;
+}
+
+void MemoryRegion::release() {
+  if (!ptr)
+    return;
+#if defined(__linux__)
+  if (mapped) {
+    if (info.locked)
+      munlock(ptr, info.mapped_bytes);
+    munmap(ptr, info.mapped_bytes);
+  } else
+#endif
+  {
+    std::free(ptr);
+  }
+  ptr = nullptr;
+  mapped = false;
+  info = MemoryRegionInfo();
+}
+
+const char *huge_page_policy_to_string(HugePagePolicy policy) {
+  switch (policy) {
+  case HugePagePolicy::None:
+    return "none";
+  case HugePagePolicy::Transparent:
+    return "transparent";
+  case HugePagePolicy::Huge2MB:
+    return "2MB";
+  case HugePagePolicy::Huge1GB:
+    return "1GB";
+  }
+  return "unknown";
+}
@@ -0,0 +1,98 @@
+#ifndef NANOBRAIN_MEMORY_H
+#define NANOBRAIN_MEMORY_H
+
+/**
+ * NanoBrain Memory Provisioning
+ *
+ * Backing memory for large, long-lived buffers such as the ggml context.
+ * Left to malloc, a multi-GB context is faulted in 4 KB pages during the
+ * first cycles and then walks the TLB on every tensor access. A
+ * MemoryRegion can instead:
+ *
+ * - Use 1 GB or 2 MB hugetlb pages (mmap MAP_HUGETLB) or transparent
+ *   hugepages (madvise MADV_HUGEPAGE on a 2 MB aligned mapping)
+ * - Bind its pages to one NUMA node (mbind, without libnuma)
+ * - Pre-fault every page up front, and optionally mlock them
+ *
+ * Every step falls back quietly when unavailable: 1 GB -> 2 MB ->
+ * transparent -> regular pages, and failed binds or locks only clear the
+ * matching MemoryRegionInfo flag. Off Linux the region is plain heap
+ * memory.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Page size to back a region with
+ */
+enum class HugePagePolicy {
+  None,        // Regular pages
+  Transparent, // madvise(MADV_HUGEPAGE), left to khugepaged/fault path
+  Huge2MB,     // Reserved 2 MB hugetlb pages
+  Huge1GB      // Reserved 1 GB hugetlb pages
+};
+
+/**
+ * How a region's memory is obtained and prepared
+ */
+struct MemoryProvisioning {
+  HugePagePolicy huge_pages = HugePagePolicy::None;
+  bool prefault = false; // Touch every page at allocation time
+  bool lock = false;     // mlock the region (needs RLIMIT_MEMLOCK)
+  int numa_node = -1;    // Bind pages to this node (-1 = first touch)
+
+  // False for the defaults, where callers may keep their own allocator
+  bool enabled() const {
+    return huge_pages != HugePagePolicy::None || prefault || lock ||
+           numa_node >= 0;
+  }
+};
+
+/**
+ * What a region actually got, after fallbacks
+ */
+struct MemoryRegionInfo {
+  size_t bytes = 0;        // Requested size
+  size_t mapped_bytes = 0; // Rounded up to the page size
+  size_t page_size = 0;    // Page size backing the region
+  HugePagePolicy huge_pages = HugePagePolicy::None;
+  bool prefaulted = false;
+  bool locked = false;
+  int numa_node = -1;        // Bound node (-1 = none)
+  double provision_ms = 0.0; // Time to map, bind, fault and lock
+};
+
+/**
+ * Owned block of provisioned memory
+ */
+class MemoryRegion {
+public:
+  MemoryRegion() = default;
+  ~MemoryRegion() { release(); }
+
+  MemoryRegion(MemoryRegion &&other) noexcept;
+  MemoryRegion &operator=(MemoryRegion &&other) noexcept;
+  MemoryRegion(const MemoryRegion &) = delete;
+  MemoryRegion &operator=(const MemoryRegion &) = delete;
+
+  // Replace the region with `bytes` of fresh memory; false if even regular
+  // pages could not be obtained
+  bool allocate(size_t bytes, const MemoryProvisioning &provisioning);
+  void release();
+
+  void *data() const { return ptr; }
+  size_t size() const { return info.bytes; }
+  bool empty() const { return ptr == nullptr; }
+  const MemoryRegionInfo &get_info() const { return info; }
+
+private:
+  void *ptr = nullptr;
+  bool mapped = false; // mmap'd (else heap)
+  MemoryRegionInfo info;
+};
+
+// Human-readable policy name ("2MB", "transparent", ...)
+const char *huge_page_policy_to_string(HugePagePolicy policy);
+
+#endif // NANOBRAIN_MEMORY_H
@@ -1,4 +1,5 @@
 #include "nanobrain_metacognitive.h"
+#include "nanobrain_trace.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -146,6 +147,8 @@ MetaCognitiveMetrics MetaCognitiveFeedbackEngine::update_meta_cognitive(
     const std::vector<LinkTensor *> &link_tensors,
     const AttentionStats &attention_stats,
     const ReasoningStats &reasoning_stats) {
+  NB_TRACE_SCOPE("metacognitive",
+                 "MetaCognitiveFeedbackEngine::update_meta_cognitive");
 
   cycle_counter++;
 
@@ -479,7 +482,6 @@ void MetaCognitiveFeedbackEngine::perform_self_modification(
 void MetaCognitiveFeedbackEngine::adjust_parameters(
     const MetaCognitiveMetrics &metrics) {
 
-  NanoBrainTensor *mod_tensor = kernel->create_tensor({4});
   std::vector<float> adjustments(4, 0.0f);
 
   // Adjust based on various metrics
@@ -503,7 +505,7 @@ void MetaCognitiveFeedbackEngine::adjust_parameters(
     // Could adjust convergence_threshold
   }
 
-  kernel->set_data(mod_tensor, adjustments);
+  NanoBrainTensor *mod_tensor = kernel->create_tensor_from(adjustments);
   record_self_modification("parameter_adjustment", "config", mod_tensor,
                            metrics.system_coherence);
 }
@@ -171,11 +171,19 @@ bool NanoBrainCoprocessor::run_cycle() {
     return false;
   }
 
-  auto metrics = unified_kernel_->run_cycles(1);
+  UnifiedNanoBrainMetrics metrics;
+  try {
+    metrics = unified_kernel_->run_cycles(1);
+  } catch (const NanoBrainMemoryError &) {
+    // Already diagnosed; surface it as ERR_OUT_OF_MEMORY
+    update_memory_telemetry(unified_kernel_->get_metrics().memory);
+    return false;
+  }
 
   telemetry_.cycle_count++;
   telemetry_.ppm_coherence = metrics.average_coherence;
   telemetry_.consciousness_level = metrics.consciousness_emergence;
+  update_memory_telemetry(metrics.memory);
 
   update_metric_registers();
   return true;
@@ -188,7 +196,13 @@ bool NanoBrainCoprocessor::run_cycles(int count) {
 
   auto start = std::chrono::steady_clock::now();
 
-  auto metrics = unified_kernel_->run_cycles(count);
+  UnifiedNanoBrainMetrics metrics;
+  try {
+    metrics = unified_kernel_->run_cycles(count);
+  } catch (const NanoBrainMemoryError &) {
+    update_memory_telemetry(unified_kernel_->get_metrics().memory);
+    return false;
+  }
 
   auto end = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration<float>(end - start).count();
@@ -197,6 +211,7 @@ bool NanoBrainCoprocessor::run_cycles(int count) {
   telemetry_.ppm_coherence = metrics.average_coherence;
   telemetry_.consciousness_level = metrics.consciousness_emergence;
   telemetry_.cycles_per_second = count / duration;
+  update_memory_telemetry(metrics.memory);
 
   update_metric_registers();
   return true;
@@ -396,6 +411,16 @@ std::string NanoBrainCoprocessor::get_diagnostics() const {
 
   oss << "Performance:" << std::endl;
   oss << "  Cycles/sec: " << telemetry_.cycles_per_second << std::endl;
+  oss << std::endl;
+
+  oss << "Memory:" << std::endl;
+  oss << "  Used: " << telemetry_.memory_used_bytes << " / "
+      << telemetry_.memory_capacity_bytes << " bytes" << std::endl;
+  oss << "  Cycle peak: " << telemetry_.memory_cycle_peak_bytes << " bytes"
+      << std::endl;
+  oss << "  Tensors: " << telemetry_.tensor_count << std::endl;
+  oss << "  Allocation rate: " << telemetry_.allocation_rate << " B/s"
+      << std::endl;
 
   return oss.str();
 }
@@ -433,6 +458,10 @@ void NanoBrainCoprocessor::update_status_registers() {
     status |= STATUS_CONSCIOUS;
   }
 
+  if (telemetry_.memory_pressure) {
+    status |= STATUS_MEM_PRESSURE;
+  }
+
   registers_[(REG_NB_STATUS - REG_NB_BASE) / 4] = status;
 }
 
@@ -451,6 +480,49 @@ void NanoBrainCoprocessor::update_metric_registers() {
       static_cast<uint32_t>(telemetry_.cycle_count);
   registers_[(REG_NB_PERF_CYCLES_SEC - REG_NB_BASE) / 4] =
       float_to_fixed(telemetry_.cycles_per_second);
+
+  registers_[(REG_NB_MEM_USED - REG_NB_BASE) / 4] =
+      static_cast<uint32_t>(telemetry_.memory_used_bytes / 1024);
+  registers_[(REG_NB_MEM_CAPACITY - REG_NB_BASE) / 4] =
+      static_cast<uint32_t>(telemetry_.memory_capacity_bytes / 1024);
+  registers_[(REG_NB_MEM_PEAK_CYCLE - REG_NB_BASE) / 4] =
+      static_cast<uint32_t>(telemetry_.memory_cycle_peak_bytes / 1024);
+  registers_[(REG_NB_MEM_TENSORS - REG_NB_BASE) / 4] =
+      static_cast<uint32_t>(telemetry_.tensor_count);
+  registers_[(REG_NB_MEM_ALLOC_RATE - REG_NB_BASE) / 4] =
+      static_cast<uint32_t>(telemetry_.allocation_rate / 1024.0f);
+}
+
+void NanoBrainCoprocessor::update_memory_telemetry(const MemoryStats &memory) {
+  telemetry_.memory_used_bytes = memory.used_bytes + memory.scratch_used_bytes;
+  telemetry_.memory_capacity_bytes =
+      memory.capacity_bytes + memory.scratch_capacity_bytes;
+  telemetry_.memory_cycle_peak_bytes = memory.cycle_peak_bytes;
+  telemetry_.tensor_count = memory.tensor_count;
+  telemetry_.allocation_rate = memory.allocation_rate;
+
+  // The kernel's counters are cumulative; judge pressure on what happened
+  // since the last update so it clears once usage drops back under budget
+  auto since_last = [](size_t count, size_t &seen) {
+    size_t delta = count >= seen ? count - seen : count; // New kernel
+    seen = count;
+    return delta;
+  };
+  size_t warnings = since_last(memory.budget_warnings, seen_budget_warnings);
+  size_t failures =
+      since_last(memory.failed_allocations, seen_failed_allocations);
+  telemetry_.memory_pressure = warnings > 0 || failures > 0;
+
+  if (failures > 0) {
+    telemetry_.has_error = true;
+    telemetry_.error_code = ERR_OUT_OF_MEMORY;
+    registers_[(REG_NB_ERROR - REG_NB_BASE) / 4] = ERR_OUT_OF_MEMORY;
+  } else if (telemetry_.error_code == ERR_OUT_OF_MEMORY) {
+    telemetry_.has_error = false;
+    telemetry_.error_code = ERR_NONE;
+    registers_[(REG_NB_ERROR - REG_NB_BASE) / 4] = ERR_NONE;
+  }
+  update_status_registers();
 }
 
 void NanoBrainCoprocessor::clear_registers() { registers_.fill(0); }
@@ -518,6 +590,16 @@ std::string get_register_name(uint64_t addr) {
     return "PERF_CYCLES_SEC";
   case REG_NB_PERF_ATOMS:
     return "PERF_ATOMS";
+  case REG_NB_MEM_USED:
+    return "MEM_USED";
+  case REG_NB_MEM_CAPACITY:
+    return "MEM_CAPACITY";
+  case REG_NB_MEM_PEAK_CYCLE:
+    return "MEM_PEAK_CYCLE";
+  case REG_NB_MEM_TENSORS:
+    return "MEM_TENSORS";
+  case REG_NB_MEM_ALLOC_RATE:
+    return "MEM_ALLOC_RATE";
   default:
     return "UNKNOWN";
   }
@@ -546,4 +628,12 @@ void print_register_map() {
   std::cout << "  0x28: CONFIG_FLAGS   - Enable flags" << std::endl;
   std::cout << "  0x2C: TC_DIMENSIONS  - Time crystal dims" << std::endl;
   std::cout << "  0x30: REASONING_DEPTH- Max reasoning depth" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "Memory Registers (read-only):" << std::endl;
+  std::cout << "  0x40: MEM_USED       - ggml bytes in use (KiB)" << std::endl;
+  std::cout << "  0x44: MEM_CAPACITY   - ggml capacity (KiB)" << std::endl;
+  std::cout << "  0x48: MEM_PEAK_CYCLE - Last cycle peak (KiB)" << std::endl;
+  std::cout << "  0x4C: MEM_TENSORS    - Live tensor count" << std::endl;
+  std::cout << "  0x50: MEM_ALLOC_RATE - Allocation rate (KiB/s)" << std::endl;
 }
@@ -13,6 +13,7 @@
  * - CONSCIOUSNESS: Emergence level
  * - ATTENTION_STI: Short-term importance
  * - TC_PHASE: Time crystal phase
+ * - MEM_*: ggml context memory accounting
  */
 
 #include "nanobrain_unified.h"
@@ -60,6 +61,13 @@ static constexpr uint64_t REG_NB_ERROR = REG_NB_BASE + 0x34;
 static constexpr uint64_t REG_NB_PERF_CYCLES_SEC = REG_NB_BASE + 0x38;
 static constexpr uint64_t REG_NB_PERF_ATOMS = REG_NB_BASE + 0x3C;
 
+// Memory Registers (read-only, KiB unless noted)
+static constexpr uint64_t REG_NB_MEM_USED = REG_NB_BASE + 0x40;
+static constexpr uint64_t REG_NB_MEM_CAPACITY = REG_NB_BASE + 0x44;
+static constexpr uint64_t REG_NB_MEM_PEAK_CYCLE = REG_NB_BASE + 0x48;
+static constexpr uint64_t REG_NB_MEM_TENSORS = REG_NB_BASE + 0x4C; // Count
+static constexpr uint64_t REG_NB_MEM_ALLOC_RATE = REG_NB_BASE + 0x50; // KiB/s
+
 // Command Bits
 static constexpr uint32_t CMD_RESET = 0x01;
 static constexpr uint32_t CMD_INIT = 0x02;
@@ -77,6 +85,7 @@ static constexpr uint32_t STATUS_ERROR = 0x08;
 static constexpr uint32_t STATUS_REASONING = 0x10;
 static constexpr uint32_t STATUS_COHERENT = 0x20;
 static constexpr uint32_t STATUS_CONSCIOUS = 0x40;
+static constexpr uint32_t STATUS_MEM_PRESSURE = 0x80;
 
 // Config Flags
 static constexpr uint32_t CFG_ENABLE_PPM = 0x01;
@@ -146,6 +155,15 @@ struct NPUTelemetry {
   float cycles_per_second;
   float reasoning_confidence;
 
+  // Memory
+  uint64_t memory_used_bytes;
+  uint64_t memory_capacity_bytes;
+  uint64_t memory_cycle_peak_bytes;
+  uint64_t tensor_count;
+  float allocation_rate; // Bytes/second
+  bool memory_pressure;  // Soft budget crossed or allocations refused
+                         // since the last update
+
   // Status
   bool is_initialized;
   bool is_busy;
@@ -339,10 +357,13 @@ private:
 
   // Telemetry
   NPUTelemetry telemetry_;
+  size_t seen_budget_warnings = 0; // Kernel counters at the last update
+  size_t seen_failed_allocations = 0;
 
   // Internal helpers
   void update_status_registers();
   void update_metric_registers();
+  void update_memory_telemetry(const MemoryStats &memory);
   void clear_registers();
   uint32_t get_config_flags() const;
   void apply_config_flags(uint32_t flags);
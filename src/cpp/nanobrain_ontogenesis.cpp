@@ -8,12 +8,8 @@
 // OntogenesisEngine Implementation
 // ================================================================
 
-OntogenesisEngine::OntogenesisEngine(const EvolutionConfig &cfg) : config(cfg) {
-  // Seed random number generator
-  auto seed =
-      std::chrono::high_resolution_clock::now().time_since_epoch().count();
-  rng.seed(static_cast<unsigned int>(seed));
-}
+OntogenesisEngine::OntogenesisEngine(const EvolutionConfig &cfg)
+    : config(cfg), rng(cfg.seed, RandomSubsystem::Ontogenesis) {}
 
 OntogenesisEngine::~OntogenesisEngine() {}
 
@@ -151,8 +147,7 @@ NPUGenome OntogenesisEngine::crossover(const NPUGenome &parent1,
                   child.genes.evolutionary);
 
   // Apply mutation with crossover rate
-  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-  if (dist(rng) < config.mutation_rate) {
+  if (rng.uniform() < config.mutation_rate) {
     mutate(child);
   }
 
@@ -165,9 +160,8 @@ NPUGenome OntogenesisEngine::crossover(const NPUGenome &parent1,
 void OntogenesisEngine::mutate(NPUGenome &genome) {
   // Mutate each gene vector
   auto mutate_vector = [this](std::vector<float> &genes) {
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
     for (float &gene : genes) {
-      if (dist(rng) < config.mutation_rate) {
+      if (rng.uniform() < config.mutation_rate) {
         gene = mutate_gene(gene);
       }
     }
@@ -271,8 +265,7 @@ OntogenesisEngine::evolve_generation(std::vector<NPUGenome> &population,
     // Select parents
     auto parents = select_parents(population, fitness_scores, 2);
 
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    if (dist(rng) < config.crossover_rate) {
+    if (rng.uniform() < config.crossover_rate) {
       // Crossover
       next_generation.push_back(
           crossover(population[parents[0]], population[parents[1]]));
@@ -364,15 +357,13 @@ std::string OntogenesisEngine::generate_genome_id() {
 void OntogenesisEngine::initialize_gene_vector(std::vector<float> &genes,
                                                int size) {
   genes.resize(size);
-  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
   for (float &gene : genes) {
-    gene = dist(rng);
+    gene = rng.uniform();
   }
 }
 
 float OntogenesisEngine::mutate_gene(float gene) {
-  std::normal_distribution<float> dist(0.0f, config.mutation_strength);
-  gene += dist(rng);
+  gene += rng.normal(0.0f, config.mutation_strength);
   return std::min(1.0f, std::max(0.0f, gene));
 }
 
@@ -383,8 +374,9 @@ void OntogenesisEngine::crossover_genes(const std::vector<float> &parent1,
   size_t size = std::min(parent1.size(), parent2.size());
   child.resize(size);
 
-  std::uniform_int_distribution<size_t> point_dist(0, size);
-  size_t crossover_point = point_dist(rng);
+  // Uniform in [0, size]
+  size_t crossover_point = std::min(
+      size, static_cast<size_t>(rng.uniform() * static_cast<float>(size + 1)));
 
   for (size_t i = 0; i < size; ++i) {
     child[i] = (i < crossover_point) ? parent1[i] : parent2[i];
@@ -432,13 +424,16 @@ OntogenesisEngine::select_parents(const std::vector<NPUGenome> &population,
   std::vector<size_t> selected;
   selected.reserve(count);
 
-  std::uniform_int_distribution<size_t> dist(0, population.size() - 1);
+  auto pick = [&]() {
+    return std::min(population.size() - 1,
+                    static_cast<size_t>(rng.uniform() * population.size()));
+  };
 
   for (int i = 0; i < count; ++i) {
     // Tournament of 3
-    size_t best = dist(rng);
+    size_t best = pick();
     for (int t = 0; t < 2; ++t) {
-      size_t candidate = dist(rng);
+      size_t candidate = pick();
       if (fitness_scores[candidate] > fitness_scores[best]) {
         best = candidate;
       }
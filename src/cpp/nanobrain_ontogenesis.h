@@ -13,10 +13,10 @@
  */
 
 #include "nanobrain_npu_bridge.h"
+#include "nanobrain_random.h"
 #include <array>
 #include <functional>
 #include <memory>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -77,6 +77,8 @@ struct EvolutionConfig {
   int cognitive_genes = 5;
   int integrative_genes = 5;
   int evolutionary_genes = 5;
+
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED; // Mutation/selection draws
 };
 
 /**
@@ -230,7 +232,7 @@ public:
 
 private:
   EvolutionConfig config;
-  std::mt19937 rng;
+  CounterRng rng; // One sequential stream per engine
   int genome_counter = 0;
 
   // Helpers
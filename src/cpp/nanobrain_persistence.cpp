@@ -1,4 +1,5 @@
 #include "nanobrain_persistence.h"
+#include "nanobrain_trace.h"
 #include <algorithm>
 #include <chrono>
 #include <cstring>
@@ -6,6 +7,7 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 namespace fs = std::filesystem;
 
@@ -29,6 +31,7 @@ AtomSpacePersistence::AtomSpacePersistence(const PersistenceConfig &config)
 SerializationResult
 AtomSpacePersistence::save_to_file(const TimeCrystalKernel *kernel,
                                    const std::string &filepath) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::save_to_file");
   SerializationResult result;
   result.success = false;
   result.bytes_written = 0;
@@ -85,6 +88,7 @@ AtomSpacePersistence::save_to_file(const TimeCrystalKernel *kernel,
 SerializationResult
 AtomSpacePersistence::save_to_buffer(const TimeCrystalKernel *kernel,
                                      std::vector<uint8_t> &buffer) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::save_to_buffer");
   SerializationResult result;
   result.success = false;
 
@@ -129,9 +133,78 @@ AtomSpacePersistence::save_to_buffer(const TimeCrystalKernel *kernel,
   return result;
 }
 
+SerializationResult
+AtomSpacePersistence::save_to_file(const TimeCrystalSnapshot &snapshot,
+                                   const std::string &filepath) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::save_snapshot");
+  SerializationResult result;
+  result.success = false;
+  result.bytes_written = 0;
+  result.atoms_serialized = 0;
+  result.inferences_serialized = 0;
+
+  std::ofstream file(filepath, std::ios::binary);
+  if (!file.is_open()) {
+    result.error_message = "Failed to open file for writing: " + filepath;
+    return result;
+  }
+
+  try {
+    write_snapshot(file, snapshot, result);
+    result.bytes_written = file.tellp();
+    result.success = true;
+
+  } catch (const std::exception &e) {
+    result.error_message = std::string("Serialization error: ") + e.what();
+  }
+
+  file.close();
+  return result;
+}
+
+SerializationResult
+AtomSpacePersistence::save_to_buffer(const TimeCrystalSnapshot &snapshot,
+                                     std::vector<uint8_t> &buffer) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::save_snapshot");
+  SerializationResult result;
+  result.success = false;
+
+  std::ostringstream oss(std::ios::binary);
+
+  try {
+    write_snapshot(oss, snapshot, result);
+    std::string str = oss.str();
+    buffer.assign(str.begin(), str.end());
+    result.bytes_written = buffer.size();
+    result.success = true;
+
+  } catch (const std::exception &e) {
+    result.error_message = std::string("Serialization error: ") + e.what();
+  }
+
+  return result;
+}
+
+void AtomSpacePersistence::write_snapshot(std::ostream &out,
+                                          const TimeCrystalSnapshot &snapshot,
+                                          SerializationResult &result) {
+  write_header(out, snapshot.atom_count(), snapshot.inference_count());
+
+  snapshot.for_each_atom([&](const TimeCrystalAtom &atom) {
+    write_atom(out, atom);
+    result.atoms_serialized++;
+  });
+
+  for (const auto &id : snapshot.get_all_inference_ids()) {
+    write_inference(out, *snapshot.get_inference(id));
+    result.inferences_serialized++;
+  }
+}
+
 SerializationResult
 AtomSpacePersistence::export_to_json(const TimeCrystalKernel *kernel,
                                      const std::string &filepath) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::export_to_json");
   SerializationResult result;
   result.success = false;
 
@@ -207,6 +280,7 @@ AtomSpacePersistence::export_to_json(const TimeCrystalKernel *kernel,
 DeserializationResult
 AtomSpacePersistence::load_from_file(TimeCrystalKernel *kernel,
                                      const std::string &filepath) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::load_from_file");
   DeserializationResult result;
   result.success = false;
   result.bytes_read = 0;
@@ -273,6 +347,7 @@ AtomSpacePersistence::load_from_file(TimeCrystalKernel *kernel,
 DeserializationResult
 AtomSpacePersistence::load_from_buffer(TimeCrystalKernel *kernel,
                                        const std::vector<uint8_t> &buffer) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::load_from_buffer");
   DeserializationResult result;
   result.success = false;
 
@@ -326,6 +401,7 @@ AtomSpacePersistence::load_from_buffer(TimeCrystalKernel *kernel,
 DeserializationResult
 AtomSpacePersistence::import_from_json(TimeCrystalKernel *kernel,
                                        const std::string &filepath) {
+  NB_TRACE_SCOPE("persistence", "AtomSpacePersistence::import_from_json");
   DeserializationResult result;
   result.success = false;
   result.error_message = "JSON import not yet implemented";
@@ -456,7 +532,9 @@ TimeCrystalAtom AtomSpacePersistence::read_atom(std::istream &in) {
   TimeCrystalAtom atom;
 
   atom.id = read_string(in);
-  atom.type = read_string(in);
+  std::string type = read_string(in);
+  if (!lookup_atom_type(type, atom.type))
+    throw std::runtime_error("Unknown atom type: " + type);
   atom.name = read_string(in);
 
   in.read(reinterpret_cast<char *>(&atom.truth_value), sizeof(TruthValue));
@@ -464,6 +542,8 @@ TimeCrystalAtom AtomSpacePersistence::read_atom(std::istream &in) {
           sizeof(AttentionValue));
 
   atom.prime_encoding = read_int_vector(in);
+  if (atom.prime_encoding.overflowed())
+    throw std::runtime_error("Too many primes in atom " + atom.id);
 
   if (config.include_quantum_states) {
     atom.time_crystal_state = read_quantum_state(in);
@@ -479,6 +559,8 @@ TimeCrystalAtom AtomSpacePersistence::read_atom(std::istream &in) {
   in.read(reinterpret_cast<char *>(&note), sizeof(note));
   atom.fractal_geometry.musical_note = static_cast<MusicalNote>(note);
   atom.fractal_geometry.prime_resonance = read_int_vector(in);
+  if (atom.fractal_geometry.prime_resonance.overflowed())
+    throw std::runtime_error("Too many resonance primes in atom " + atom.id);
   in.read(reinterpret_cast<char *>(&atom.fractal_geometry.scale_factor),
           sizeof(float));
 
@@ -587,7 +669,7 @@ std::vector<float> AtomSpacePersistence::read_float_vector(std::istream &in) {
 }
 
 void AtomSpacePersistence::write_int_vector(std::ostream &out,
-                                            const std::vector<int> &vec) {
+                                            PrimeView vec) {
   size_t len = vec.size();
   out.write(reinterpret_cast<const char *>(&len), sizeof(len));
   out.write(reinterpret_cast<const char *>(vec.data()), len * sizeof(int));
@@ -720,6 +802,23 @@ CheckpointManager::save_checkpoint(const TimeCrystalKernel *kernel,
   return result;
 }
 
+SerializationResult
+CheckpointManager::save_checkpoint(const TimeCrystalSnapshot &snapshot,
+                                   const std::string &tag) {
+  std::string name = generate_checkpoint_name(tag);
+  std::string filepath = checkpoint_dir + "/" + name;
+
+  auto result = persistence.save_to_file(snapshot, filepath);
+
+  if (result.success) {
+    std::cout << "[Checkpoint] Saved: " << name << " (snapshot v"
+              << snapshot.get_version() << ")" << std::endl;
+    cleanup_old_checkpoints();
+  }
+
+  return result;
+}
+
 DeserializationResult
 CheckpointManager::load_latest_checkpoint(TimeCrystalKernel *kernel) {
   auto checkpoints = list_checkpoints();
@@ -71,6 +71,12 @@ public:
   SerializationResult save_to_buffer(const TimeCrystalKernel *kernel,
                                      std::vector<uint8_t> &buffer);
 
+  // Save a published snapshot; the kernel may keep cycling meanwhile
+  SerializationResult save_to_file(const TimeCrystalSnapshot &snapshot,
+                                   const std::string &filepath);
+  SerializationResult save_to_buffer(const TimeCrystalSnapshot &snapshot,
+                                     std::vector<uint8_t> &buffer);
+
   // Export to JSON format
   SerializationResult export_to_json(const TimeCrystalKernel *kernel,
                                      const std::string &filepath);
@@ -119,6 +125,8 @@ private:
   PersistenceConfig config;
 
   // Binary serialization helpers
+  void write_snapshot(std::ostream &out, const TimeCrystalSnapshot &snapshot,
+                      SerializationResult &result);
   void write_header(std::ostream &out, size_t atom_count,
                     size_t inference_count);
   bool read_header(std::istream &in, uint32_t &version, size_t &atom_count,
@@ -141,7 +149,7 @@ private:
   void write_float_vector(std::ostream &out, const std::vector<float> &vec);
   std::vector<float> read_float_vector(std::istream &in);
 
-  void write_int_vector(std::ostream &out, const std::vector<int> &vec);
+  void write_int_vector(std::ostream &out, PrimeView vec);
   std::vector<int> read_int_vector(std::istream &in);
 
   // JSON helpers
@@ -162,6 +170,8 @@ public:
   // Save checkpoint with automatic naming
   SerializationResult save_checkpoint(const TimeCrystalKernel *kernel,
                                       const std::string &tag = "");
+  SerializationResult save_checkpoint(const TimeCrystalSnapshot &snapshot,
+                                      const std::string &tag = "");
 
   // Load latest checkpoint
   DeserializationResult load_latest_checkpoint(TimeCrystalKernel *kernel);
@@ -1,4 +1,5 @@
 #include "nanobrain_philosophical.h"
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <sstream>
@@ -328,6 +329,68 @@ LinguisticWheel PhilosophicalTransformationEngine::create_wheel_from_concept(
   return wheel;
 }
 
+namespace {
+
+// Concepts per thread below which create_wheels stays single-threaded
+constexpr size_t WHEEL_GRAIN = 16384;
+
+// Rows [begin, end) of create_wheels: the same arithmetic as
+// create_wheel_from_concept, without building LinguisticWheel objects
+void fill_wheel_rows(const std::string *concepts, size_t begin, size_t end,
+                     LinguisticWheelSet &wheels) {
+  // Coherence of the first n primes, summed in compute_coherence() order
+  static const std::array<float, 11> prefix_coherence = [] {
+    static const int primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+    std::array<float, 11> table{};
+    float sum = 0.0f;
+    for (int n = 1; n <= 10; n++) {
+      sum += 1.0f / static_cast<float>(primes[n - 1]);
+      table[n] = sum / static_cast<float>(n);
+    }
+    return table;
+  }();
+
+  auto &c = wheels.columns;
+  for (size_t i = begin; i < end; i++) {
+    size_t hash = std::hash<std::string>{}(concepts[i]);
+    size_t primes = std::min<size_t>(concepts[i].size(), 10);
+    if (primes == 0)
+      primes = 3; // Default {2, 3, 5} encoding
+
+    c[0][i] = static_cast<float>((hash & 0xFF)) / 255.0f * 2.0f - 1.0f;
+    c[1][i] = static_cast<float>((hash >> 8) & 0xFF) / 255.0f * 2.0f - 1.0f;
+    c[2][i] = static_cast<float>((hash >> 16) & 0xFF) / 255.0f * 2.0f - 1.0f;
+    c[3][i] = static_cast<float>((hash >> 24) & 0xFF) / 255.0f * 6.28318f;
+    c[4][i] = 1.0f + static_cast<float>((hash >> 32) & 0xFF) / 255.0f * 2.0f;
+    c[5][i] = static_cast<float>((hash >> 40) & 0xFF) / 255.0f * 2.0f - 1.0f;
+    c[6][i] = static_cast<float>((hash >> 48) & 0xFF) / 255.0f * 2.0f - 1.0f;
+    c[7][i] = static_cast<float>((hash >> 56) & 0x0F) / 15.0f * 2.0f - 1.0f;
+    c[8][i] = static_cast<float>((hash >> 60) & 0x0F) / 15.0f * 2.0f - 1.0f;
+    c[9][i] = static_cast<float>(primes);
+    c[10][i] = prefix_coherence[primes];
+  }
+}
+
+} // namespace
+
+LinguisticWheelSet
+PhilosophicalTransformationEngine::create_wheels(const std::string *concepts,
+                                                 size_t count) const {
+  LinguisticWheelSet wheels;
+  wheels.resize(count);
+
+  NanoBrainThreadPool *pool = config_.thread_pool;
+  if (!pool || count < 2 * WHEEL_GRAIN) {
+    fill_wheel_rows(concepts, 0, count, wheels);
+    return wheels;
+  }
+  pool->parallel_for(0, count, pool->grain_for(count, WHEEL_GRAIN),
+                     [&](size_t begin, size_t end) {
+                       fill_wheel_rows(concepts, begin, end, wheels);
+                     });
+  return wheels;
+}
+
 LinguisticWheel PhilosophicalTransformationEngine::translate_wheel(
     const LinguisticWheel &source, const LinguisticWheel &target,
     float interpolation) const {
@@ -25,6 +25,7 @@
  */
 
 #include "nanobrain_atomese.h"
+#include "nanobrain_thread_pool.h"
 #include "nanobrain_types.h"
 #include <array>
 #include <functional>
@@ -293,6 +294,37 @@ struct LinguisticWheel {
   }
 };
 
+/**
+ * @brief Many linguistic wheels in SoA form
+ *
+ * One column per to_11d_vector() component, so bulk vocabularies are
+ * stored without per-wheel prime vectors and scanned column by column.
+ */
+struct LinguisticWheelSet {
+  static constexpr int DIMENSIONS = 11;
+
+  std::array<std::vector<float>, DIMENSIONS> columns;
+
+  size_t size() const { return columns[0].size(); }
+
+  void resize(size_t count) {
+    for (auto &column : columns)
+      column.resize(count);
+  }
+
+  std::array<float, DIMENSIONS> vector(size_t index) const {
+    std::array<float, DIMENSIONS> v;
+    for (int d = 0; d < DIMENSIONS; d++)
+      v[d] = columns[d][index];
+    return v;
+  }
+
+  void set(size_t index, const std::array<float, DIMENSIONS> &v) {
+    for (int d = 0; d < DIMENSIONS; d++)
+      columns[d][index] = v[d];
+  }
+};
+
 // ================================================================
 // Consciousness Configuration (Section 1.10)
 // ================================================================
@@ -326,6 +358,10 @@ struct ConsciousnessConfig {
   // Brain model selection
   BrainModel active_model = BrainModel::TimeCrystal;
 
+  // Shared workers for bulk operations such as create_wheels (not owned;
+  // nullptr = serial)
+  NanoBrainThreadPool *thread_pool = nullptr;
+
   /**
    * @brief Validate configuration parameters
    */
@@ -481,6 +517,19 @@ public:
    */
   LinguisticWheel create_wheel_from_concept(const std::string &concept) const;
 
+  /**
+   * @brief Create wheels for a whole vocabulary
+   *
+   * Row i equals create_wheel_from_concept(concepts[i]).to_11d_vector().
+   * Large vocabularies are split across ConsciousnessConfig::thread_pool.
+   */
+  LinguisticWheelSet create_wheels(const std::string *concepts,
+                                   size_t count) const;
+  LinguisticWheelSet
+  create_wheels(const std::vector<std::string> &concepts) const {
+    return create_wheels(concepts.data(), concepts.size());
+  }
+
   /**
    * @brief Translate between two linguistic wheels
    */
@@ -3,7 +3,9 @@
 #include <cmath>
 #include <fstream>
 #include <numeric>
+#include <set>
 #include <sstream>
+#include <utility>
 
 // ================================================================
 // Utility Functions
@@ -902,74 +904,118 @@ float PPMOperatorChain::combined_value(const std::vector<int> &primes) {
 // PPMCoherenceTable
 // ================================================================
 
-PPMCoherenceTable::PPMCoherenceTable() { initialize(); }
+namespace {
 
-uint16_t PPMCoherenceTable::primes_to_bitmask(const std::vector<int> &primes) {
-  uint16_t mask = 0;
+constexpr float ppm_abs(float x) { return x < 0.0f ? -x : x; }
 
-  for (int p : primes) {
-    for (size_t i = 0; i < PPM_15_PRIMES.size(); i++) {
-      if (PPM_15_PRIMES[i] == p) {
-        mask |= (1 << i);
-        break;
-      }
+// 1 / (1 + |p_j / p_i - phi|) for every pair of the 15 primes
+struct PPMPairWeights {
+  float weight[PPM_15_PRIMES_COUNT][PPM_15_PRIMES_COUNT] = {};
+};
+
+constexpr PPMPairWeights build_pair_weights() {
+  PPMPairWeights result;
+  for (int i = 0; i < PPM_15_PRIMES_COUNT; i++) {
+    for (int j = 0; j < PPM_15_PRIMES_COUNT; j++) {
+      float ratio = static_cast<float>(PPM_15_PRIMES[j]) /
+                    static_cast<float>(PPM_15_PRIMES[i]);
+      float phi_diff = ppm_abs(ratio - static_cast<float>(GOLDEN_RATIO));
+      result.weight[i][j] = 1.0f / (1.0f + phi_diff);
     }
   }
-
-  return mask;
+  return result;
 }
 
-float PPMCoherenceTable::compute_coherence(uint16_t mask) {
+constexpr PPMPairWeights PPM_PAIR_WEIGHTS = build_pair_weights();
+
+// Golden ratio coherence of a prime subset: the mean pair weight over its
+// prime pairs, summed in ascending order
+constexpr float ppm_subset_coherence(uint32_t mask) {
   if (mask == 0)
     return 0.0f;
 
-  // Extract primes from mask
-  std::vector<int> primes;
-  for (size_t i = 0; i < PPM_15_PRIMES.size(); i++) {
-    if (mask & (1 << i)) {
-      primes.push_back(PPM_15_PRIMES[i]);
-    }
+  int members[PPM_15_PRIMES_COUNT] = {};
+  int count = 0;
+  for (int i = 0; i < PPM_15_PRIMES_COUNT; i++) {
+    if (mask & (1u << i))
+      members[count++] = i;
   }
 
-  if (primes.empty())
-    return 0.0f;
-
-  // Golden ratio coherence formula
   float sum = 0.0f;
-  for (size_t i = 0; i < primes.size(); i++) {
-    for (size_t j = i + 1; j < primes.size(); j++) {
-      float ratio =
-          static_cast<float>(primes[j]) / static_cast<float>(primes[i]);
-      float phi_diff = std::abs(ratio - static_cast<float>(GOLDEN_RATIO));
-      sum += 1.0f / (1.0f + phi_diff);
+  for (int i = 0; i < count; i++) {
+    const float *row = PPM_PAIR_WEIGHTS.weight[members[i]];
+    for (int j = i + 1; j < count; j++) {
+      sum += row[members[j]];
     }
   }
 
-  int pairs = static_cast<int>(primes.size() * (primes.size() - 1) / 2);
+  int pairs = count * (count - 1) / 2;
   return pairs > 0 ? sum / static_cast<float>(pairs) : 1.0f;
 }
 
-void PPMCoherenceTable::initialize() {
-  // Precompute coherence for all subsets of 15 primes
-  // 2^15 = 32768 combinations
-  for (uint16_t mask = 1; mask < (1 << PPM_15_PRIMES_COUNT); mask++) {
-    coherence_cache[mask] = compute_coherence(mask);
+// The table is generated in chunks, each its own constant expression, to
+// stay inside compilers' constexpr evaluation limits
+constexpr int PPM_CHUNK_BITS = 10;
+constexpr uint32_t PPM_CHUNK_SIZE = 1u << PPM_CHUNK_BITS;
+constexpr size_t PPM_CHUNK_COUNT =
+    (size_t(1) << PPM_15_PRIMES_COUNT) / PPM_CHUNK_SIZE;
+
+struct PPMCoherenceChunk {
+  float values[PPM_CHUNK_SIZE] = {};
+};
+
+constexpr PPMCoherenceChunk build_coherence_chunk(uint32_t chunk) {
+  PPMCoherenceChunk result;
+  for (uint32_t i = 0; i < PPM_CHUNK_SIZE; i++) {
+    result.values[i] = ppm_subset_coherence((chunk << PPM_CHUNK_BITS) | i);
   }
+  return result;
 }
 
-float PPMCoherenceTable::lookup(const std::vector<int> &primes) {
-  uint16_t mask = primes_to_bitmask(primes);
+template <uint32_t Chunk>
+constexpr PPMCoherenceChunk PPM_COHERENCE_CHUNK = build_coherence_chunk(Chunk);
+
+template <size_t... Chunks>
+constexpr std::array<const PPMCoherenceChunk *, sizeof...(Chunks)>
+coherence_chunk_index(std::index_sequence<Chunks...>) {
+  return {&PPM_COHERENCE_CHUNK<static_cast<uint32_t>(Chunks)>...};
+}
+
+constexpr std::array<const PPMCoherenceChunk *, PPM_CHUNK_COUNT>
+    PPM_COHERENCE_CHUNKS =
+        coherence_chunk_index(std::make_index_sequence<PPM_CHUNK_COUNT>());
+
+static_assert(PPM_COHERENCE_CHUNK<0>.values[0] == 0.0f,
+              "Empty subset has no coherence");
 
-  auto it = coherence_cache.find(mask);
-  if (it != coherence_cache.end()) {
-    return it->second;
+} // namespace
+
+uint16_t PPMCoherenceTable::primes_to_bitmask(PrimeView primes) {
+  uint16_t mask = 0;
+
+  for (int p : primes) {
+    for (size_t i = 0; i < PPM_15_PRIMES.size(); i++) {
+      if (PPM_15_PRIMES[i] == p) {
+        mask |= (1 << i);
+        break;
+      }
+    }
   }
 
-  // Fallback to computation if not in table
-  return compute_coherence(mask);
+  return mask;
+}
+
+float PPMCoherenceTable::lookup_mask(uint16_t mask) {
+  mask &= (1u << PPM_15_PRIMES_COUNT) - 1;
+  return PPM_COHERENCE_CHUNKS[mask >> PPM_CHUNK_BITS]
+      ->values[mask & (PPM_CHUNK_SIZE - 1)];
+}
+
+float PPMCoherenceTable::lookup(PrimeView primes) const {
+  return lookup_mask(primes_to_bitmask(primes));
 }
 
-float PPMCoherenceTable::pair_coherence(int p1, int p2) {
+float PPMCoherenceTable::pair_coherence(int p1, int p2) const {
   return lookup({p1, p2});
 }
 
@@ -992,7 +1038,7 @@ PPMEvolution::evolve(const TimeCrystalQuantumState &state,
   TimeCrystalQuantumState new_state = state;
 
   // Compute metrics for current state
-  auto results = chain.execute(state.prime_signature);
+  auto results = chain.execute(state.prime_signature.to_vector());
 
   // Update quantum phase based on phase path metric
   for (const auto &r : results) {
@@ -1029,7 +1075,7 @@ PPMEvolution::evolve(const TimeCrystalQuantumState &state,
 
 std::vector<PPMResult>
 PPMEvolution::compute_metrics(const TimeCrystalQuantumState &state) {
-  return default_chain->execute(state.prime_signature);
+  return default_chain->execute(state.prime_signature.to_vector());
 }
 
 bool PPMEvolution::export_phase_plot(const std::string &filename,
@@ -23,7 +23,7 @@
 // ================================================================
 
 constexpr int PPM_15_PRIMES_COUNT = 15;
-static const std::array<int, PPM_15_PRIMES_COUNT> PPM_15_PRIMES = {
+constexpr std::array<int, PPM_15_PRIMES_COUNT> PPM_15_PRIMES = {
     2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
 
 // ================================================================
@@ -355,33 +355,33 @@ private:
 
 /**
  * Precomputed coherence lookup for 15 fundamental primes
+ *
+ * The coherence of all 32 767 non-empty subsets is generated at compile
+ * time, so constructing a table costs nothing.
  */
 class PPMCoherenceTable {
 public:
-  PPMCoherenceTable();
+  PPMCoherenceTable() = default;
   ~PPMCoherenceTable() = default;
 
-  // Initialize table with precomputed values
-  void initialize();
+  // No-op: the table is built at compile time
+  void initialize() {}
 
   // Lookup coherence for prime subset
-  float lookup(const std::vector<int> &primes);
+  float lookup(PrimeView primes) const;
+
+  // Coherence of the subset whose bit i selects PPM_15_PRIMES[i]
+  static float lookup_mask(uint16_t mask);
 
   // Get coherence for prime pair
-  float pair_coherence(int p1, int p2);
+  float pair_coherence(int p1, int p2) const;
 
   // Get table size
-  size_t size() const { return coherence_cache.size(); }
+  size_t size() const { return (1u << PPM_15_PRIMES_COUNT) - 1; }
 
 private:
-  // Key: bitmask of which primes are included
-  std::map<uint16_t, float> coherence_cache;
-
   // Convert primes to bitmask
-  uint16_t primes_to_bitmask(const std::vector<int> &primes);
-
-  // Compute coherence for bitmask
-  float compute_coherence(uint16_t mask);
+  static uint16_t primes_to_bitmask(PrimeView primes);
 };
 
 // ================================================================
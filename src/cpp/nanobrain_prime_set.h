@@ -0,0 +1,194 @@
+#ifndef NANOBRAIN_PRIME_SET_H
+#define NANOBRAIN_PRIME_SET_H
+
+/**
+ * NanoBrain Inline Prime Sets
+ *
+ * Prime encodings hold a handful of primes, almost always drawn from the
+ * 15 fundamental primes, yet were std::vector<int>s copied into every atom,
+ * state and pattern. PrimeSet keeps them inline:
+ *
+ * - Up to PRIME_SET_CAPACITY primes in a fixed array, in insertion order
+ *   (duplicates allowed, like the vectors it replaces)
+ * - A bitmask of the fundamental primes present, so membership tests and
+ *   set unions over fundamental primes are single bit operations
+ *
+ * Copying a PrimeSet never allocates. Primes past the capacity are
+ * dropped and the set is marked overflowed(), so callers reading external
+ * data can reject it instead of keeping a truncated encoding. PrimeView is a non-owning (pointer, count) view that accepts a
+ * PrimeSet, a std::vector<int> or a braced list, for functions that only
+ * read primes.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+// Fundamental primes used in Phase Prime Metric calculations
+constexpr int FUNDAMENTAL_PRIMES_COUNT = 15;
+constexpr std::array<int, FUNDAMENTAL_PRIMES_COUNT> FUNDAMENTAL_PRIMES = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
+
+constexpr size_t PRIME_SET_CAPACITY = 16; // Primes stored inline
+
+// Index of prime in FUNDAMENTAL_PRIMES, or -1
+constexpr int fundamental_prime_index(int prime) {
+  for (int i = 0; i < FUNDAMENTAL_PRIMES_COUNT; i++) {
+    if (FUNDAMENTAL_PRIMES[i] == prime)
+      return i;
+  }
+  return -1;
+}
+
+class PrimeSet;
+
+/**
+ * Read-only view of a prime sequence; valid while its source lives
+ */
+class PrimeView {
+public:
+  PrimeView() = default;
+  PrimeView(const int *primes, size_t count) : ptr(primes), count(count) {}
+  PrimeView(const std::vector<int> &primes)
+      : ptr(primes.data()), count(primes.size()) {}
+  // A braced list lives until the end of the full expression, so only
+  // pass one as a function argument
+  PrimeView(std::initializer_list<int> primes)
+      : ptr(std::data(primes)), count(primes.size()) {}
+  inline PrimeView(const PrimeSet &primes);
+
+  const int *begin() const { return ptr; }
+  const int *end() const { return ptr + count; }
+  const int *data() const { return ptr; }
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  int operator[](size_t i) const { return ptr[i]; }
+
+  std::vector<int> to_vector() const { return std::vector<int>(ptr, end()); }
+
+private:
+  const int *ptr = nullptr;
+  size_t count = 0;
+};
+
+/**
+ * Fixed-capacity inline prime sequence with a fundamental-prime bitmask
+ */
+class PrimeSet {
+public:
+  using value_type = int;
+  using size_type = size_t;
+  using const_iterator = const int *;
+  using iterator = const_iterator; // Writes go through push_back/insert
+
+  PrimeSet() = default;
+  PrimeSet(std::initializer_list<int> primes) {
+    assign(primes.begin(), primes.size());
+  }
+  PrimeSet(const std::vector<int> &primes) {
+    assign(primes.data(), primes.size());
+  }
+  explicit PrimeSet(PrimeView primes) { assign(primes.data(), primes.size()); }
+
+  // For interfaces that still take std::vector<int> (allocates)
+  std::vector<int> to_vector() const {
+    return std::vector<int>(begin(), end());
+  }
+
+  // Append; false (and overflowed()) once the set is full
+  bool push_back(int prime) {
+    if (count == PRIME_SET_CAPACITY) {
+      overflow = true;
+      return false;
+    }
+    primes[count++] = prime;
+    mask |= fundamental_bit(prime);
+    return true;
+  }
+
+  // Append unless already present; true if appended
+  bool insert(int prime) {
+    if (contains(prime))
+      return false;
+    return push_back(prime);
+  }
+
+  // Append every prime of other not already present
+  void merge(PrimeView other) {
+    for (int prime : other) {
+      insert(prime);
+    }
+  }
+
+  void clear() {
+    count = 0;
+    mask = 0;
+    overflow = false;
+  }
+
+  bool contains(int prime) const {
+    int index = fundamental_prime_index(prime);
+    if (index >= 0)
+      return (mask >> index) & 1u;
+    for (size_t i = 0; i < count; i++) {
+      if (primes[i] == prime)
+        return true;
+    }
+    return false;
+  }
+
+  // Bit i set when FUNDAMENTAL_PRIMES[i] is present
+  uint16_t fundamental_mask() const { return mask; }
+
+  const int *begin() const { return primes.data(); }
+  const int *end() const { return primes.data() + count; }
+  const int *data() const { return primes.data(); }
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  bool full() const { return count == PRIME_SET_CAPACITY; }
+  // A prime was dropped since construction or the last clear()
+  bool overflowed() const { return overflow; }
+  static constexpr size_t capacity() { return PRIME_SET_CAPACITY; }
+  int operator[](size_t i) const { return primes[i]; }
+  int front() const { return primes[0]; }
+  int back() const { return primes[count - 1]; }
+
+  friend bool operator==(const PrimeSet &a, const PrimeSet &b) {
+    if (a.count != b.count || a.mask != b.mask)
+      return false;
+    for (size_t i = 0; i < a.count; i++) {
+      if (a.primes[i] != b.primes[i])
+        return false;
+    }
+    return true;
+  }
+  friend bool operator!=(const PrimeSet &a, const PrimeSet &b) {
+    return !(a == b);
+  }
+
+private:
+  std::array<int, PRIME_SET_CAPACITY> primes{};
+  uint8_t count = 0;
+  uint16_t mask = 0;
+  bool overflow = false;
+
+  static uint16_t fundamental_bit(int prime) {
+    int index = fundamental_prime_index(prime);
+    return index >= 0 ? static_cast<uint16_t>(1u << index) : 0;
+  }
+
+  void assign(const int *values, size_t n) {
+    clear();
+    for (size_t i = 0; i < n; i++) {
+      push_back(values[i]);
+    }
+  }
+};
+
+inline PrimeView::PrimeView(const PrimeSet &primes)
+    : ptr(primes.data()), count(primes.size()) {}
+
+#endif // NANOBRAIN_PRIME_SET_H
@@ -0,0 +1,580 @@
+#include "nanobrain_query.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <unordered_set>
+
+namespace {
+
+using AtomEntry = AtomSpaceIndex::AtomEntry;
+using AtomSet = AtomSpaceIndex::AtomSet;
+using LinkEntry = AtomSpaceIndex::LinkEntry;
+using LinkSet = AtomSpaceIndex::LinkSet;
+
+constexpr int NO_VARIABLE = -1;
+
+// Clause argument resolved against the pattern's variable table: a
+// variable slot, a constant atom id, or neither (wildcard)
+struct MatchTerm {
+  int variable = NO_VARIABLE;
+  const std::string *atom = nullptr;
+};
+
+struct MatchVariable {
+  Symbol type;                       // Required atom type (empty = any)
+  const std::string *name = nullptr; // Required atom name (Node terms)
+  bool hidden = false;               // Node terms are not result columns
+  bool link = false;                 // Binds a link id, not an atom
+  bool used = false;                 // Appears in some clause
+};
+
+struct MatchClause {
+  bool any_rule;
+  InferenceRuleType rule;
+  std::vector<MatchTerm> terms; // Premises, then the conclusion
+  int link_variable = NO_VARIABLE;
+};
+
+// Where a clause's candidate links come from
+struct CandidateSource {
+  size_t estimate = 0;
+  const LinkSet *links = nullptr;  // One set (incoming or rule bucket)
+  const AtomSet *domain = nullptr; // Incoming sets of these atoms...
+  size_t anchor = 0;               // ...at this term position
+};
+
+const std::string &term_value(const TimeCrystalInference &inference,
+                              size_t position) {
+  return position < inference.premise_ids.size()
+             ? inference.premise_ids[position]
+             : inference.conclusion_id;
+}
+
+class PatternMatcher {
+public:
+  PatternMatcher(const TimeCrystalKernel &kernel, const QueryPattern &pattern,
+                 size_t limit, QueryResult &result)
+      : index(kernel.get_index()), limit(limit), result(result) {
+    compile(pattern);
+  }
+
+  void run() {
+    expanded.assign(clauses.size(), 0);
+    binding.assign(variables.size(), nullptr);
+    search();
+  }
+
+private:
+  const AtomSpaceIndex &index;
+  size_t limit;
+  QueryResult &result;
+  bool done = false;
+
+  std::vector<MatchVariable> variables;
+  std::vector<int> columns;        // Visible variables, in result order
+  std::vector<int> free_variables; // Declared but in no clause
+  std::vector<MatchClause> clauses;
+  std::vector<uint8_t> expanded;
+  std::vector<const std::string *> binding;
+  std::vector<int> trail; // Variables bound since each choice point
+
+  void compile(const QueryPattern &pattern) {
+    std::map<std::string, int> named;
+    auto declare = [&](const std::string &name) {
+      auto it = named.find(name);
+      if (it != named.end())
+        return it->second;
+      int v = static_cast<int>(variables.size());
+      variables.emplace_back();
+      named.emplace(name, v);
+      columns.push_back(v);
+      result.variables.push_back(name);
+      return v;
+    };
+
+    for (const auto &declared : pattern.variables) {
+      variables[declare(declared.name)].type = declared.type;
+    }
+
+    for (const auto &clause : pattern.clauses) {
+      MatchClause compiled{clause.any_rule, clause.rule, {}, NO_VARIABLE};
+      compiled.terms.reserve(clause.premises.size() + 1);
+      auto resolve = [&](const QueryTerm &term) {
+        MatchTerm out;
+        switch (term.kind) {
+        case QueryTerm::Kind::Any:
+          break;
+        case QueryTerm::Kind::Variable:
+          out.variable = declare(term.value);
+          variables[out.variable].used = true;
+          break;
+        case QueryTerm::Kind::Atom:
+          out.atom = &term.value;
+          break;
+        case QueryTerm::Kind::Node:
+          out.variable = static_cast<int>(variables.size());
+          variables.push_back({term.type, &term.value, true, false, true});
+          break;
+        }
+        return out;
+      };
+      for (const auto &premise : clause.premises) {
+        compiled.terms.push_back(resolve(premise));
+      }
+      compiled.terms.push_back(resolve(clause.conclusion));
+      if (!clause.link_variable.empty()) {
+        compiled.link_variable = declare(clause.link_variable);
+        variables[compiled.link_variable].link = true;
+        variables[compiled.link_variable].used = true;
+      }
+      clauses.push_back(std::move(compiled));
+    }
+
+    for (int v : columns) {
+      if (!variables[v].used)
+        free_variables.push_back(v);
+    }
+  }
+
+  // ================================================================
+  // Join ordering
+  // ================================================================
+
+  const std::string *bound_value(const MatchTerm &term) const {
+    if (term.atom)
+      return term.atom;
+    return term.variable != NO_VARIABLE ? binding[term.variable] : nullptr;
+  }
+
+  static size_t size_of(const LinkSet *links) {
+    return links ? links->size() : 0;
+  }
+
+  // The cheapest place to draw this clause's candidates from, given the
+  // current bindings
+  CandidateSource candidates_for(const MatchClause &clause) const {
+    CandidateSource best;
+    if (clause.any_rule) {
+      for (const auto &bucket : index.by_rule)
+        best.estimate += bucket.size();
+    } else {
+      best.links = &index.links_of_rule(clause.rule);
+      best.estimate = best.links->size();
+    }
+
+    for (size_t position = 0; position < clause.terms.size(); position++) {
+      const MatchTerm &term = clause.terms[position];
+      if (const std::string *id = bound_value(term)) {
+        const LinkSet *incoming = index.incoming_set(*id);
+        if (size_of(incoming) < best.estimate)
+          best = {size_of(incoming), incoming, nullptr, 0};
+      } else if (term.variable != NO_VARIABLE &&
+                 variables[term.variable].name) {
+        const AtomSet *domain =
+            index.atoms_named(*variables[term.variable].name);
+        size_t estimate = 0;
+        if (domain) {
+          for (const AtomEntry *atom : *domain)
+            estimate += size_of(index.incoming_set(atom->first));
+        }
+        if (estimate < best.estimate)
+          best = {estimate, nullptr, domain, position};
+      }
+      if (best.estimate == 0)
+        break;
+    }
+    return best;
+  }
+
+  // Visit the entries of an index set until the limit is reached. The
+  // sets hash by id, so a search cut short finds the same rows every run.
+  template <typename Set, typename Fn>
+  void for_each_entry(const Set &set, Fn &&fn) {
+    for (const auto *entry : set) {
+      if (done)
+        return;
+      fn(entry);
+    }
+  }
+
+  template <typename Fn>
+  void for_each_candidate(const MatchClause &clause,
+                          const CandidateSource &source, Fn &&fn) {
+    if (source.links) {
+      for_each_entry(*source.links, [&](const LinkEntry *link) { fn(*link); });
+    } else if (source.domain) {
+      // A link can reach several domain atoms; take it only through the
+      // atom at the anchor position so it is visited once
+      for_each_entry(*source.domain, [&](const AtomEntry *atom) {
+        const LinkSet *incoming = index.incoming_set(atom->first);
+        if (!incoming)
+          return;
+        for_each_entry(*incoming, [&](const LinkEntry *link) {
+          if (clause.terms.size() - 1 == link->second.premise_ids.size() &&
+              term_value(link->second, source.anchor) == atom->first)
+            fn(*link);
+        });
+      });
+    } else {
+      for (const auto &bucket : index.by_rule) {
+        for_each_entry(bucket, [&](const LinkEntry *link) { fn(*link); });
+      }
+    }
+  }
+
+  // ================================================================
+  // Matching
+  // ================================================================
+
+  bool admits(const MatchVariable &variable, const std::string &id) const {
+    if (variable.link)
+      return true;
+    const AtomEntry *entry = index.find_atom(id);
+    if (!entry)
+      return false;
+    const TimeCrystalAtom &atom = entry->second;
+    if (!variable.type.empty() && atom.type != variable.type)
+      return false;
+    return !variable.name || atom.name == *variable.name;
+  }
+
+  bool unify(const MatchTerm &term, const std::string &value) {
+    if (term.atom)
+      return *term.atom == value;
+    if (term.variable == NO_VARIABLE)
+      return true;
+    if (const std::string *bound = binding[term.variable])
+      return *bound == value;
+    if (!admits(variables[term.variable], value))
+      return false;
+    binding[term.variable] = &value;
+    trail.push_back(term.variable);
+    return true;
+  }
+
+  bool match(const MatchClause &clause, const LinkEntry &link) {
+    const TimeCrystalInference &inference = link.second;
+    if (!clause.any_rule && inference.rule != clause.rule)
+      return false;
+    if (inference.premise_ids.size() != clause.terms.size() - 1)
+      return false;
+    for (size_t position = 0; position < clause.terms.size(); position++) {
+      if (!unify(clause.terms[position], term_value(inference, position)))
+        return false;
+    }
+    if (clause.link_variable != NO_VARIABLE)
+      return unify({clause.link_variable, nullptr}, link.first);
+    return true;
+  }
+
+  void unwind(size_t mark) {
+    while (trail.size() > mark) {
+      binding[trail.back()] = nullptr;
+      trail.pop_back();
+    }
+  }
+
+  void search() {
+    // Expand the most selective clause left
+    int next = -1;
+    CandidateSource source;
+    for (size_t c = 0; c < clauses.size(); c++) {
+      if (expanded[c])
+        continue;
+      CandidateSource candidate = candidates_for(clauses[c]);
+      if (next < 0 || candidate.estimate < source.estimate) {
+        next = static_cast<int>(c);
+        source = candidate;
+      }
+      if (source.estimate == 0)
+        break;
+    }
+    if (next < 0) {
+      bind_free(0);
+      return;
+    }
+
+    result.stats.clause_expansions++;
+    if (source.estimate == 0)
+      return;
+
+    const MatchClause &clause = clauses[next];
+    expanded[next] = 1;
+    for_each_candidate(clause, source, [&](const LinkEntry &link) {
+      result.stats.candidates++;
+      size_t mark = trail.size();
+      if (match(clause, link))
+        search();
+      unwind(mark);
+    });
+    expanded[next] = 0;
+  }
+
+  // Variables no clause constrains range over their type
+  void bind_free(size_t i) {
+    if (i == free_variables.size()) {
+      emit();
+      return;
+    }
+    int v = free_variables[i];
+    auto visit = [&](const AtomSet &atoms) {
+      for_each_entry(atoms, [&](const AtomEntry *atom) {
+        binding[v] = &atom->first;
+        bind_free(i + 1);
+      });
+      binding[v] = nullptr;
+    };
+    if (!variables[v].type.empty()) {
+      if (const AtomSet *atoms = index.atoms_of_type(variables[v].type))
+        visit(*atoms);
+    } else {
+      // Type buckets are keyed by Symbol address; take them by name so a
+      // limited search is still repeatable
+      std::vector<const std::pair<const Symbol, AtomSet> *> buckets;
+      for (const auto &bucket : index.by_type)
+        buckets.push_back(&bucket);
+      std::sort(buckets.begin(), buckets.end(),
+                [](const auto *a, const auto *b) {
+                  return a->first < b->first;
+                });
+      for (const auto *bucket : buckets) {
+        if (done)
+          return;
+        visit(bucket->second);
+      }
+    }
+  }
+
+  void emit() {
+    std::vector<std::string> row;
+    row.reserve(columns.size());
+    for (int v : columns) {
+      row.push_back(*binding[v]);
+    }
+    result.rows.push_back(std::move(row));
+    if (limit > 0 && result.rows.size() >= limit)
+      done = true;
+  }
+};
+
+InferenceRuleType clause_rule(AtomeseType type, bool &supported) {
+  supported = true;
+  switch (type) {
+  case AtomeseType::InheritanceLink:
+    return InferenceRuleType::Inheritance;
+  case AtomeseType::SimilarityLink:
+    return InferenceRuleType::Similarity;
+  case AtomeseType::ImplicationLink:
+    return InferenceRuleType::Implication;
+  default:
+    supported = false;
+    return InferenceRuleType::Inheritance;
+  }
+}
+
+bool is_variable(const AtomeseExpression &expr) {
+  return expr.type == AtomeseType::VariableNode;
+}
+
+// (ListLink (VariableNode "$x") (TypeNode "T"))
+bool is_typed_variable(const AtomeseExpression &expr) {
+  return expr.type == AtomeseType::ListLink && expr.children.size() == 2 &&
+         is_variable(*expr.children[0]) &&
+         expr.children[1]->type == AtomeseType::TypeNode;
+}
+
+bool is_declaration(const AtomeseExpression &expr) {
+  if (is_variable(expr))
+    return true;
+  if (expr.type != AtomeseType::ListLink || expr.children.empty())
+    return false;
+  for (const auto &entry : expr.children) {
+    if (!is_variable(*entry) && !is_typed_variable(*entry))
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+// ================================================================
+// AtomSpaceQueryEngine Implementation
+// ================================================================
+
+AtomSpaceQueryEngine::AtomSpaceQueryEngine(const TimeCrystalKernel *kernel)
+    : kernel(kernel) {}
+
+QueryResult AtomSpaceQueryEngine::execute(const QueryPattern &pattern,
+                                          size_t limit) const {
+  auto start = std::chrono::steady_clock::now();
+  QueryResult result;
+  if (!kernel) {
+    result.success = false;
+    result.error_message = "no kernel";
+    return result;
+  }
+
+  PatternMatcher matcher(*kernel, pattern, limit, result);
+  matcher.run();
+  std::sort(result.rows.begin(), result.rows.end());
+
+  result.stats.results = result.rows.size();
+  result.stats.elapsed_ms = std::chrono::duration<float, std::milli>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+  return result;
+}
+
+QueryResult AtomSpaceQueryEngine::execute(const AtomeseExpression &query,
+                                          size_t limit) const {
+  QueryCompileResult compiled = compile(query);
+  if (!compiled.success) {
+    QueryResult result;
+    result.success = false;
+    result.error_message = compiled.error_message;
+    return result;
+  }
+  return execute(compiled.pattern, limit);
+}
+
+QueryCompileResult
+AtomSpaceQueryEngine::compile(const AtomeseExpression &query) {
+  QueryCompileResult out;
+  auto fail = [&](const std::string &message) {
+    out.success = false;
+    out.error_message = message;
+    return out;
+  };
+
+  bool bind = query.type == AtomeseType::BindLink;
+  if (!bind && query.type != AtomeseType::GetLink)
+    return fail("expected GetLink or BindLink, got " + query.type_name());
+
+  const auto &children = query.children;
+  size_t next = 0;
+  if (children.size() >= 2 && is_declaration(*children[0])) {
+    const AtomeseExpression &decl = *children[0];
+    if (is_variable(decl)) {
+      out.pattern.variables.push_back({decl.name, Symbol()});
+    } else {
+      for (const auto &entry : decl.children) {
+        if (is_variable(*entry)) {
+          out.pattern.variables.push_back({entry->name, Symbol()});
+        } else {
+          Symbol type;
+          if (!lookup_atom_type(entry->children[1]->name, type))
+            return fail("unknown atom type " + entry->children[1]->name);
+          out.pattern.variables.push_back({entry->children[0]->name, type});
+        }
+      }
+    }
+    next = 1;
+  }
+
+  if (next >= children.size())
+    return fail("missing pattern body");
+  const AtomeseExpression &body = *children[next++];
+  if (!bind && next < children.size())
+    return fail("GetLink takes a single pattern body");
+  if (bind) {
+    if (next >= children.size())
+      return fail("BindLink needs a rewrite");
+    out.rewrite.assign(children.begin() + next, children.end());
+  }
+
+  std::vector<const AtomeseExpression *> clauses;
+  if (body.type == AtomeseType::AndLink) {
+    for (const auto &clause : body.children)
+      clauses.push_back(clause.get());
+  } else {
+    clauses.push_back(&body);
+  }
+
+  for (const AtomeseExpression *clause : clauses) {
+    bool supported = false;
+    QueryClause compiled;
+    compiled.rule = clause_rule(clause->type, supported);
+    if (!supported)
+      return fail("unsupported clause " + clause->type_name());
+    if (clause->children.size() != 2)
+      return fail(clause->type_name() + " clauses take two arguments");
+
+    for (const auto &argument : clause->children) {
+      if (is_variable(*argument)) {
+        compiled.premises.push_back(QueryTerm::variable(argument->name));
+      } else if (argument->is_node()) {
+        Symbol type;
+        if (!lookup_atom_type(argument->type_name(), type))
+          return fail("unknown atom type " + argument->type_name());
+        compiled.premises.push_back(QueryTerm::node(type, argument->name));
+      } else {
+        return fail("clause arguments must be nodes or variables, got " +
+                    argument->type_name());
+      }
+    }
+    out.pattern.clauses.push_back(std::move(compiled));
+  }
+
+  out.success = true;
+  return out;
+}
+
+std::vector<std::shared_ptr<AtomeseExpression>>
+AtomSpaceQueryEngine::instantiate(
+    const std::vector<std::shared_ptr<AtomeseExpression>> &rewrite,
+    const QueryResult &result) const {
+  std::map<std::string, size_t> column;
+  for (size_t i = 0; i < result.variables.size(); i++) {
+    column.emplace(result.variables[i], i);
+  }
+
+  const std::vector<std::string> *row = nullptr;
+  std::function<std::shared_ptr<AtomeseExpression>(const AtomeseExpression &)>
+      ground = [&](const AtomeseExpression &expr) {
+        auto out = std::make_shared<AtomeseExpression>(expr);
+        auto it = is_variable(expr) ? column.find(expr.name) : column.end();
+        if (it != column.end()) {
+          const std::string &id = (*row)[it->second];
+          const TimeCrystalAtom *atom = kernel ? kernel->get_atom(id) : nullptr;
+          out->type = atom ? AtomeseParser::string_to_type(atom->type)
+                           : AtomeseType::Unknown;
+          if (out->type == AtomeseType::Unknown)
+            out->type = AtomeseType::ConceptNode;
+          out->name = atom ? atom->name : id;
+          if (atom) {
+            out->truth_value = {atom->truth_value.strength,
+                                atom->truth_value.confidence};
+          }
+          return out;
+        }
+        for (auto &child : out->children) {
+          child = ground(*child);
+        }
+        return out;
+      };
+
+  std::vector<std::shared_ptr<AtomeseExpression>> grounded;
+  grounded.reserve(result.rows.size() * rewrite.size());
+  for (const auto &r : result.rows) {
+    row = &r;
+    for (const auto &expr : rewrite) {
+      grounded.push_back(ground(*expr));
+    }
+  }
+  return grounded;
+}
+
+std::vector<std::shared_ptr<AtomeseExpression>>
+AtomSpaceQueryEngine::bind(const AtomeseExpression &bind_link,
+                           size_t limit) const {
+  QueryCompileResult compiled = compile(bind_link);
+  if (!compiled.success || compiled.rewrite.empty()) {
+    std::cerr << "[AtomSpaceQueryEngine] "
+              << (compiled.success ? "not a BindLink" : compiled.error_message)
+              << std::endl;
+    return {};
+  }
+  return instantiate(compiled.rewrite, execute(compiled.pattern, limit));
+}
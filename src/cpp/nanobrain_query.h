@@ -0,0 +1,168 @@
+#ifndef NANOBRAIN_QUERY_H
+#define NANOBRAIN_QUERY_H
+
+/**
+ * NanoBrain AtomSpace Pattern Matcher
+ *
+ * GetLink/BindLink-style queries over a TimeCrystalKernel, answered from
+ * the kernel's AtomSpaceIndex instead of by scanning the AtomSpace.
+ *
+ * - A pattern is a conjunction of clauses over variables. A clause matches
+ *   an inference link by rule, premises (in order) and, optionally,
+ *   conclusion; it can also bind the link id to a variable
+ * - Terms are variables (optionally typed), fixed atom ids, nodes given by
+ *   type and name, or wildcards
+ * - Clauses are joined in selectivity order: each step expands the clause
+ *   with the fewest candidate links under the bindings so far, drawn from
+ *   the incoming set of its most selective bound term or from the rule
+ *   index. A query anchored on known atoms therefore costs time in
+ *   proportion to the links it touches, not to the AtomSpace
+ * - compile() turns a parsed GetLink or BindLink into a pattern, and
+ *   instantiate() grounds a BindLink rewrite once per result
+ *
+ * Queries read the kernel's live maps, so run them from the thread that
+ * mutates the kernel, between cycles.
+ */
+
+#include "nanobrain_atomese.h"
+#include "nanobrain_time_crystal.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Clause argument
+ */
+struct QueryTerm {
+  enum class Kind {
+    Any,      // Matches any atom, binds nothing
+    Variable, // value = variable name
+    Atom,     // value = atom id
+    Node      // value = node name, type = node type (empty = any)
+  };
+
+  Kind kind = Kind::Any;
+  std::string value;
+  Symbol type;
+
+  static QueryTerm any() { return {}; }
+  static QueryTerm variable(const std::string &name) {
+    return {Kind::Variable, name, Symbol()};
+  }
+  static QueryTerm atom(const std::string &id) {
+    return {Kind::Atom, id, Symbol()};
+  }
+  static QueryTerm node(Symbol type, const std::string &name) {
+    return {Kind::Node, name, type};
+  }
+};
+
+/**
+ * Declared variable: only atoms of `type` bind to it (empty = any)
+ */
+struct QueryVariable {
+  std::string name;
+  Symbol type;
+};
+
+/**
+ * One inference link to match
+ */
+struct QueryClause {
+  InferenceRuleType rule = InferenceRuleType::Inheritance;
+  bool any_rule = false;
+  std::vector<QueryTerm> premises; // Matched in order, count must match
+  QueryTerm conclusion;            // Any by default
+  std::string link_variable;       // Bound to the link id (empty = none)
+};
+
+/**
+ * Conjunction of clauses. Variables used in clauses but not declared are
+ * declared untyped, in order of first use; declared variables that no
+ * clause uses range over their type (or every atom).
+ */
+struct QueryPattern {
+  std::vector<QueryVariable> variables;
+  std::vector<QueryClause> clauses;
+};
+
+/**
+ * Matcher work for one query
+ */
+struct QueryStats {
+  size_t clause_expansions = 0; // Clauses expanded under some binding
+  size_t candidates = 0;        // Links tested against a clause
+  size_t results = 0;
+  float elapsed_ms = 0.0f;
+};
+
+/**
+ * Groundings of a pattern: one row of ids per result, columns in
+ * variable order, rows sorted. A query with a limit stops once it has
+ * that many rows; index sets iterate by id hash, so it returns the same
+ * rows for an AtomSpace built the same way.
+ */
+struct QueryResult {
+  bool success = true;
+  std::string error_message;
+  std::vector<std::string> variables;
+  std::vector<std::vector<std::string>> rows;
+  QueryStats stats;
+};
+
+/**
+ * Pattern compiled from Atomese
+ */
+struct QueryCompileResult {
+  bool success = false;
+  std::string error_message;
+  QueryPattern pattern;
+  std::vector<std::shared_ptr<AtomeseExpression>> rewrite; // BindLink only
+};
+
+/**
+ * AtomSpace Query Engine
+ *
+ * Accepted Atomese (VariableList and TypedVariableLink have no
+ * AtomeseType, so declarations use ListLink):
+ *
+ *   (GetLink [decl] body)
+ *   (BindLink [decl] body rewrite...)
+ *   decl := (VariableNode "$x")
+ *         | (ListLink entry...)
+ *   entry := (VariableNode "$x")
+ *          | (ListLink (VariableNode "$x") (TypeNode "ConceptNode"))
+ *   body := clause | (AndLink clause...)
+ *   clause := (InheritanceLink a b) | (SimilarityLink a b)
+ *           | (ImplicationLink a b)
+ *
+ * Clause arguments are VariableNodes or nodes matched by type and name.
+ */
+class AtomSpaceQueryEngine {
+public:
+  explicit AtomSpaceQueryEngine(const TimeCrystalKernel *kernel);
+
+  // Groundings of pattern; stop after limit rows (0 = all)
+  QueryResult execute(const QueryPattern &pattern, size_t limit = 0) const;
+
+  // Compile and run a GetLink or BindLink
+  QueryResult execute(const AtomeseExpression &query, size_t limit = 0) const;
+
+  static QueryCompileResult compile(const AtomeseExpression &query);
+
+  // The rewrite of a BindLink, grounded with each row of result
+  std::vector<std::shared_ptr<AtomeseExpression>>
+  instantiate(const std::vector<std::shared_ptr<AtomeseExpression>> &rewrite,
+              const QueryResult &result) const;
+
+  // Compile, run and instantiate a BindLink
+  std::vector<std::shared_ptr<AtomeseExpression>>
+  bind(const AtomeseExpression &bind_link, size_t limit = 0) const;
+
+private:
+  const TimeCrystalKernel *kernel;
+};
+
+#endif // NANOBRAIN_QUERY_H
@@ -0,0 +1,107 @@
+#include "nanobrain_random.h"
+#include "nanobrain_thread_pool.h"
+#include <algorithm>
+
+// ================================================================
+// Helpers
+// ================================================================
+
+namespace {
+
+// splitmix64 finalizer, to spread seeds over the Philox key
+uint64_t mix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+// Smallest fill worth a thread of its own
+constexpr size_t FILL_GRAIN = 1 << 16;
+
+} // namespace
+
+// ================================================================
+// CounterRng Implementation
+// ================================================================
+
+CounterRng::CounterRng(uint64_t seed, RandomSubsystem subsystem,
+                       uint64_t entity, uint64_t step) {
+  // Low step and entity words go in the counter; the rest joins the key
+  uint64_t key = mix64(mix64(seed) ^
+                       (static_cast<uint64_t>(subsystem) << 32 | (step >> 32)));
+  key0 = static_cast<uint32_t>(key);
+  key1 = static_cast<uint32_t>(key >> 32);
+  counter1 = static_cast<uint32_t>(step);
+  counter2 = static_cast<uint32_t>(entity);
+  counter3 = static_cast<uint32_t>(entity >> 32);
+}
+
+void CounterRng::fill_uniform(float *out, size_t n, float lo, float hi,
+                              NanoBrainThreadPool *pool) const {
+  if (!pool || n < 2 * FILL_GRAIN) {
+    fill_range(out, 0, n, lo, hi);
+    return;
+  }
+
+  // Chunks start on block boundaries; values only depend on the index
+  size_t grain = (pool->grain_for(n, FILL_GRAIN) + 3) & ~static_cast<size_t>(3);
+  pool->parallel_for(0, n, grain, [&](size_t begin, size_t end) {
+    fill_range(out, begin, end, lo, hi);
+  });
+}
+
+void CounterRng::fill_range(float *out, size_t begin, size_t end, float lo,
+                            float hi) const {
+  const float range = hi - lo;
+  size_t i = begin;
+
+  // Head up to a block boundary
+  for (; i < end && (i & 3) != 0; i++) {
+    out[i] = lo + range * random_unit_float(at(i));
+  }
+
+  // Whole blocks, LANES at a time: the rounds run on structure-of-arrays
+  // words so the compiler can vectorize the 32x32->64 multiplies
+  constexpr size_t LANES = 8;
+  while (i + 4 * LANES <= end) {
+    uint32_t c0[LANES], c1[LANES], c2[LANES], c3[LANES];
+    uint32_t first = static_cast<uint32_t>(i >> 2);
+    for (size_t l = 0; l < LANES; l++) {
+      c0[l] = first + static_cast<uint32_t>(l);
+      c1[l] = counter1;
+      c2[l] = counter2;
+      c3[l] = counter3;
+    }
+
+    uint32_t k0 = key0, k1 = key1;
+    for (int round = 0; round < Philox4x32::ROUNDS; round++) {
+      for (size_t l = 0; l < LANES; l++) {
+        uint64_t p0 = static_cast<uint64_t>(Philox4x32::M0) * c0[l];
+        uint64_t p1 = static_cast<uint64_t>(Philox4x32::M1) * c2[l];
+        uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+        uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+        c1[l] = static_cast<uint32_t>(p1);
+        c3[l] = static_cast<uint32_t>(p0);
+        c0[l] = n0;
+        c2[l] = n2;
+      }
+      k0 += Philox4x32::W0;
+      k1 += Philox4x32::W1;
+    }
+
+    for (size_t l = 0; l < LANES; l++) {
+      float *dst = out + i + 4 * l;
+      dst[0] = lo + range * random_unit_float(c0[l]);
+      dst[1] = lo + range * random_unit_float(c1[l]);
+      dst[2] = lo + range * random_unit_float(c2[l]);
+      dst[3] = lo + range * random_unit_float(c3[l]);
+    }
+    i += 4 * LANES;
+  }
+
+  // Tail
+  for (; i < end; i++) {
+    out[i] = lo + range * random_unit_float(at(i));
+  }
+}
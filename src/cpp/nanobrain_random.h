@@ -0,0 +1,150 @@
+#ifndef NANOBRAIN_RANDOM_H
+#define NANOBRAIN_RANDOM_H
+
+/**
+ * NanoBrain Counter-Based Random Numbers
+ *
+ * Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2,
+ * 3", SC'11): a keyed bijection from a 128-bit counter to 128 random bits.
+ * Nothing is shared or sequential, so every draw is addressed by
+ * (seed, subsystem, entity, step, index):
+ *
+ * - seed + subsystem form the key, so engines never share a stream
+ * - entity (atom, cell, spin, tensor...) and step (cycle, generation)
+ *   select a stream; index is the position within it
+ *
+ * A value depends only on its address, never on which thread drew it or
+ * what was drawn before, so parallel code is bit-identical for any thread
+ * count and every run with the same seed is reproducible.
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+class NanoBrainThreadPool;
+
+// Default seed for engines without a seed in their config
+constexpr uint64_t NANOBRAIN_DEFAULT_SEED = 0x4E616E6F427261ull;
+
+/**
+ * Random stream owners (part of the key)
+ */
+enum class RandomSubsystem : uint32_t {
+  TensorInit = 1,
+  TimeCrystal,
+  FractalTape,
+  FractalCondensation,
+  Consciousness,
+  Creativity,
+  HardwareThermal,
+  Microtubule,
+  TubulinRing,
+  WaterChannel,
+  CellularAutomaton,
+  WilczekInit,
+  WilczekDisorder,
+  Ontogenesis
+};
+
+/**
+ * Philox4x32-10 block function
+ */
+struct Philox4x32 {
+  using Block = std::array<uint32_t, 4>;
+
+  static constexpr uint32_t M0 = 0xD2511F53u; // Round multipliers
+  static constexpr uint32_t M1 = 0xCD9E8D57u;
+  static constexpr uint32_t W0 = 0x9E3779B9u; // Key schedule (Weyl)
+  static constexpr uint32_t W1 = 0xBB67AE85u;
+  static constexpr int ROUNDS = 10;
+
+  static Block generate(Block counter, uint32_t k0, uint32_t k1) {
+    for (int round = 0; round < ROUNDS; round++) {
+      uint64_t p0 = static_cast<uint64_t>(M0) * counter[0];
+      uint64_t p1 = static_cast<uint64_t>(M1) * counter[2];
+      counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ k0,
+                 static_cast<uint32_t>(p1),
+                 static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ k1,
+                 static_cast<uint32_t>(p0)};
+      k0 += W0;
+      k1 += W1;
+    }
+    return counter;
+  }
+};
+
+// [0, 1) with 24 bits of precision
+inline float random_unit_float(uint32_t bits) {
+  return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * Counter-based random stream for one (seed, subsystem, entity, step)
+ *
+ * Copyable and cheap to construct: create one per entity/step where the
+ * values are needed instead of sharing a generator. Sequential draws walk
+ * the stream's index; at() and fill_uniform() address it directly. Also a
+ * UniformRandomBitGenerator, but the distributions below are preferred:
+ * std:: distributions differ between standard libraries.
+ */
+class CounterRng {
+public:
+  using result_type = uint32_t;
+
+  CounterRng(uint64_t seed, RandomSubsystem subsystem, uint64_t entity = 0,
+             uint64_t step = 0);
+
+  // Draw at a stream index, without advancing
+  uint32_t at(uint64_t index) const {
+    Philox4x32::Block block = Philox4x32::generate(
+        {static_cast<uint32_t>(index >> 2), counter1, counter2, counter3},
+        key0, key1);
+    return block[index & 3];
+  }
+
+  result_type operator()() {
+    if (lane == 4) {
+      buffer = Philox4x32::generate(
+          {next_block++, counter1, counter2, counter3}, key0, key1);
+      lane = 0;
+    }
+    return buffer[lane++];
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+  // [0, 1)
+  float uniform() { return random_unit_float((*this)()); }
+
+  // [lo, hi)
+  float uniform(float lo, float hi) { return lo + (hi - lo) * uniform(); }
+
+  // Box-Muller, one value per two draws
+  float normal(float mean = 0.0f, float stddev = 1.0f) {
+    float u1 = 1.0f - uniform(); // (0, 1]
+    float u2 = uniform();
+    return mean + stddev * std::sqrt(-2.0f * std::log(u1)) *
+                      std::cos(6.2831853f * u2);
+  }
+
+  // out[i] = uniform value at stream index i, in [lo, hi). Large fills are
+  // split across the pool when one is given; the result does not depend on
+  // the split.
+  void fill_uniform(float *out, size_t n, float lo, float hi,
+                    NanoBrainThreadPool *pool = nullptr) const;
+
+private:
+  uint32_t key0, key1;
+  uint32_t counter1, counter2, counter3; // Step and entity words
+  uint32_t next_block = 0;
+  uint32_t lane = 4;
+  Philox4x32::Block buffer{};
+
+  void fill_range(float *out, size_t begin, size_t end, float lo,
+                  float hi) const;
+};
+
+#endif // NANOBRAIN_RANDOM_H
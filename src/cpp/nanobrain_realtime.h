@@ -0,0 +1,217 @@
+#ifndef NANOBRAIN_REALTIME_H
+#define NANOBRAIN_REALTIME_H
+
+/**
+ * NanoBrain Real-Time Primitives
+ *
+ * Building blocks for loops with a latency budget (time circuit pipelines,
+ * the avatar's sensor -> motor loop). Each one allocates only in its
+ * constructor; afterwards no operation locks or touches the heap:
+ *
+ * - SpscQueue: bounded single-producer single-consumer queue
+ * - DoubleBuffer: fixed-size float array published by one writer and
+ *   read, whole and untorn, by any thread
+ * - LatencyHistogram: fixed-bucket latency samples with percentiles
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Bounded lock-free single-producer single-consumer queue
+ */
+template <typename T> class SpscQueue {
+public:
+  // Capacity is rounded up to a power of two
+  explicit SpscQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+    slots.resize(size);
+    mask = size - 1;
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  // Producer side; false if full
+  bool try_push(T &item) {
+    size_t tail = tail_index.load(std::memory_order_relaxed);
+    if (tail - head_cache == slots.size()) {
+      head_cache = head_index.load(std::memory_order_acquire);
+      if (tail - head_cache == slots.size())
+        return false;
+    }
+    slots[tail & mask] = std::move(item);
+    tail_index.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side; false if empty
+  bool try_pop(T &item) {
+    size_t head = head_index.load(std::memory_order_relaxed);
+    if (head == tail_cache) {
+      tail_cache = tail_index.load(std::memory_order_acquire);
+      if (head == tail_cache)
+        return false;
+    }
+    item = std::move(slots[head & mask]);
+    head_index.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Producer: no more items will be pushed
+  void close() { closed.store(true, std::memory_order_release); }
+  bool is_closed() const { return closed.load(std::memory_order_acquire); }
+
+  size_t capacity() const { return slots.size(); }
+
+private:
+  std::vector<T> slots;
+  size_t mask = 0;
+
+  // Producer and consumer indices on separate cache lines, each with a
+  // cached copy of the other side's index
+  alignas(64) std::atomic<size_t> tail_index{0};
+  size_t head_cache = 0;
+  alignas(64) std::atomic<size_t> head_index{0};
+  size_t tail_cache = 0;
+  alignas(64) std::atomic<bool> closed{false};
+};
+
+/**
+ * Double-buffered float array: one writer, readers on any thread
+ *
+ * publish() fills the back buffer and flips it to the front by bumping
+ * the version. Each buffer carries a seqlock sequence that is odd while
+ * the writer fills it; read() copies the front and retries if its
+ * sequence was odd or changed meanwhile (a reader that falls two publishes
+ * behind sees the writer reuse its buffer), so readers never block the
+ * writer and never see a half-written array.
+ */
+class DoubleBuffer {
+public:
+  explicit DoubleBuffer(size_t count)
+      : values(new std::atomic<float>[2 * count]), count(count) {
+    for (size_t i = 0; i < 2 * count; i++)
+      values[i].store(0.0f, std::memory_order_relaxed);
+    for (auto &s : sequence)
+      s.store(0, std::memory_order_relaxed);
+  }
+
+  DoubleBuffer(const DoubleBuffer &) = delete;
+  DoubleBuffer &operator=(const DoubleBuffer &) = delete;
+
+  // Writer side; missing trailing values are published as 0
+  void publish(const float *source, size_t source_count) {
+    uint64_t next = version.load(std::memory_order_relaxed) + 1;
+    std::atomic<float> *back = values.get() + (next & 1) * count;
+    std::atomic<uint64_t> &seq = sequence[next & 1];
+    uint64_t start = seq.load(std::memory_order_relaxed) + 1; // Odd
+    seq.store(start, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    size_t copied = std::min(source_count, count);
+    for (size_t i = 0; i < copied; i++)
+      back[i].store(source[i], std::memory_order_relaxed);
+    for (size_t i = copied; i < count; i++)
+      back[i].store(0.0f, std::memory_order_relaxed);
+    seq.store(start + 1, std::memory_order_release);
+    version.store(next, std::memory_order_release);
+  }
+
+  // Copies size() values into out; returns the version read
+  uint64_t read(float *out) const {
+    for (;;) {
+      uint64_t before = version.load(std::memory_order_acquire);
+      const std::atomic<uint64_t> &seq = sequence[before & 1];
+      uint64_t start = seq.load(std::memory_order_acquire);
+      if (start & 1)
+        continue; // Writer is refilling this buffer
+      const std::atomic<float> *front = values.get() + (before & 1) * count;
+      for (size_t i = 0; i < count; i++)
+        out[i] = front[i].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) == start)
+        return before;
+    }
+  }
+
+  // Number of publishes so far
+  uint64_t get_version() const {
+    return version.load(std::memory_order_acquire);
+  }
+  size_t size() const { return count; }
+
+private:
+  std::unique_ptr<std::atomic<float>[]> values; // Two buffers of `count`
+  size_t count;
+  std::atomic<uint64_t> version{0}; // Front buffer is version & 1
+  std::atomic<uint64_t> sequence[2]; // Per buffer; odd while being written
+};
+
+/**
+ * Fixed-bucket latency histogram: one writer, readers on any thread
+ *
+ * Samples land in `buckets` buckets of `bucket_ns` each, the last one
+ * collecting everything slower; percentiles report a bucket's upper bound
+ * and max() is exact.
+ */
+class LatencyHistogram {
+public:
+  explicit LatencyHistogram(size_t buckets = 4096, uint64_t bucket_ns = 1000)
+      : counts(new std::atomic<uint64_t>[std::max<size_t>(buckets, 1)]),
+        bucket_count(std::max<size_t>(buckets, 1)), bucket_ns(bucket_ns) {
+    reset();
+  }
+
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+  void record(uint64_t ns) {
+    size_t bucket = std::min<uint64_t>(ns / bucket_ns, bucket_count - 1);
+    counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    samples.fetch_add(1, std::memory_order_relaxed);
+    if (ns > max_ns.load(std::memory_order_relaxed))
+      max_ns.store(ns, std::memory_order_relaxed);
+  }
+
+  // Latency that `fraction` (0..1) of the samples do not exceed; 0 if empty
+  uint64_t percentile(double fraction) const {
+    uint64_t total = samples.load(std::memory_order_relaxed);
+    if (total == 0)
+      return 0;
+    uint64_t rank = static_cast<uint64_t>(fraction * total);
+    rank = std::min(std::max<uint64_t>(rank, 1), total);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucket_count; i++) {
+      seen += counts[i].load(std::memory_order_relaxed);
+      if (seen >= rank)
+        return std::min((i + 1) * bucket_ns, max());
+    }
+    return max();
+  }
+
+  uint64_t max() const { return max_ns.load(std::memory_order_relaxed); }
+  uint64_t count() const { return samples.load(std::memory_order_relaxed); }
+
+  // Not safe against a concurrent record()
+  void reset() {
+    for (size_t i = 0; i < bucket_count; i++)
+      counts[i].store(0, std::memory_order_relaxed);
+    samples.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::unique_ptr<std::atomic<uint64_t>[]> counts;
+  size_t bucket_count;
+  uint64_t bucket_ns;
+  std::atomic<uint64_t> samples{0};
+  std::atomic<uint64_t> max_ns{0};
+};
+
+#endif // NANOBRAIN_REALTIME_H
@@ -1,4 +1,5 @@
 #include "nanobrain_reasoning.h"
+#include "nanobrain_trace.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -200,6 +201,8 @@ void RecursiveReasoningEngine::clear_all_chains() {
 ReasoningStats RecursiveReasoningEngine::execute_reasoning_step(
     const std::vector<NodeTensor *> &node_tensors,
     const std::vector<LinkTensor *> &link_tensors) {
+  NB_TRACE_SCOPE("reasoning",
+                 "RecursiveReasoningEngine::execute_reasoning_step");
 
   ReasoningStats stats;
   stats.total_chains = chains.size();
@@ -512,9 +515,8 @@ NanoBrainTensor *RecursiveReasoningEngine::compose_tensors(
   }
 
   // Normalize
-  auto *count = kernel->create_tensor({1});
-  std::vector<float> count_data = {static_cast<float>(tensors.size())};
-  kernel->set_data(count, count_data);
+  auto *count =
+      kernel->create_tensor_from({static_cast<float>(tensors.size())});
   result = kernel->div(result, count);
 
   return result;
@@ -170,13 +170,19 @@ DeserializationResult AtomSpaceSerializer::deserialize_from_file(
     in.read(reinterpret_cast<char *>(&atom_count), sizeof(atom_count));
 
     for (uint32_t i = 0; i < atom_count; i++) {
-      TimeCrystalAtom atom = read_atom_binary(in);
+      TimeCrystalAtom atom;
+      if (!read_atom_binary(in, atom)) {
+        result.error_message =
+            "Invalid atom record " + std::to_string(i) +
+            " (truncated, unknown type or too many primes)";
+        return result;
+      }
 
       // Create atom in kernel
       TruthValue tv = {atom.truth_value.strength, atom.truth_value.confidence,
                        atom.truth_value.count};
       kernel->create_atom(atom.type, atom.name, tv.strength, tv.confidence,
-                          atom.prime_encoding);
+                          atom.prime_encoding.to_vector());
       result.atoms_loaded++;
     }
   } else {
@@ -520,9 +526,8 @@ bool AtomSpaceSerializer::read_binary_header(std::ifstream &in) {
   return magic == BINARY_MAGIC && version == BINARY_VERSION;
 }
 
-TimeCrystalAtom AtomSpaceSerializer::read_atom_binary(std::ifstream &in) {
-  TimeCrystalAtom atom;
-
+bool AtomSpaceSerializer::read_atom_binary(std::ifstream &in,
+                                           TimeCrystalAtom &atom) {
   // Read ID
   uint16_t id_len = 0;
   in.read(reinterpret_cast<char *>(&id_len), sizeof(id_len));
@@ -532,8 +537,10 @@ TimeCrystalAtom AtomSpaceSerializer::read_atom_binary(std::ifstream &in) {
   // Read Type
   uint16_t type_len = 0;
   in.read(reinterpret_cast<char *>(&type_len), sizeof(type_len));
-  atom.type.resize(type_len);
-  in.read(&atom.type[0], type_len);
+  std::string type(type_len, '\0');
+  in.read(&type[0], type_len);
+  if (!in || !lookup_atom_type(type, atom.type))
+    return false;
 
   // Read Name
   uint16_t name_len = 0;
@@ -551,12 +558,14 @@ TimeCrystalAtom AtomSpaceSerializer::read_atom_binary(std::ifstream &in) {
   // Read prime encoding
   uint16_t prime_count = 0;
   in.read(reinterpret_cast<char *>(&prime_count), sizeof(prime_count));
-  atom.prime_encoding.resize(prime_count);
+  if (prime_count > PRIME_SET_CAPACITY)
+    return false;
+  atom.prime_encoding.clear();
   for (uint16_t i = 0; i < prime_count; i++) {
     int prime = 0;
     in.read(reinterpret_cast<char *>(&prime), sizeof(prime));
-    atom.prime_encoding[i] = prime;
+    atom.prime_encoding.push_back(prime);
   }
 
-  return atom;
+  return static_cast<bool>(in);
 }
@@ -211,7 +211,8 @@ private:
   void write_binary_header(std::ofstream &out);
   void write_atom_binary(std::ofstream &out, const TimeCrystalAtom &atom);
   bool read_binary_header(std::ifstream &in);
-  TimeCrystalAtom read_atom_binary(std::ifstream &in);
+  // False for a truncated record, an unknown type or too many primes
+  bool read_atom_binary(std::ifstream &in, TimeCrystalAtom &atom);
 };
 
 // ================================================================
@@ -0,0 +1,723 @@
+#include "nanobrain_sharded.h"
+#include "nanobrain_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+// ================================================================
+// Helpers
+// ================================================================
+
+namespace {
+
+// FNV-1a, so shard assignment is stable across runs and platforms
+uint64_t fnv1a(const void *data, size_t len,
+               uint64_t hash = 1469598103934665603ull) {
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+float elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<float, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+template <typename T>
+void move_append(std::vector<T> &dst, std::vector<T> &src) {
+  if (dst.empty()) {
+    dst.swap(src);
+  } else {
+    dst.insert(dst.end(), std::make_move_iterator(src.begin()),
+               std::make_move_iterator(src.end()));
+  }
+  src.clear();
+}
+
+} // namespace
+
+// ================================================================
+// ShardMailbox Implementation
+// ================================================================
+
+void ShardMailbox::clear() {
+  subscriptions.clear();
+  replica_updates.clear();
+  attention_deltas.clear();
+  inference_requests.clear();
+}
+
+void ShardMailbox::append(ShardMailbox &other) {
+  move_append(subscriptions, other.subscriptions);
+  move_append(replica_updates, other.replica_updates);
+  move_append(attention_deltas, other.attention_deltas);
+  move_append(inference_requests, other.inference_requests);
+}
+
+// ================================================================
+// Shard Ids
+// ================================================================
+
+std::string make_shard_id(int shard, const std::string &local_id) {
+  return std::to_string(shard) + ":" + local_id;
+}
+
+bool split_shard_id(const std::string &id, int shard_count, int &shard,
+                    std::string &local_id) {
+  size_t colon = id.find(':');
+  if (colon == 0 || colon == std::string::npos || colon > 9)
+    return false;
+
+  int index = 0;
+  for (size_t i = 0; i < colon; i++) {
+    if (id[i] < '0' || id[i] > '9')
+      return false;
+    index = index * 10 + (id[i] - '0');
+  }
+  if (index >= shard_count)
+    return false;
+
+  shard = index;
+  local_id = id.substr(colon + 1);
+  return true;
+}
+
+int assign_shard(const std::string &name,
+                 const std::vector<int> &prime_encoding,
+                 ShardPartitioning partitioning, int shard_count) {
+  if (shard_count <= 1)
+    return 0;
+
+  uint64_t hash;
+  if (partitioning == ShardPartitioning::Locality) {
+    std::vector<int> primes = prime_encoding;
+    std::sort(primes.begin(), primes.end());
+    hash = fnv1a(primes.data(), primes.size() * sizeof(int));
+  } else {
+    hash = fnv1a(name.data(), name.size());
+  }
+  return static_cast<int>(hash % static_cast<uint64_t>(shard_count));
+}
+
+ShardedNanoBrainMetrics
+combine_shard_metrics(const std::vector<ShardStatus> &statuses) {
+  ShardedNanoBrainMetrics metrics;
+  metrics.shard_count = statuses.size();
+  if (statuses.empty())
+    return metrics;
+
+  NanoBrainMetrics &combined = metrics.combined;
+  float weight_total = 0.0f;
+  float step_total = 0.0f;
+
+  for (const auto &status : statuses) {
+    const NanoBrainMetrics &m = status.metrics;
+    size_t ghosts = status.ghost_atoms;
+    size_t owned = m.total_atoms - std::min(ghosts, m.total_atoms);
+
+    metrics.atoms_per_shard.push_back(owned);
+    metrics.ghost_atoms += ghosts;
+    metrics.cross_shard_links += status.cross_shard_links;
+    metrics.max_shard_ms = std::max(metrics.max_shard_ms, status.step_ms);
+    step_total += status.step_ms;
+
+    combined.total_atoms += owned;
+    combined.total_links += m.total_links;
+    combined.inference_rate += m.inference_rate;
+
+    float w = static_cast<float>(m.total_atoms);
+    weight_total += w;
+    combined.average_attention += m.average_attention * w;
+    combined.quantum_coherence += m.quantum_coherence * w;
+    combined.temporal_stability += m.temporal_stability * w;
+    combined.prime_alignment += m.prime_alignment * w;
+    combined.fractal_complexity += m.fractal_complexity * w;
+    combined.consciousness_emergence += m.consciousness_emergence * w;
+  }
+
+  if (weight_total > 0.0f) {
+    combined.average_attention /= weight_total;
+    combined.quantum_coherence /= weight_total;
+    combined.temporal_stability /= weight_total;
+    combined.prime_alignment /= weight_total;
+    combined.fractal_complexity /= weight_total;
+    combined.consciousness_emergence /= weight_total;
+  }
+
+  float mean_step = step_total / statuses.size();
+  metrics.load_imbalance =
+      mean_step > 0.0f ? metrics.max_shard_ms / mean_step : 1.0f;
+  return metrics;
+}
+
+// ================================================================
+// AtomSpaceShard Implementation
+// ================================================================
+
+AtomSpaceShard::AtomSpaceShard(int idx, int count,
+                               const ShardedNanoBrainConfig &config)
+    : index(idx), shard_count(std::max(1, count)),
+      publish_candidates(config.cross_shard_reasoning && count > 1),
+      candidate_count(config.cross_shard_candidates) {
+  // Stepping nests inside the shard's chunk on the same pool
+  TimeCrystalConfig kernel_config = config.shard_config;
+  kernel_config.thread_pool = config.thread_pool;
+  // Independent random streams per shard
+  kernel_config.seed += static_cast<uint64_t>(index);
+  kernel = std::make_unique<TimeCrystalKernel>(kernel_config);
+  outbox.resize(shard_count);
+}
+
+void AtomSpaceShard::step() {
+  NB_TRACE_SCOPE("sharded", "AtomSpaceShard::step");
+  auto start = std::chrono::steady_clock::now();
+
+  apply_inbox();
+  kernel->process_cycle();
+  if (!cross_links.empty()) {
+    kernel->spread_attention(cross_links);
+  }
+  emit_outbox();
+
+  step_ms = elapsed_ms(start);
+}
+
+std::string AtomSpaceShard::link_remote(const std::string &local_premise,
+                                        const std::string &remote_id,
+                                        const TimeCrystalAtom &record,
+                                        InferenceRuleType rule) {
+  bool created = false;
+  std::string ghost = ensure_ghost(remote_id, record, created);
+  if (ghost.empty())
+    return ghost;
+  if (created) {
+    int owner;
+    std::string owner_local;
+    if (split_shard_id(remote_id, shard_count, owner, owner_local)) {
+      outbox[owner].subscriptions.push_back({owner_local, index});
+    }
+  }
+
+  std::string link = kernel->create_inference(local_premise, ghost, rule);
+  if (!link.empty()) {
+    add_cross_link(link);
+  }
+  return link;
+}
+
+std::string AtomSpaceShard::ensure_ghost(const std::string &remote_id,
+                                         const TimeCrystalAtom &record,
+                                         bool &created) {
+  created = false;
+  auto it = ghosts.find(remote_id);
+  if (it != ghosts.end())
+    return it->second;
+
+  std::string local = kernel->create_atom(
+      record.type, record.name, record.truth_value, record.attention_value,
+      record.prime_encoding, record.fractal_geometry);
+  if (local.empty())
+    return local;
+
+  kernel->set_temporal_coherence(local,
+                                 record.time_crystal_state.temporal_coherence);
+  kernel->set_quantum_phase(local, record.time_crystal_state.quantum_phase);
+
+  ghosts[remote_id] = local;
+  ghost_sources[local] = remote_id;
+  ghost_baseline_sti[local] = record.attention_value.sti;
+  created = true;
+  return local;
+}
+
+void AtomSpaceShard::subscribe(const std::string &atom_id, int subscriber) {
+  auto &holders = subscribers[atom_id];
+  if (std::find(holders.begin(), holders.end(), subscriber) ==
+      holders.end()) {
+    holders.push_back(subscriber);
+  }
+}
+
+void AtomSpaceShard::add_cross_link(const std::string &link_id) {
+  if (cross_link_ids.insert(link_id).second) {
+    cross_links.push_back(link_id);
+  }
+}
+
+void AtomSpaceShard::prune_cross_links() {
+  cross_links.erase(
+      std::remove_if(cross_links.begin(), cross_links.end(),
+                     [this](const std::string &link_id) {
+                       if (kernel->get_inference(link_id))
+                         return false;
+                       cross_link_ids.erase(link_id);
+                       return true;
+                     }),
+      cross_links.end());
+}
+
+ShardStatus AtomSpaceShard::status() const {
+  return {kernel->get_metrics(), ghosts.size(), cross_links.size(), step_ms};
+}
+
+void AtomSpaceShard::apply_inbox() {
+  for (const auto &sub : inbox.subscriptions) {
+    subscribe(sub.atom_id, sub.subscriber);
+  }
+
+  // Ghosts take their owner's latest attention and state
+  for (const auto &update : inbox.replica_updates) {
+    auto it = ghosts.find(update.source_id);
+    if (it == ghosts.end())
+      continue;
+    TimeCrystalAtom *ghost = kernel->get_mutable_atom(it->second);
+    if (!ghost)
+      continue;
+    ghost->attention_value = update.attention;
+    kernel->set_temporal_coherence(it->second, update.temporal_coherence);
+    kernel->set_quantum_phase(it->second, update.quantum_phase);
+    ghost_baseline_sti[it->second] = update.attention.sti;
+  }
+
+  for (const auto &delta : inbox.attention_deltas) {
+    TimeCrystalAtom *atom = kernel->get_mutable_atom(delta.target_id);
+    if (atom) {
+      atom->attention_value.sti += delta.sti_delta;
+    }
+  }
+
+  for (const auto &request : inbox.inference_requests) {
+    link_remote(request.local_premise, request.remote_id,
+                request.remote_record, request.rule);
+  }
+
+  inbox.clear();
+}
+
+void AtomSpaceShard::emit_outbox() {
+  // Refresh every ghost of our atoms
+  for (auto it = subscribers.begin(); it != subscribers.end();) {
+    const TimeCrystalAtom *atom = kernel->get_atom(it->first);
+    if (!atom) {
+      it = subscribers.erase(it);
+      continue;
+    }
+    ShardReplicaUpdate update{make_shard_id(index, it->first),
+                              atom->attention_value,
+                              atom->time_crystal_state.temporal_coherence,
+                              atom->time_crystal_state.quantum_phase};
+    for (int holder : it->second) {
+      outbox[holder].replica_updates.push_back(update);
+    }
+    ++it;
+  }
+
+  // Return attention our ghosts gained this cycle to their owners. Losses
+  // stay local: the owner applies its own ECAN decay, so returning the
+  // ghost's decay would charge the owner again for every shard holding one
+  for (const auto &[local, source] : ghost_sources) {
+    const TimeCrystalAtom *ghost = kernel->get_atom(local);
+    if (!ghost)
+      continue;
+    float &baseline = ghost_baseline_sti[local];
+    float delta = ghost->attention_value.sti - baseline;
+    baseline = ghost->attention_value.sti;
+    if (delta <= 0.0f)
+      continue;
+
+    int owner;
+    std::string owner_local;
+    if (split_shard_id(source, shard_count, owner, owner_local)) {
+      outbox[owner].attention_deltas.push_back({owner_local, delta});
+    }
+  }
+
+  // Publish top owned atoms for cross-shard pairing
+  candidates.clear();
+  if (publish_candidates) {
+    for (const auto &local :
+         kernel->get_top_attention_atoms(candidate_count + ghosts.size())) {
+      if (candidates.size() == candidate_count)
+        break;
+      if (is_ghost(local))
+        continue;
+      candidates.push_back(
+          {make_shard_id(index, local), *kernel->get_atom(local)});
+    }
+  }
+}
+
+// ================================================================
+// ShardExchange Implementation
+// ================================================================
+
+ShardExchange::ShardExchange(size_t shard_count,
+                             const ShardedNanoBrainConfig &config)
+    : reasoning(config.cross_shard_reasoning),
+      candidate_count(config.cross_shard_candidates),
+      resonance_threshold(config.cross_shard_resonance),
+      pending(shard_count) {}
+
+size_t
+ShardExchange::route(const std::vector<std::vector<ShardMailbox> *> &outboxes,
+                     const std::vector<ShardMailbox *> &inboxes) {
+  // Source order is fixed, so delivery is deterministic
+  size_t delivered = 0;
+  for (size_t dst = 0; dst < inboxes.size(); dst++) {
+    ShardMailbox &inbox = *inboxes[dst];
+    inbox.append(pending[dst]);
+    for (auto *outbox : outboxes) {
+      if (dst < outbox->size()) {
+        inbox.append((*outbox)[dst]);
+      }
+    }
+    delivered += inbox.size();
+  }
+  return delivered;
+}
+
+void ShardExchange::pair(
+    const std::vector<const std::vector<ShardCandidate> *> &candidates) {
+  if (!reasoning || candidates.size() < 2)
+    return;
+
+  // Global top atoms, as a single kernel's PLN step would see them
+  struct Candidate {
+    size_t shard;
+    const ShardCandidate *entry;
+  };
+  std::vector<Candidate> top;
+  for (size_t s = 0; s < candidates.size(); s++) {
+    for (const auto &entry : *candidates[s]) {
+      top.push_back({s, &entry});
+    }
+  }
+  size_t k = std::min(candidate_count, top.size());
+  std::partial_sort(top.begin(), top.begin() + k, top.end(),
+                    [](const Candidate &a, const Candidate &b) {
+                      return a.entry->atom.attention_value.sti >
+                             b.entry->atom.attention_value.sti;
+                    });
+
+  // Same-shard pairs are covered by each shard's own PLN step
+  for (size_t i = 0; i < k; i++) {
+    for (size_t j = i + 1; j < k; j++) {
+      const Candidate &a = top[i];
+      const Candidate &b = top[j];
+      if (a.shard == b.shard || a.shard >= pending.size())
+        continue;
+
+      float resonance = TimeCrystalKernel::calculate_geometric_resonance(
+          a.entry->atom.fractal_geometry, b.entry->atom.fractal_geometry);
+      if (resonance <= resonance_threshold)
+        continue;
+
+      // A pair is inferred when it enters the top set, not again while it
+      // stays there
+      std::pair<std::string, std::string> key(a.entry->id, b.entry->id);
+      bool inferred = paired.count(key) > 0;
+      pairing.insert(std::move(key));
+      if (inferred)
+        continue;
+
+      pending[a.shard].inference_requests.push_back(
+          {a.entry->atom.id, b.entry->id, b.entry->atom,
+           InferenceRuleType::Similarity});
+    }
+  }
+  paired.swap(pairing);
+  pairing.clear();
+}
+
+// ================================================================
+// ShardedNanoBrainKernel Implementation
+// ================================================================
+
+ShardedNanoBrainKernel::ShardedNanoBrainKernel(
+    const ShardedNanoBrainConfig &cfg)
+    : config(cfg),
+      exchange(static_cast<size_t>(std::max(1, cfg.shard_count)), cfg) {
+  int n = std::max(1, config.shard_count);
+  for (int i = 0; i < n; i++) {
+    shards.push_back(std::make_unique<AtomSpaceShard>(i, n, config));
+  }
+}
+
+ShardedNanoBrainKernel::~ShardedNanoBrainKernel() { shutdown(); }
+
+void ShardedNanoBrainKernel::initialize() {
+  if (active)
+    return;
+
+  size_t atoms = 0;
+  for (auto &shard : shards) {
+    shard->kernel->initialize();
+    atoms += shard->kernel->get_all_atom_ids().size();
+  }
+
+  active = true;
+  std::cout << "[ShardedNanoBrainKernel] Initialized " << shards.size()
+            << " shards with " << atoms << " atoms" << std::endl;
+}
+
+void ShardedNanoBrainKernel::shutdown() {
+  if (active) {
+    std::cout << "[ShardedNanoBrainKernel] Shutdown after " << cycle_count
+              << " cycles" << std::endl;
+  }
+  active = false;
+}
+
+// ================================================================
+// Atom Management
+// ================================================================
+
+std::string ShardedNanoBrainKernel::create_atom(
+    const std::string &type, const std::string &name, const TruthValue &tv,
+    const AttentionValue &av, const std::vector<int> &prime_encoding,
+    const GeometricPattern &geometry) {
+  int index = select_shard(name, prime_encoding);
+  std::string local = shards[index]->kernel->create_atom(
+      type, name, tv, av, prime_encoding, geometry);
+  return local.empty() ? local : make_shard_id(index, local);
+}
+
+const TimeCrystalAtom *
+ShardedNanoBrainKernel::get_atom(const std::string &id) const {
+  int index;
+  std::string local;
+  if (!split_id(id, index, local))
+    return nullptr;
+  return shards[index]->kernel->get_atom(local);
+}
+
+bool ShardedNanoBrainKernel::remove_atom(const std::string &id) {
+  int index;
+  std::string local;
+  if (!split_id(id, index, local))
+    return false;
+  AtomSpaceShard &shard = *shards[index];
+
+  auto ghost = shard.ghost_sources.find(local);
+  if (ghost != shard.ghost_sources.end()) {
+    // Dropping a ghost ends the owner's replica updates to this shard
+    int owner;
+    std::string owner_local;
+    if (split_id(ghost->second, owner, owner_local)) {
+      auto subs = shards[owner]->subscribers.find(owner_local);
+      if (subs != shards[owner]->subscribers.end()) {
+        auto &holders = subs->second;
+        holders.erase(std::remove(holders.begin(), holders.end(), index),
+                      holders.end());
+        if (holders.empty()) {
+          shards[owner]->subscribers.erase(subs);
+        }
+      }
+    }
+    shard.ghosts.erase(ghost->second);
+    shard.ghost_baseline_sti.erase(local);
+    shard.ghost_sources.erase(ghost);
+  } else {
+    // Removing an owned atom takes its ghosts with it
+    auto subs = shard.subscribers.find(local);
+    if (subs != shard.subscribers.end()) {
+      for (int holder_index : subs->second) {
+        AtomSpaceShard &holder = *shards[holder_index];
+        auto it = holder.ghosts.find(id);
+        if (it == holder.ghosts.end())
+          continue;
+        holder.kernel->remove_atom(it->second);
+        holder.ghost_sources.erase(it->second);
+        holder.ghost_baseline_sti.erase(it->second);
+        holder.ghosts.erase(it);
+        holder.prune_cross_links();
+      }
+      shard.subscribers.erase(subs);
+    }
+  }
+
+  // The kernel takes the atom's links with it; forget the cross-shard ones
+  bool removed = shard.kernel->remove_atom(local);
+  if (removed) {
+    shard.prune_cross_links();
+  }
+  return removed;
+}
+
+std::vector<std::string> ShardedNanoBrainKernel::get_all_atom_ids() const {
+  std::vector<std::string> ids;
+  for (const auto &shard : shards) {
+    for (const auto &local : shard->kernel->get_all_atom_ids()) {
+      if (!shard->ghost_sources.count(local)) {
+        ids.push_back(make_shard_id(shard->index, local));
+      }
+    }
+  }
+  return ids;
+}
+
+std::vector<std::string>
+ShardedNanoBrainKernel::get_top_attention_atoms(size_t k) const {
+  std::vector<std::pair<std::string, float>> scored_atoms;
+  for (const auto &shard : shards) {
+    auto &kernel = *shard->kernel;
+    size_t taken = 0;
+    for (const auto &local :
+         kernel.get_top_attention_atoms(k + shard->ghosts.size())) {
+      if (taken == k)
+        break;
+      if (shard->ghost_sources.count(local))
+        continue;
+      scored_atoms.push_back({make_shard_id(shard->index, local),
+                              kernel.get_atom(local)->attention_value.sti});
+      taken++;
+    }
+  }
+
+  std::sort(scored_atoms.begin(), scored_atoms.end(),
+            [](const auto &a, const auto &b) { return a.second > b.second; });
+
+  std::vector<std::string> result;
+  result.reserve(std::min(k, scored_atoms.size()));
+  for (size_t i = 0; i < std::min(k, scored_atoms.size()); i++) {
+    result.push_back(scored_atoms[i].first);
+  }
+  return result;
+}
+
+std::string ShardedNanoBrainKernel::create_inference(
+    const std::string &atom1_id, const std::string &atom2_id,
+    InferenceRuleType rule) {
+  int shard1, shard2;
+  std::string local1, local2;
+  if (!split_id(atom1_id, shard1, local1) ||
+      !split_id(atom2_id, shard2, local2))
+    return "";
+
+  AtomSpaceShard &home = *shards[shard1];
+  if (shard1 == shard2) {
+    std::string link = home.kernel->create_inference(local1, local2, rule);
+    return link.empty() ? link : make_shard_id(shard1, link);
+  }
+
+  // Between cycles the shards are idle, so the ghost can be set up directly
+  const TimeCrystalAtom *remote = shards[shard2]->kernel->get_atom(local2);
+  if (!remote)
+    return "";
+
+  bool created = false;
+  std::string ghost = home.ensure_ghost(atom2_id, *remote, created);
+  if (ghost.empty())
+    return "";
+  if (created) {
+    shards[shard2]->subscribe(local2, shard1);
+  }
+
+  std::string link = home.kernel->create_inference(local1, ghost, rule);
+  if (link.empty())
+    return link;
+  home.add_cross_link(link);
+  return make_shard_id(shard1, link);
+}
+
+// ================================================================
+// Processing Cycle
+// ================================================================
+
+void ShardedNanoBrainKernel::process_cycle() {
+  if (!active)
+    return;
+
+  NB_TRACE_SCOPE("sharded", "ShardedNanoBrainKernel::process_cycle");
+  auto cycle_start = std::chrono::steady_clock::now();
+
+  // 1. Deliver last cycle's mail
+  last_messages = route_mailboxes();
+  float exchange_ms = elapsed_ms(cycle_start);
+
+  // 2. Cycle every shard, one pool chunk each
+  {
+    NB_TRACE_SCOPE("sharded", "shard_cycles");
+    if (config.thread_pool) {
+      config.thread_pool->run_chunks(shards.size(),
+                                     [this](size_t i) { shards[i]->step(); });
+    } else {
+      for (auto &shard : shards) {
+        shard->step();
+      }
+    }
+  }
+
+  // 3. Pair top atoms across shards for the next cycle
+  auto pairing_start = std::chrono::steady_clock::now();
+  pair_cross_shard_candidates();
+  exchange_ms += elapsed_ms(pairing_start);
+
+  last_exchange_ms = exchange_ms;
+  last_cycle_ms = elapsed_ms(cycle_start);
+  cycle_count++;
+}
+
+void ShardedNanoBrainKernel::run_cycles(int n) {
+  for (int i = 0; i < n; i++) {
+    process_cycle();
+  }
+}
+
+size_t ShardedNanoBrainKernel::route_mailboxes() {
+  std::vector<std::vector<ShardMailbox> *> outboxes;
+  std::vector<ShardMailbox *> inboxes;
+  for (auto &shard : shards) {
+    outboxes.push_back(&shard->outbox);
+    inboxes.push_back(&shard->inbox);
+  }
+  return exchange.route(outboxes, inboxes);
+}
+
+void ShardedNanoBrainKernel::pair_cross_shard_candidates() {
+  std::vector<const std::vector<ShardCandidate> *> candidates;
+  for (const auto &shard : shards) {
+    candidates.push_back(&shard->candidates);
+  }
+  exchange.pair(candidates);
+}
+
+// ================================================================
+// Shards
+// ================================================================
+
+TimeCrystalKernel *ShardedNanoBrainKernel::get_shard(int index) {
+  if (index < 0 || index >= get_shard_count())
+    return nullptr;
+  return shards[index]->kernel.get();
+}
+
+int ShardedNanoBrainKernel::select_shard(
+    const std::string &name, const std::vector<int> &prime_encoding) const {
+  return assign_shard(name, prime_encoding, config.partitioning,
+                      get_shard_count());
+}
+
+int ShardedNanoBrainKernel::shard_of(const std::string &id) const {
+  int index;
+  std::string local;
+  return split_id(id, index, local) ? index : -1;
+}
+
+ShardedNanoBrainMetrics ShardedNanoBrainKernel::get_metrics() const {
+  std::vector<ShardStatus> statuses;
+  for (const auto &shard : shards) {
+    statuses.push_back(shard->status());
+  }
+
+  ShardedNanoBrainMetrics metrics = combine_shard_metrics(statuses);
+  metrics.messages_delivered = last_messages;
+  metrics.cycle_ms = last_cycle_ms;
+  metrics.exchange_ms = last_exchange_ms;
+  return metrics;
+}
@@ -0,0 +1,366 @@
+#ifndef NANOBRAIN_SHARDED_H
+#define NANOBRAIN_SHARDED_H
+
+/**
+ * NanoBrain Sharded AtomSpace
+ *
+ * Partitions the AtomSpace across N TimeCrystalKernel shards, cycled in
+ * parallel as chunks of a shared NanoBrainThreadPool. Shards never touch each other's state during a
+ * cycle; everything that crosses a shard boundary is batched into
+ * per-destination mailboxes and delivered between cycles:
+ *
+ * - Replica updates: an atom referenced by another shard is mirrored there
+ *   as a ghost atom, refreshed from its owner every cycle
+ * - Attention deltas: STI a ghost gains locally (ECAN allocation, link
+ *   diffusion) flows back to the owning atom
+ * - Inference requests: cross-shard PLN pairs are run on the shard owning
+ *   the first premise, with the second premise as a ghost
+ *
+ * Atom and link ids are shard-qualified ("<shard>:<local id>").
+ */
+
+#include "nanobrain_time_crystal.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * How atoms are assigned to shards
+ */
+enum class ShardPartitioning {
+  Hash,    // By atom name
+  Locality // By prime signature: atoms with the same primes share a shard
+};
+
+/**
+ * Sharded kernel configuration
+ */
+struct ShardedNanoBrainConfig {
+  int shard_count = 4;
+  ShardPartitioning partitioning = ShardPartitioning::Hash;
+
+  // Per-shard kernel settings (memory_size is per shard; thread_pool is
+  // replaced by the one below)
+  TimeCrystalConfig shard_config;
+
+  // Cycles the shards, one chunk each, and steps inside them (not owned;
+  // nullptr = shards cycle one after another on the calling thread)
+  NanoBrainThreadPool *thread_pool = nullptr;
+
+  // Cross-shard reasoning: at each cycle boundary the global top atoms are
+  // paired across shards, as local PLN pairs a shard's own top atoms
+  bool cross_shard_reasoning = true;
+  size_t cross_shard_candidates = 10; // Top atoms considered, as in local PLN
+  float cross_shard_resonance = 0.5f; // Geometric resonance threshold
+};
+
+/**
+ * Ghost refresh sent from an atom's owner to every shard holding a ghost
+ */
+struct ShardReplicaUpdate {
+  std::string source_id; // Global id of the owning atom
+  AttentionValue attention;
+  float temporal_coherence;
+  float quantum_phase;
+};
+
+/**
+ * STI a ghost accumulated since its last refresh, sent back to the owner
+ */
+struct ShardAttentionDelta {
+  std::string target_id; // Owner-local atom id
+  float sti_delta;
+};
+
+/**
+ * Cross-shard inference, run on the shard owning local_premise
+ */
+struct ShardInferenceRequest {
+  std::string local_premise;
+  std::string remote_id;         // Global id of the second premise
+  TimeCrystalAtom remote_record; // Used to create its ghost if needed
+  InferenceRuleType rule;
+};
+
+/**
+ * Ghost registration, so the owner starts sending replica updates
+ */
+struct ShardSubscription {
+  std::string atom_id; // Owner-local atom id
+  int subscriber;      // Shard holding the ghost
+};
+
+/**
+ * Batched messages for one shard, delivered at a cycle boundary
+ */
+struct ShardMailbox {
+  std::vector<ShardSubscription> subscriptions;
+  std::vector<ShardReplicaUpdate> replica_updates;
+  std::vector<ShardAttentionDelta> attention_deltas;
+  std::vector<ShardInferenceRequest> inference_requests;
+
+  size_t size() const {
+    return subscriptions.size() + replica_updates.size() +
+           attention_deltas.size() + inference_requests.size();
+  }
+  void clear();
+  void append(ShardMailbox &other); // Moves other's messages, clears it
+};
+
+/**
+ * Top owned atom a shard publishes for cross-shard pairing
+ */
+struct ShardCandidate {
+  std::string id; // Global id
+  TimeCrystalAtom atom;
+};
+
+// Shard-qualified ids: "<shard>:<local id>"
+std::string make_shard_id(int shard, const std::string &local_id);
+bool split_shard_id(const std::string &id, int shard_count, int &shard,
+                    std::string &local_id);
+
+// Shard an atom with this name/primes is assigned to
+int assign_shard(const std::string &name,
+                 const std::vector<int> &prime_encoding,
+                 ShardPartitioning partitioning, int shard_count);
+
+/**
+ * Sharded kernel metrics
+ */
+struct ShardedNanoBrainMetrics {
+  NanoBrainMetrics combined{}; // Atom-weighted across shards (ghosts
+                               // excluded from total_atoms)
+  size_t shard_count = 0;
+  std::vector<size_t> atoms_per_shard; // Owned atoms, without ghosts
+  size_t ghost_atoms = 0;
+  size_t cross_shard_links = 0;
+  size_t messages_delivered = 0; // At the start of the last cycle
+
+  // Last cycle timings
+  float cycle_ms = 0.0f;
+  float exchange_ms = 0.0f;    // Mailbox routing + cross-shard pairing
+  float max_shard_ms = 0.0f;   // Slowest shard
+  float load_imbalance = 1.0f; // Slowest shard / mean shard time
+};
+
+/**
+ * Per-shard statistics, combined into ShardedNanoBrainMetrics
+ */
+struct ShardStatus {
+  NanoBrainMetrics metrics{};
+  size_t ghost_atoms = 0;
+  size_t cross_shard_links = 0;
+  float step_ms = 0.0f;
+};
+
+// Combine shard statistics (exchange and timing fields are left to the
+// caller)
+ShardedNanoBrainMetrics
+combine_shard_metrics(const std::vector<ShardStatus> &statuses);
+
+/**
+ * One AtomSpace partition: a TimeCrystalKernel plus the ghost and
+ * subscription bookkeeping for atoms crossing its boundary.
+ *
+ * step() consumes the inbox and fills the per-destination outbox without
+ * touching any other shard, so shards can step concurrently in one process
+ * (ShardedNanoBrainKernel) or in separate worker processes
+ * (nanobrain_distributed.h).
+ */
+struct AtomSpaceShard {
+  AtomSpaceShard(int index, int shard_count,
+                 const ShardedNanoBrainConfig &config);
+
+  int index = 0;
+  int shard_count = 1;
+  std::unique_ptr<TimeCrystalKernel> kernel;
+
+  // Ghosts of remote atoms held by this shard
+  std::unordered_map<std::string, std::string> ghosts; // global -> local
+  std::unordered_map<std::string, std::string> ghost_sources; // reverse
+  std::unordered_map<std::string, float> ghost_baseline_sti;
+
+  // Owned atoms mirrored elsewhere: local id -> subscriber shards
+  std::map<std::string, std::vector<int>> subscribers;
+
+  // Local link ids with a ghost premise (diffused every cycle)
+  std::vector<std::string> cross_links;
+  std::unordered_set<std::string> cross_link_ids;
+
+  ShardMailbox inbox;
+  std::vector<ShardMailbox> outbox; // Indexed by destination shard
+
+  // Top atoms published for cross-shard pairing
+  std::vector<ShardCandidate> candidates;
+
+  float step_ms = 0.0f;
+
+  // Apply the inbox, cycle the kernel, diffuse across cross-shard links and
+  // fill the outbox
+  void step();
+
+  // Link a local atom to a remote one through its ghost. A new ghost queues
+  // a subscription to the owner in the outbox.
+  std::string link_remote(const std::string &local_premise,
+                          const std::string &remote_id,
+                          const TimeCrystalAtom &record,
+                          InferenceRuleType rule);
+
+  std::string ensure_ghost(const std::string &remote_id,
+                           const TimeCrystalAtom &record, bool &created);
+  void subscribe(const std::string &atom_id, int subscriber);
+  void add_cross_link(const std::string &link_id);
+  // Drop cross links whose inference the kernel no longer holds
+  void prune_cross_links();
+
+  bool is_ghost(const std::string &local_id) const {
+    return ghost_sources.count(local_id) != 0;
+  }
+  ShardStatus status() const;
+
+private:
+  bool publish_candidates;
+  size_t candidate_count;
+
+  void apply_inbox();
+  void emit_outbox();
+};
+
+/**
+ * Cycle-boundary exchange between shards
+ *
+ * Routes outboxes into inboxes in a fixed source order and turns the global
+ * top candidates into cross-shard inference requests. The in-process and
+ * distributed kernels share it, so both deliver the same mail.
+ */
+class ShardExchange {
+public:
+  ShardExchange(size_t shard_count, const ShardedNanoBrainConfig &config);
+
+  // Append queued requests, then outboxes[src][dst] for every src, to
+  // inboxes[dst]; returns the number of messages delivered
+  size_t route(const std::vector<std::vector<ShardMailbox> *> &outboxes,
+               const std::vector<ShardMailbox *> &inboxes);
+
+  // Queue inference requests for cross-shard pairs among the global top
+  // candidates (candidates[s] is shard s's list) that were not already
+  // paired in the previous round
+  void pair(const std::vector<const std::vector<ShardCandidate> *> &candidates);
+
+private:
+  bool reasoning;
+  size_t candidate_count;
+  float resonance_threshold;
+
+  std::vector<ShardMailbox> pending; // Indexed by destination shard
+
+  // Resonant pairs of the last round and of the current one; at most
+  // candidate_count^2 / 2 each, however long the kernel runs
+  std::set<std::pair<std::string, std::string>> paired;
+  std::set<std::pair<std::string, std::string>> pairing;
+};
+
+
+/**
+ * Sharded NanoBrain Kernel
+ *
+ * Mirrors the TimeCrystalKernel atom API with shard-qualified ids. All
+ * methods must be called from one controlling thread, between cycles.
+ */
+class ShardedNanoBrainKernel {
+public:
+  explicit ShardedNanoBrainKernel(const ShardedNanoBrainConfig &config);
+  ~ShardedNanoBrainKernel();
+
+  ShardedNanoBrainKernel(const ShardedNanoBrainKernel &) = delete;
+  ShardedNanoBrainKernel &operator=(const ShardedNanoBrainKernel &) = delete;
+
+  // ================================================================
+  // Lifecycle
+  // ================================================================
+
+  // Initialize every shard kernel (shards step on the shared thread pool)
+  void initialize();
+
+  // Deactivate the kernel; process_cycle() is a no-op until initialize()
+  void shutdown();
+
+  bool is_active() const { return active; }
+
+  // ================================================================
+  // Atom Management
+  // ================================================================
+
+  std::string create_atom(const std::string &type, const std::string &name,
+                          const TruthValue &tv, const AttentionValue &av,
+                          const std::vector<int> &prime_encoding,
+                          const GeometricPattern &geometry);
+
+  const TimeCrystalAtom *get_atom(const std::string &id) const;
+  bool remove_atom(const std::string &id);
+
+  // Owned atoms of every shard (ghosts excluded)
+  std::vector<std::string> get_all_atom_ids() const;
+  std::vector<std::string> get_top_attention_atoms(size_t k) const;
+
+  // Link two atoms; a cross-shard link lives on the first atom's shard
+  std::string create_inference(const std::string &atom1_id,
+                               const std::string &atom2_id,
+                               InferenceRuleType rule);
+
+  // ================================================================
+  // Processing Cycle
+  // ================================================================
+
+  // Deliver mailboxes, cycle every shard in parallel, then pair top atoms
+  // across shards for the next cycle
+  void process_cycle();
+  void run_cycles(int n);
+
+  // ================================================================
+  // Shards
+  // ================================================================
+
+  int get_shard_count() const { return static_cast<int>(shards.size()); }
+  TimeCrystalKernel *get_shard(int index);
+
+  // Shard the atom with this name/primes would be assigned to
+  int select_shard(const std::string &name,
+                   const std::vector<int> &prime_encoding) const;
+
+  // Shard of a shard-qualified id, or -1 if malformed
+  int shard_of(const std::string &id) const;
+
+  ShardedNanoBrainMetrics get_metrics() const;
+  size_t get_cycle_count() const { return cycle_count; }
+
+private:
+  ShardedNanoBrainConfig config;
+  std::vector<std::unique_ptr<AtomSpaceShard>> shards;
+  bool active = false;
+  size_t cycle_count = 0;
+
+  ShardExchange exchange;
+
+  // Last cycle statistics
+  size_t last_messages = 0;
+  float last_cycle_ms = 0.0f;
+  float last_exchange_ms = 0.0f;
+
+  size_t route_mailboxes();
+  void pair_cross_shard_candidates();
+
+  bool split_id(const std::string &id, int &shard,
+                std::string &local_id) const {
+    return split_shard_id(id, get_shard_count(), shard, local_id);
+  }
+};
+
+#endif // NANOBRAIN_SHARDED_H
@@ -4,7 +4,6 @@
 #include <cmath>
 #include <iostream>
 #include <numeric>
-#include <random>
 #include <sstream>
 
 // ================================================================
@@ -86,7 +85,10 @@ float TripletResonance::total_harmonic() const {
 
 TubulinPPMModel::TubulinPPMModel(NanoBrainKernel *kernel,
                                  TimeCrystalKernel *tc_kernel)
-    : kernel_(kernel), tc_kernel_(tc_kernel) {}
+    : kernel_(kernel), tc_kernel_(tc_kernel),
+      seed_(tc_kernel ? tc_kernel->get_seed()
+            : kernel  ? kernel->get_seed()
+                      : NANOBRAIN_DEFAULT_SEED) {}
 
 void TubulinPPMModel::initialize(int num_rings) {
   if (initialized_)
@@ -119,13 +121,14 @@ TubulinRing TubulinPPMModel::create_alpha_helix_ring(int ring_id,
   ring.rotation_angle = calculate_spiral_angle(ring_id);
 
   // Generate protofilament phases (13 protofilaments)
-  static std::mt19937 rng(42);
-  static std::uniform_real_distribution<float> phase_dist(0.0f, 2.0f * PI);
+  CounterRng rng(seed_, RandomSubsystem::TubulinRing,
+                 static_cast<uint64_t>(ring_id) * 2 + (is_alpha ? 1 : 0));
 
   for (int i = 0; i < TUBULIN_PROTOFILAMENTS; i++) {
     // Phase based on position around cylinder + random variation
     float base_phase = (2.0f * PI * i) / TUBULIN_PROTOFILAMENTS;
-    ring.protofilament_phases[i] = base_phase + phase_dist(rng) * 0.1f;
+    ring.protofilament_phases[i] =
+        base_phase + rng.uniform(0.0f, 2.0f * PI) * 0.1f;
   }
 
   // Generate PPM for this ring
@@ -180,11 +183,11 @@ WaterChannel TubulinPPMModel::encode_water_channel(float length_nm) {
   int num_zones = static_cast<int>(length_nm / 4.0f); // One zone per 4nm
   channel.coherence_zones.reserve(num_zones);
 
-  static std::mt19937 rng(123);
-  static std::uniform_real_distribution<float> coherence_dist(0.6f, 1.0f);
+  CounterRng rng(seed_, RandomSubsystem::WaterChannel, 0,
+                 channels_encoded_++);
 
   for (int i = 0; i < num_zones; i++) {
-    channel.coherence_zones.push_back(coherence_dist(rng));
+    channel.coherence_zones.push_back(rng.uniform(0.6f, 1.0f));
   }
 
   // Use water-specific primes (hydrogen bonding related)
@@ -277,10 +280,7 @@ NanoBrainTensor *TubulinPPMModel::create_structure_tensor() {
   if (!initialized_)
     return nullptr;
 
-  // Create tensor: [num_rings, protofilaments, 2(phase, coherence)]
-  auto *tensor = kernel_->create_tensor(
-      {static_cast<int64_t>(rings_.size()), TUBULIN_PROTOFILAMENTS, 2});
-
+  // Tensor data: [num_rings, protofilaments, 2(phase, coherence)]
   std::vector<float> data;
   data.reserve(rings_.size() * TUBULIN_PROTOFILAMENTS * 2);
 
@@ -291,8 +291,9 @@ NanoBrainTensor *TubulinPPMModel::create_structure_tensor() {
     }
   }
 
-  kernel_->set_data(tensor, data);
-  return tensor;
+  return kernel_->create_tensor_from(
+      {static_cast<int64_t>(rings_.size()), TUBULIN_PROTOFILAMENTS, 2},
+      data.data(), data.size());
 }
 
 NanoBrainTensor *TubulinPPMModel::get_protofilament_tensor(int ring_id) {
@@ -300,11 +301,8 @@ NanoBrainTensor *TubulinPPMModel::get_protofilament_tensor(int ring_id) {
   if (!ring)
     return nullptr;
 
-  auto *tensor = kernel_->create_tensor({TUBULIN_PROTOFILAMENTS});
-  std::vector<float> phases(ring->protofilament_phases.begin(),
-                            ring->protofilament_phases.end());
-  kernel_->set_data(tensor, phases);
-  return tensor;
+  return kernel_->create_tensor_from(ring->protofilament_phases.data(),
+                                     ring->protofilament_phases.size());
 }
 
 std::vector<int> TubulinPPMModel::generate_ring_primes(int ring_id,
@@ -578,6 +576,7 @@ void CellularAutomatonEngine::initialize(int width, int height) {
   }
 
   initialized_ = true;
+  tiles_valid_ = false;
   std::cout << "[CellularAutomatonEngine] Initialized " << width << "x"
             << height << " grid" << std::endl;
 }
@@ -594,31 +593,35 @@ void CellularAutomatonEngine::set_initial_state(
       state_.grid[y][x] = state[y][x] != 0 ? 1 : 0;
     }
   }
+  tiles_valid_ = false;
 }
 
-void CellularAutomatonEngine::randomize(float density) {
+void CellularAutomatonEngine::randomize(float density, uint64_t seed) {
   if (!initialized_)
     return;
 
-  static std::mt19937 rng(std::random_device{}());
-  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-
+  // One stream per row, so rows are independent of the grid width
+  const uint64_t call = randomize_calls_++;
   for (int y = 0; y < state_.height; y++) {
+    CounterRng rng(seed, RandomSubsystem::CellularAutomaton, y, call);
     for (int x = 0; x < state_.width; x++) {
-      state_.grid[y][x] = (dist(rng) < density) ? 1 : 0;
+      state_.grid[y][x] = (random_unit_float(rng.at(x)) < density) ? 1 : 0;
     }
   }
+  tiles_valid_ = false;
 }
 
 void CellularAutomatonEngine::set_rule(int rule_number) {
   rule_number_ = rule_number % 256;
   state_.rule_number = rule_number_;
   state_.rule_name = "Rule" + std::to_string(rule_number_);
+  tiles_valid_ = false;
 }
 
 void CellularAutomatonEngine::set_custom_rule(RuleFunction rule) {
   custom_rule_ = rule;
   state_.rule_name = "Custom";
+  tiles_valid_ = false;
 }
 
 void CellularAutomatonEngine::apply_ppm_rules(const std::vector<int> &primes) {
@@ -671,23 +674,35 @@ void CellularAutomatonEngine::update_parallel() {
     new_grid[y].resize(state_.width);
   }
 
-  // Parallel update (simulated - actual parallelism would use std::thread)
-  for (int y = 0; y < state_.height; y++) {
-    for (int x = 0; x < state_.width; x++) {
-      if (custom_rule_) {
-        new_grid[y][x] = custom_rule_(x, y, state_);
-      } else {
-        // Use top row as 1D CA neighborhood
-        int left = state_.grid[y][(x - 1 + state_.width) % state_.width];
-        int center = state_.grid[y][x];
-        int right = state_.grid[y][(x + 1) % state_.width];
-        new_grid[y][x] = apply_elementary_rule(left, center, right);
+  auto update_rows = [&](size_t first, size_t last) {
+    for (size_t y = first; y < last; y++) {
+      for (int x = 0; x < state_.width; x++) {
+        if (custom_rule_) {
+          new_grid[y][x] = custom_rule_(x, static_cast<int>(y), state_);
+        } else {
+          // Use top row as 1D CA neighborhood
+          int left = state_.grid[y][(x - 1 + state_.width) % state_.width];
+          int center = state_.grid[y][x];
+          int right = state_.grid[y][(x + 1) % state_.width];
+          new_grid[y][x] = apply_elementary_rule(left, center, right);
+        }
       }
     }
+  };
+
+  // Rows only read the previous generation, so they split freely
+  const size_t rows = static_cast<size_t>(state_.height);
+  if (thread_pool_) {
+    size_t min_rows = CA_MIN_PARALLEL_CELLS / (state_.width + 1) + 1;
+    thread_pool_->parallel_for(0, rows, thread_pool_->grain_for(rows, min_rows),
+                               update_rows);
+  } else {
+    update_rows(0, rows);
   }
 
   state_.grid = std::move(new_grid);
   state_.generation++;
+  tiles_valid_ = false;
 }
 
 void CellularAutomatonEngine::run(int generations) {
@@ -696,6 +711,115 @@ void CellularAutomatonEngine::run(int generations) {
   }
 }
 
+void CellularAutomatonEngine::update_sparse() {
+  if (!initialized_)
+    return;
+  if (custom_rule_) {
+    update_parallel();
+    return;
+  }
+
+  // A cell whose neighbourhood did not change keeps its value, so only
+  // tiles touched by the last generation's changes are recomputed
+  const int width = state_.width;
+  const uint32_t tiles_per_row = (width + CA_TILE_WIDTH - 1) / CA_TILE_WIDTH;
+  const uint32_t tile_count = tiles_per_row * state_.height;
+  if (!tiles_valid_ || sparse_pass_ == UINT32_MAX) {
+    active_tiles_.resize(tile_count);
+    std::iota(active_tiles_.begin(), active_tiles_.end(), 0u);
+    tile_stamp_.assign(tile_count, 0);
+    sparse_pass_ = 0;
+    tiles_valid_ = true;
+  }
+
+  // New values first, so every tile reads its neighbours' old cells
+  tile_scratch_.resize(active_tiles_.size() * CA_TILE_WIDTH);
+  for (size_t t = 0; t < active_tiles_.size(); t++) {
+    uint32_t tile = active_tiles_[t];
+    const std::vector<int> &row = state_.grid[tile / tiles_per_row];
+    int x0 = static_cast<int>(tile % tiles_per_row) * CA_TILE_WIDTH;
+    int x1 = std::min(width, x0 + CA_TILE_WIDTH);
+    int *out = tile_scratch_.data() + t * CA_TILE_WIDTH;
+    for (int x = x0; x < x1; x++) {
+      int left = row[x == 0 ? width - 1 : x - 1];
+      int right = row[x + 1 == width ? 0 : x + 1];
+      out[x - x0] = apply_elementary_rule(left, row[x], right);
+    }
+  }
+
+  // Write back; a changed tile queues itself, plus the neighbour tile
+  // sharing an edge cell that changed
+  const uint32_t pass = ++sparse_pass_;
+  std::vector<uint32_t> next;
+  auto queue = [&](uint32_t tile) {
+    if (tile_stamp_[tile] != pass) {
+      tile_stamp_[tile] = pass;
+      next.push_back(tile);
+    }
+  };
+  for (size_t t = 0; t < active_tiles_.size(); t++) {
+    uint32_t tile = active_tiles_[t];
+    std::vector<int> &row = state_.grid[tile / tiles_per_row];
+    uint32_t column = tile % tiles_per_row;
+    int x0 = static_cast<int>(column) * CA_TILE_WIDTH;
+    int x1 = std::min(width, x0 + CA_TILE_WIDTH);
+    const int *in = tile_scratch_.data() + t * CA_TILE_WIDTH;
+    int first = -1, last = -1;
+    for (int x = x0; x < x1; x++) {
+      if (row[x] != in[x - x0]) {
+        row[x] = in[x - x0];
+        if (first < 0)
+          first = x;
+        last = x;
+      }
+    }
+    if (first < 0)
+      continue;
+
+    uint32_t row_start = tile - column;
+    queue(tile);
+    if (first == x0)
+      queue(row_start + (column == 0 ? tiles_per_row - 1 : column - 1));
+    if (last == x1 - 1)
+      queue(row_start + (column + 1 == tiles_per_row ? 0 : column + 1));
+  }
+
+  active_tiles_.swap(next);
+  state_.generation++;
+}
+
+void CellularAutomatonEngine::run_sparse(int generations) {
+  for (int g = 0; g < generations; g++) {
+    update_sparse();
+  }
+}
+
+void CellularAutomatonEngine::run_memoized(int generations) {
+  if (!initialized_ || generations <= 0)
+    return;
+  if (custom_rule_) {
+    run(generations);
+    return;
+  }
+
+  if (memo_rule_ != rule_number_)
+    reset_memo();
+
+  // Jumps of 2^j for every set bit; they commute
+  for (int j = 0; (generations >> j) != 0; j++) {
+    if (((generations >> j) & 1) == 0)
+      continue;
+    for (auto &row : state_.grid) {
+      if (memo_nodes_.size() > CA_MEMO_MAX_NODES)
+        reset_memo();
+      memo_jump_row(row, j);
+    }
+  }
+
+  state_.generation += generations;
+  tiles_valid_ = false;
+}
+
 int CellularAutomatonEngine::get_cell(int x, int y) const {
   if (!initialized_ || x < 0 || x >= state_.width || y < 0 ||
       y >= state_.height)
@@ -760,6 +884,141 @@ CellularAutomatonEngine::detect_patterns() const {
   return patterns;
 }
 
+void CellularAutomatonEngine::reset_memo() {
+  memo_nodes_.clear();
+  memo_index_.clear();
+  memo_nodes_.push_back({0, 0, 0, -1}); // Dead cell
+  memo_nodes_.push_back({1, 1, 0, -1}); // Live cell
+  memo_rule_ = rule_number_;
+}
+
+uint32_t CellularAutomatonEngine::memo_node(uint32_t left, uint32_t right) {
+  uint64_t key = (static_cast<uint64_t>(left) << 32) | right;
+  auto it = memo_index_.find(key);
+  if (it != memo_index_.end())
+    return it->second;
+
+  uint32_t id = static_cast<uint32_t>(memo_nodes_.size());
+  memo_nodes_.push_back({left, right, memo_nodes_[left].level + 1, -1});
+  memo_index_.emplace(key, id);
+  return id;
+}
+
+uint32_t CellularAutomatonEngine::memo_result(uint32_t node) {
+  if (memo_nodes_[node].result >= 0)
+    return static_cast<uint32_t>(memo_nodes_[node].result);
+
+  // Copies: memo_node() may grow memo_nodes_
+  const MemoNode n = memo_nodes_[node];
+  const uint32_t a = memo_nodes_[n.left].left;
+  const uint32_t b = memo_nodes_[n.left].right;
+  const uint32_t c = memo_nodes_[n.right].left;
+  const uint32_t d = memo_nodes_[n.right].right;
+
+  uint32_t result;
+  if (n.level == 2) {
+    // Four cells: the middle two after one generation
+    result = memo_node(apply_elementary_rule(a, b, c),
+                       apply_elementary_rule(b, c, d));
+  } else {
+    // Quarters A B C D of size q: three overlapping halves advanced q/2
+    // generations give cells [q/2, 7q/2); two more halves of those,
+    // advanced another q/2, give the centre [q, 3q) after q generations
+    uint32_t r0 = memo_result(n.left);
+    uint32_t r1 = memo_result(memo_node(b, c));
+    uint32_t r2 = memo_result(n.right);
+    result = memo_node(memo_result(memo_node(r0, r1)),
+                       memo_result(memo_node(r1, r2)));
+  }
+  memo_nodes_[node].result = result;
+  return result;
+}
+
+void CellularAutomatonEngine::memo_jump_row(std::vector<int> &row,
+                                            int log2_generations) {
+  // The ring, unrolled, is a periodic tape; a tape node is fixed by its
+  // level and its start modulo the width, so each is built once
+  const size_t width = row.size();
+  std::unordered_map<uint64_t, uint32_t> tape_nodes;
+  auto tape = [&](auto &self, size_t phase, int level) -> uint32_t {
+    if (level == 0)
+      return row[phase] != 0 ? 1u : 0u;
+    uint64_t key = static_cast<uint64_t>(phase) * 64 + level;
+    auto it = tape_nodes.find(key);
+    if (it != tape_nodes.end())
+      return it->second;
+    size_t half = (1ull << (level - 1)) % width;
+    uint32_t left = self(self, phase, level - 1);
+    uint32_t right = self(self, (phase + half) % width, level - 1);
+    uint32_t id = memo_node(left, right);
+    tape_nodes.emplace(key, id);
+    return id;
+  };
+
+  // Write the first `limit` cells of a node
+  std::vector<int> next(width);
+  auto flatten = [&](auto &self, uint32_t node, size_t offset,
+                     size_t limit) -> void {
+    const MemoNode &n = memo_nodes_[node];
+    if (n.level == 0) {
+      next[offset] = static_cast<int>(node);
+      return;
+    }
+    size_t half = size_t(1) << (n.level - 1);
+    self(self, n.left, offset, std::min(limit, half));
+    if (limit > half)
+      self(self, n.right, offset + half, limit - half);
+  };
+
+  // Level j+2 nodes starting 2^j before each block of 2^(j+1) cells yield
+  // that block after 2^j generations
+  const size_t steps = size_t(1) << log2_generations;
+  const size_t block = steps * 2;
+  const size_t back = width - steps % width;
+  for (size_t start = 0; start < width; start += block) {
+    uint32_t node =
+        tape(tape, (start + back) % width, log2_generations + 2);
+    flatten(flatten, memo_result(node), start,
+            std::min(block, width - start));
+  }
+  row.swap(next);
+}
+
+void CellularAutomatonEngine::load_padded(std::vector<uint8_t> &padded) const {
+  const size_t stride = static_cast<size_t>(state_.width) + 2;
+  padded.assign(stride * (state_.height + 2), 0);
+  for (int y = 0; y < state_.height; y++) {
+    uint8_t *out = padded.data() + (y + 1) * stride + 1;
+    for (int x = 0; x < state_.width; x++) {
+      out[x] = static_cast<uint8_t>(state_.grid[y][x]);
+    }
+  }
+}
+
+void CellularAutomatonEngine::store_padded(const std::vector<uint8_t> &padded) {
+  const size_t stride = static_cast<size_t>(state_.width) + 2;
+  for (int y = 0; y < state_.height; y++) {
+    const uint8_t *in = padded.data() + (y + 1) * stride + 1;
+    std::copy(in, in + state_.width, state_.grid[y].begin());
+  }
+}
+
+void CellularAutomatonEngine::wrap_padded(std::vector<uint8_t> &padded) const {
+  const int width = state_.width;
+  const int height = state_.height;
+  const size_t stride = static_cast<size_t>(width) + 2;
+  uint8_t *grid = padded.data();
+
+  // Left and right columns, then whole top and bottom rows (with corners)
+  for (int y = 1; y <= height; y++) {
+    uint8_t *row = grid + y * stride;
+    row[0] = row[width];
+    row[width + 1] = row[1];
+  }
+  std::copy(grid + height * stride, grid + (height + 1) * stride, grid);
+  std::copy(grid + stride, grid + 2 * stride, grid + (height + 1) * stride);
+}
+
 int CellularAutomatonEngine::apply_elementary_rule(int left, int center,
                                                    int right) const {
   int pattern = (left << 2) | (center << 1) | right;
@@ -790,36 +1049,84 @@ NeuronTimeCrystalMapper::NeuronTimeCrystalMapper(NanoBrainKernel *kernel,
                                                  TimeCrystalKernel *tc_kernel)
     : kernel_(kernel), tc_kernel_(tc_kernel) {}
 
-std::string NeuronTimeCrystalMapper::create_neuron(const std::string &name) {
-  std::string id = generate_neuron_id();
+namespace {
+
+const char *segment_kind_name(NeuronSegmentKind kind) {
+  switch (kind) {
+  case NeuronSegmentKind::Soma:
+    return "soma";
+  case NeuronSegmentKind::Axon:
+    return "axon";
+  case NeuronSegmentKind::Dendrite:
+    return "dendrite";
+  }
+  return "";
+}
+
+// "<prefix><index>" with index < count
+bool parse_indexed_id(const std::string &id, const std::string &prefix,
+                      size_t count, uint32_t &index) {
+  if (id.size() <= prefix.size() || id.compare(0, prefix.size(), prefix) != 0)
+    return false;
+  uint64_t value = 0;
+  for (size_t i = prefix.size(); i < id.size(); i++) {
+    if (id[i] < '0' || id[i] > '9' || value >= count)
+      return false;
+    value = value * 10 + static_cast<uint64_t>(id[i] - '0');
+  }
+  if (value >= count)
+    return false;
+  index = static_cast<uint32_t>(value);
+  return true;
+}
+
+// Multiset of fundamental primes as 4-bit counts; false if the encoding
+// has other primes or a prime repeated more than 15 times
+bool fundamental_prime_mask(const std::vector<int> &primes, uint64_t &mask) {
+  mask = 0;
+  for (int p : primes) {
+    int slot = -1;
+    for (int i = 0; i < FUNDAMENTAL_PRIMES_COUNT; i++) {
+      if (FUNDAMENTAL_PRIMES[i] == p) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot < 0 || ((mask >> (slot * 4)) & 0xF) == 0xF)
+      return false;
+    mask += uint64_t(1) << (slot * 4);
+  }
+  return true;
+}
 
-  NeuronTimeCrystalMap neuron;
-  neuron.neuron_id = id;
+void step_segment_range(NeuronMorphologyStore &store, size_t begin,
+                        size_t end) {
+  const float two_pi = 2.0f * static_cast<float>(PI);
+  float *phase = store.quantum_phase.data();
+  float *coherence = store.temporal_coherence.data();
+  const float *regenerated = store.regenerated_coherence.data();
 
-  // Create soma
-  neuron.soma.segment_id = generate_segment_id();
-  neuron.soma.segment_type = "soma";
-  neuron.soma.scale_level = 0;
-  neuron.soma.prime_encoding = generate_segment_primes("soma", 0);
-  neuron.soma.triplet_bands = {440.0f, 550.0f, 660.0f}; // C, E, G
+  // Branch-free so the loop vectorizes
+  for (size_t i = begin; i < end; i++) {
+    // Phase evolution
+    float p = phase[i] + 0.1f;
+    phase[i] = p >= two_pi ? p - two_pi : p;
 
-  // Generate time crystal state
-  neuron.soma.time_crystal_state.dimensions =
-      std::array<float, TIME_CRYSTAL_DIMENSIONS>{};
-  for (int i = 0; i < TIME_CRYSTAL_DIMENSIONS; i++) {
-    neuron.soma.time_crystal_state.dimensions[i] =
-        std::sin(i * PI / TIME_CRYSTAL_DIMENSIONS);
+    // Coherence decay and restoration
+    float c = coherence[i] * 0.999f;
+    coherence[i] = c < 0.3f ? regenerated[i] : c;
   }
-  neuron.soma.time_crystal_state.prime_signature = neuron.soma.prime_encoding;
-  neuron.soma.time_crystal_state.temporal_coherence = 0.9f;
-  neuron.soma.time_crystal_state.fractal_dimension = 2.5f;
-  neuron.soma.time_crystal_state.resonance_frequency =
-      tc_kernel_->calculate_resonance_frequency(neuron.soma.prime_encoding);
-  neuron.soma.time_crystal_state.quantum_phase = 0.0f;
+}
+
+} // namespace
 
-  all_segments_[neuron.soma.segment_id] = neuron.soma;
-  neurons_[id] = neuron;
+std::string NeuronTimeCrystalMapper::create_neuron(const std::string &name) {
+  uint32_t index = static_cast<uint32_t>(neurons_.size());
+  neurons_.emplace_back();
+  neurons_.back().name = name;
+  neurons_.back().soma = add_segment(index, NeuronSegmentKind::Soma, 0, -1);
 
+  std::string id = "neuron_" + std::to_string(index);
   std::cout << "[NeuronTimeCrystalMapper] Created neuron " << id << " (" << name
             << ")" << std::endl;
 
@@ -829,140 +1136,146 @@ std::string NeuronTimeCrystalMapper::create_neuron(const std::string &name) {
 std::string
 NeuronTimeCrystalMapper::add_axon_segment(const std::string &neuron_id,
                                           int scale_level) {
-  auto it = neurons_.find(neuron_id);
-  if (it == neurons_.end())
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
     return "";
 
-  NeuronSegment segment;
-  segment.segment_id = generate_segment_id();
-  segment.segment_type = "axon";
-  segment.scale_level = scale_level;
-  segment.prime_encoding = generate_segment_primes("axon", scale_level);
-
-  // Triplet bands based on scale level
-  float base_freq = 440.0f * std::pow(2.0f, scale_level / 3.0f);
-  segment.triplet_bands = {base_freq, base_freq * 1.25f, base_freq * 1.5f};
-
-  // Time crystal state
-  segment.time_crystal_state.dimensions =
-      std::array<float, TIME_CRYSTAL_DIMENSIONS>{};
-  for (int i = 0; i < TIME_CRYSTAL_DIMENSIONS; i++) {
-    segment.time_crystal_state.dimensions[i] =
-        std::sin((i + scale_level) * PI / TIME_CRYSTAL_DIMENSIONS);
-  }
-  segment.time_crystal_state.prime_signature = segment.prime_encoding;
-  segment.time_crystal_state.temporal_coherence = 0.85f - scale_level * 0.1f;
-  segment.time_crystal_state.fractal_dimension = 1.8f + scale_level * 0.2f;
-  segment.time_crystal_state.resonance_frequency =
-      tc_kernel_->calculate_resonance_frequency(segment.prime_encoding);
-  segment.time_crystal_state.quantum_phase = scale_level * 0.5f;
-
-  all_segments_[segment.segment_id] = segment;
-  it->second.axon_segments.push_back(segment);
-  it->second.scale_hierarchy[scale_level].push_back(segment.segment_id);
-
-  return segment.segment_id;
+  uint32_t segment =
+      add_segment(neuron, NeuronSegmentKind::Axon, scale_level,
+                  static_cast<int32_t>(neurons_[neuron].soma));
+  return "segment_" + std::to_string(segment);
 }
 
 std::string
 NeuronTimeCrystalMapper::add_dendrite_segment(const std::string &neuron_id,
                                               int scale_level) {
-  auto it = neurons_.find(neuron_id);
-  if (it == neurons_.end())
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
     return "";
 
-  NeuronSegment segment;
-  segment.segment_id = generate_segment_id();
-  segment.segment_type = "dendrite";
-  segment.scale_level = scale_level;
-  segment.prime_encoding = generate_segment_primes("dendrite", scale_level);
+  uint32_t segment =
+      add_segment(neuron, NeuronSegmentKind::Dendrite, scale_level,
+                  static_cast<int32_t>(neurons_[neuron].soma));
+  return "segment_" + std::to_string(segment);
+}
 
-  // Different triplet bands for dendrites
-  float base_freq = 220.0f * std::pow(2.0f, scale_level / 4.0f);
-  segment.triplet_bands = {base_freq, base_freq * 1.33f, base_freq * 1.67f};
+std::string NeuronTimeCrystalMapper::import_neuron(
+    const std::string &name, const std::vector<NeuronSegmentSpec> &morphology) {
+  auto ids = import_neurons({name}, morphology);
+  return ids.empty() ? "" : ids[0];
+}
 
-  // Time crystal state
-  segment.time_crystal_state.dimensions =
-      std::array<float, TIME_CRYSTAL_DIMENSIONS>{};
-  for (int i = 0; i < TIME_CRYSTAL_DIMENSIONS; i++) {
-    segment.time_crystal_state.dimensions[i] =
-        std::cos((i + scale_level * 2) * PI / TIME_CRYSTAL_DIMENSIONS);
+std::vector<std::string> NeuronTimeCrystalMapper::import_neurons(
+    const std::vector<std::string> &names,
+    const std::vector<NeuronSegmentSpec> &morphology) {
+  std::vector<std::string> ids;
+
+  // Validate once: a leading soma, parents before children
+  if (morphology.empty() || morphology[0].kind != NeuronSegmentKind::Soma ||
+      morphology[0].parent != -1) {
+    std::cerr << "[NeuronTimeCrystalMapper] Morphology must start with a soma"
+              << std::endl;
+    return ids;
+  }
+  for (size_t i = 1; i < morphology.size(); i++) {
+    const auto &spec = morphology[i];
+    if (spec.kind == NeuronSegmentKind::Soma || spec.parent < 0 ||
+        static_cast<size_t>(spec.parent) >= i) {
+      std::cerr << "[NeuronTimeCrystalMapper] Morphology segment " << i
+                << " must follow its parent" << std::endl;
+      return ids;
+    }
   }
-  segment.time_crystal_state.prime_signature = segment.prime_encoding;
-  segment.time_crystal_state.temporal_coherence = 0.8f - scale_level * 0.05f;
-  segment.time_crystal_state.fractal_dimension = 2.0f + scale_level * 0.15f;
-  segment.time_crystal_state.resonance_frequency =
-      tc_kernel_->calculate_resonance_frequency(segment.prime_encoding);
-  segment.time_crystal_state.quantum_phase = scale_level * 0.3f;
 
-  all_segments_[segment.segment_id] = segment;
-  it->second.dendrite_segments.push_back(segment);
-  it->second.scale_hierarchy[scale_level].push_back(segment.segment_id);
+  size_t total = store_.size() + names.size() * morphology.size();
+  store_.neuron.reserve(total);
+  store_.parent.reserve(total);
+  store_.kind.reserve(total);
+  store_.scale_level.reserve(total);
+  store_.quantum_phase.reserve(total);
+  store_.temporal_coherence.reserve(total);
+  store_.fractal_dimension.reserve(total);
+  store_.resonance_frequency.reserve(total);
+  store_.triplet_bands.reserve(total);
+  store_.regenerated_coherence.reserve(total);
+  neurons_.reserve(neurons_.size() + names.size());
+  ids.reserve(names.size());
+
+  for (const auto &name : names) {
+    uint32_t neuron = static_cast<uint32_t>(neurons_.size());
+    neurons_.emplace_back();
+    neurons_.back().name = name;
+
+    // Morphology indices map to a contiguous run of segments
+    uint32_t base = static_cast<uint32_t>(store_.size());
+    for (const auto &spec : morphology) {
+      int32_t parent = spec.parent < 0 ? -1 : static_cast<int32_t>(base) +
+                                                  spec.parent;
+      add_segment(neuron, spec.kind, spec.scale_level, parent);
+    }
+    ids.push_back("neuron_" + std::to_string(neuron));
+  }
 
-  return segment.segment_id;
+  std::cout << "[NeuronTimeCrystalMapper] Imported " << names.size()
+            << " neurons of " << morphology.size() << " segments" << std::endl;
+  return ids;
 }
 
 void NeuronTimeCrystalMapper::map_axon_triplet_bands(
     const std::string &neuron_id) {
-  auto it = neurons_.find(neuron_id);
-  if (it == neurons_.end())
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
     return;
 
   // Create triplet band mapping based on segment positions
-  int segment_idx = 0;
-  for (auto &segment : it->second.axon_segments) {
+  const auto &axons = neurons_[neuron].axons;
+  for (size_t segment_idx = 0; segment_idx < axons.size(); segment_idx++) {
     // Three bands: proximal, middle, distal
     float position_factor =
-        static_cast<float>(segment_idx) / (it->second.axon_segments.size() + 1);
+        static_cast<float>(segment_idx) / (axons.size() + 1);
 
-    segment.triplet_bands[0] = 440.0f * (1.0f + position_factor * 0.5f);
-    segment.triplet_bands[1] = 550.0f * (1.0f + position_factor * 0.4f);
-    segment.triplet_bands[2] = 660.0f * (1.0f + position_factor * 0.3f);
-
-    // Update in all_segments_
-    all_segments_[segment.segment_id] = segment;
-    segment_idx++;
+    auto &bands = store_.triplet_bands[axons[segment_idx]];
+    bands[0] = 440.0f * (1.0f + position_factor * 0.5f);
+    bands[1] = 550.0f * (1.0f + position_factor * 0.4f);
+    bands[2] = 660.0f * (1.0f + position_factor * 0.3f);
   }
 }
 
 void NeuronTimeCrystalMapper::add_scale_free_transitions(
     const std::string &neuron_id) {
-  auto it = neurons_.find(neuron_id);
-  if (it == neurons_.end())
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
     return;
 
-  // Create scale-free transitions between hierarchy levels
-  for (int level = 0; level < AXON_SCALE_LEVELS - 1; level++) {
-    auto &current_level = it->second.scale_hierarchy[level];
-    auto &next_level = it->second.scale_hierarchy[level + 1];
-
-    // Each segment connects to 2-3 segments at next level
-    for (const auto &seg_id : current_level) {
-      auto seg_it = all_segments_.find(seg_id);
-      if (seg_it == all_segments_.end())
-        continue;
-
-      // Update temporal coherence for scale-free behavior
-      seg_it->second.time_crystal_state.temporal_coherence *=
-          std::pow(0.9f, level);
+  // Create scale-free transitions between hierarchy levels: update temporal
+  // coherence of every axon and dendrite below the coarsest level
+  auto apply = [this](uint32_t segment) {
+    int level = store_.scale_level[segment];
+    if (level >= 0 && level < AXON_SCALE_LEVELS - 1) {
+      store_.temporal_coherence[segment] *= std::pow(0.9f, level);
     }
-  }
+  };
+  const auto &record = neurons_[neuron];
+  for (uint32_t segment : record.axons)
+    apply(segment);
+  for (uint32_t segment : record.dendrites)
+    apply(segment);
 }
 
 std::array<float, TRIPLET_INNER_BANDS>
 NeuronTimeCrystalMapper::get_segment_bands(
     const std::string &segment_id) const {
-  auto it = all_segments_.find(segment_id);
-  if (it != all_segments_.end()) {
-    return it->second.triplet_bands;
+  uint32_t segment;
+  if (find_segment(segment_id, segment)) {
+    return store_.triplet_bands[segment];
   }
   return {0.0f, 0.0f, 0.0f};
 }
 
 void NeuronTimeCrystalMapper::create_neuron_crystal_hierarchy(
     const std::string &neuron_id) {
-  auto it = neurons_.find(neuron_id);
-  if (it == neurons_.end())
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
     return;
 
   // Add segments at each scale level
@@ -986,74 +1299,199 @@ void NeuronTimeCrystalMapper::create_neuron_crystal_hierarchy(
 }
 
 void NeuronTimeCrystalMapper::update_crystal_states() {
-  for (auto &[seg_id, segment] : all_segments_) {
-    // Phase evolution
-    segment.time_crystal_state.quantum_phase += 0.1f;
-    if (segment.time_crystal_state.quantum_phase >= 2.0f * PI) {
-      segment.time_crystal_state.quantum_phase -= 2.0f * PI;
-    }
+  const size_t n = store_.size();
 
-    // Coherence decay and restoration
-    segment.time_crystal_state.temporal_coherence *= 0.999f;
-    if (segment.time_crystal_state.temporal_coherence < 0.3f) {
-      segment.time_crystal_state.temporal_coherence =
-          tc_kernel_->compute_ppm_coherence(segment.prime_encoding);
-    }
+  // Segments are independent, so chunks step in parallel on the pool
+  if (!thread_pool_ || n <= update_grain_) {
+    step_segment_range(store_, 0, n);
+    return;
   }
+  thread_pool_->parallel_for(0, n, update_grain_,
+                             [this](size_t begin, size_t end) {
+                               step_segment_range(store_, begin, end);
+                             });
 }
 
-const TimeCrystalQuantumState *NeuronTimeCrystalMapper::get_segment_crystal(
-    const std::string &segment_id) const {
-  auto it = all_segments_.find(segment_id);
-  if (it != all_segments_.end()) {
-    return &it->second.time_crystal_state;
-  }
-  return nullptr;
+bool NeuronTimeCrystalMapper::get_segment_crystal(
+    const std::string &segment_id, TimeCrystalQuantumState &out) const {
+  NeuronSegment segment;
+  if (!get_segment(segment_id, segment))
+    return false;
+  out = segment.time_crystal_state;
+  return true;
 }
 
-const NeuronTimeCrystalMap *
-NeuronTimeCrystalMapper::get_neuron(const std::string &neuron_id) const {
-  auto it = neurons_.find(neuron_id);
-  if (it != neurons_.end()) {
-    return &it->second;
+bool NeuronTimeCrystalMapper::get_neuron(const std::string &neuron_id,
+                                         NeuronTimeCrystalMap &view) const {
+  uint32_t neuron;
+  if (!find_neuron(neuron_id, neuron))
+    return false;
+
+  const NeuronRecord &record = neurons_[neuron];
+  view.neuron_id = neuron_id;
+  view.scale_hierarchy.clear();
+
+  fill_segment_view(record.soma, view.soma);
+
+  view.axon_segments.resize(record.axons.size());
+  for (size_t i = 0; i < record.axons.size(); i++) {
+    fill_segment_view(record.axons[i], view.axon_segments[i]);
+    view.scale_hierarchy[view.axon_segments[i].scale_level].push_back(
+        view.axon_segments[i].segment_id);
   }
-  return nullptr;
+  view.dendrite_segments.resize(record.dendrites.size());
+  for (size_t i = 0; i < record.dendrites.size(); i++) {
+    fill_segment_view(record.dendrites[i], view.dendrite_segments[i]);
+    view.scale_hierarchy[view.dendrite_segments[i].scale_level].push_back(
+        view.dendrite_segments[i].segment_id);
+  }
+  return true;
 }
 
 std::vector<std::string> NeuronTimeCrystalMapper::get_all_neuron_ids() const {
   std::vector<std::string> ids;
-  for (const auto &[id, _] : neurons_) {
-    ids.push_back(id);
+  ids.reserve(neurons_.size());
+  for (size_t i = 0; i < neurons_.size(); i++) {
+    ids.push_back("neuron_" + std::to_string(i));
   }
   return ids;
 }
 
-const NeuronSegment *
-NeuronTimeCrystalMapper::get_segment(const std::string &segment_id) const {
-  auto it = all_segments_.find(segment_id);
-  if (it != all_segments_.end()) {
-    return &it->second;
+bool NeuronTimeCrystalMapper::get_segment(const std::string &segment_id,
+                                          NeuronSegment &out) const {
+  uint32_t segment;
+  if (!find_segment(segment_id, segment))
+    return false;
+
+  fill_segment_view(segment, out);
+  return true;
+}
+
+uint32_t NeuronTimeCrystalMapper::add_segment(uint32_t neuron,
+                                              NeuronSegmentKind kind,
+                                              int scale_level,
+                                              int32_t parent) {
+  uint32_t index = static_cast<uint32_t>(store_.size());
+  PrimeSetValues values =
+      get_prime_set_values(generate_segment_primes(kind, scale_level));
+
+  float coherence, fractal, phase;
+  std::array<float, TRIPLET_INNER_BANDS> bands;
+  switch (kind) {
+  case NeuronSegmentKind::Soma:
+    bands = {440.0f, 550.0f, 660.0f}; // C, E, G
+    coherence = 0.9f;
+    fractal = 2.5f;
+    phase = 0.0f;
+    break;
+  case NeuronSegmentKind::Axon: {
+    // Triplet bands based on scale level
+    float base_freq = 440.0f * std::pow(2.0f, scale_level / 3.0f);
+    bands = {base_freq, base_freq * 1.25f, base_freq * 1.5f};
+    coherence = 0.85f - scale_level * 0.1f;
+    fractal = 1.8f + scale_level * 0.2f;
+    phase = scale_level * 0.5f;
+    neurons_[neuron].axons.push_back(index);
+    break;
   }
-  return nullptr;
+  case NeuronSegmentKind::Dendrite:
+  default: {
+    // Different triplet bands for dendrites
+    float base_freq = 220.0f * std::pow(2.0f, scale_level / 4.0f);
+    bands = {base_freq, base_freq * 1.33f, base_freq * 1.67f};
+    coherence = 0.8f - scale_level * 0.05f;
+    fractal = 2.0f + scale_level * 0.15f;
+    phase = scale_level * 0.3f;
+    neurons_[neuron].dendrites.push_back(index);
+    break;
+  }
+  }
+
+  store_.neuron.push_back(neuron);
+  store_.parent.push_back(parent);
+  store_.kind.push_back(kind);
+  store_.scale_level.push_back(scale_level);
+  store_.quantum_phase.push_back(phase);
+  store_.temporal_coherence.push_back(coherence);
+  store_.fractal_dimension.push_back(fractal);
+  store_.resonance_frequency.push_back(values.resonance);
+  store_.triplet_bands.push_back(bands);
+  store_.regenerated_coherence.push_back(values.coherence);
+  return index;
+}
+
+NeuronTimeCrystalMapper::PrimeSetValues
+NeuronTimeCrystalMapper::get_prime_set_values(const std::vector<int> &primes) {
+  uint64_t mask;
+  bool cacheable = fundamental_prime_mask(primes, mask);
+  if (cacheable) {
+    auto it = prime_cache_.find(mask);
+    if (it != prime_cache_.end())
+      return it->second;
+  }
+
+  PrimeSetValues values{tc_kernel_->compute_ppm_coherence(primes),
+                        tc_kernel_->calculate_resonance_frequency(primes)};
+  if (cacheable)
+    prime_cache_.emplace(mask, values);
+  return values;
+}
+
+void NeuronTimeCrystalMapper::fill_segment_view(
+    uint32_t index, NeuronSegment &segment) const {
+  NeuronSegmentKind kind = store_.kind[index];
+  int scale_level = store_.scale_level[index];
+
+  segment.segment_id = "segment_" + std::to_string(index);
+  segment.segment_type = segment_kind_name(kind);
+  segment.scale_level = scale_level;
+  segment.prime_encoding = generate_segment_primes(kind, scale_level);
+  segment.triplet_bands = store_.triplet_bands[index];
+
+  // Time crystal state: dimensions follow from kind and scale
+  auto &state = segment.time_crystal_state;
+  for (int i = 0; i < TIME_CRYSTAL_DIMENSIONS; i++) {
+    switch (kind) {
+    case NeuronSegmentKind::Soma:
+      state.dimensions[i] = std::sin(i * PI / TIME_CRYSTAL_DIMENSIONS);
+      break;
+    case NeuronSegmentKind::Axon:
+      state.dimensions[i] =
+          std::sin((i + scale_level) * PI / TIME_CRYSTAL_DIMENSIONS);
+      break;
+    case NeuronSegmentKind::Dendrite:
+      state.dimensions[i] =
+          std::cos((i + scale_level * 2) * PI / TIME_CRYSTAL_DIMENSIONS);
+      break;
+    }
+  }
+  state.prime_signature = segment.prime_encoding;
+  state.temporal_coherence = store_.temporal_coherence[index];
+  state.fractal_dimension = store_.fractal_dimension[index];
+  state.resonance_frequency = store_.resonance_frequency[index];
+  state.quantum_phase = store_.quantum_phase[index];
 }
 
-std::string NeuronTimeCrystalMapper::generate_neuron_id() {
-  return "neuron_" + std::to_string(neuron_counter_++);
+bool NeuronTimeCrystalMapper::find_neuron(const std::string &neuron_id,
+                                          uint32_t &index) const {
+  return parse_indexed_id(neuron_id, "neuron_", neurons_.size(), index);
 }
 
-std::string NeuronTimeCrystalMapper::generate_segment_id() {
-  return "segment_" + std::to_string(segment_counter_++);
+bool NeuronTimeCrystalMapper::find_segment(const std::string &segment_id,
+                                           uint32_t &index) const {
+  return parse_indexed_id(segment_id, "segment_", store_.size(), index);
 }
 
-std::vector<int> NeuronTimeCrystalMapper::generate_segment_primes(
-    const std::string &segment_type, int scale_level) {
+std::vector<int>
+NeuronTimeCrystalMapper::generate_segment_primes(NeuronSegmentKind kind,
+                                                 int scale_level) const {
   std::vector<int> primes;
 
-  if (segment_type == "soma") {
+  if (kind == NeuronSegmentKind::Soma) {
     primes = {2, 3, 5, 7}; // Core primes
-  } else if (segment_type == "axon") {
+  } else if (kind == NeuronSegmentKind::Axon) {
     primes = {11, 13, 17}; // Transmission primes
-  } else if (segment_type == "dendrite") {
+  } else if (kind == NeuronSegmentKind::Dendrite) {
     primes = {19, 23, 29}; // Reception primes
   }
 
@@ -1073,12 +1511,15 @@ FilamentCommunicator::FilamentCommunicator(
     NanoBrainKernel *kernel, AttentionAllocationEngine *attention_engine)
     : kernel_(kernel), attention_engine_(attention_engine) {}
 
-void FilamentCommunicator::initialize(size_t history_size) {
+void FilamentCommunicator::initialize(size_t history_size,
+                                      size_t source_history_size) {
   max_history_size_ = history_size;
-  signal_history_.clear();
+  source_history_size_ = std::max<size_t>(2, source_history_size);
+  clear_history();
   initialized_ = true;
   std::cout << "[FilamentCommunicator] Initialized with history size "
-            << history_size << std::endl;
+            << history_size << " (" << source_history_size_
+            << " per source)" << std::endl;
 }
 
 bool FilamentCommunicator::detect_pre_spike_signal(
@@ -1103,17 +1544,62 @@ bool FilamentCommunicator::detect_pre_spike_signal(
     signal.is_pre_spike = true;
     signal.predicted_timing = predict_spike_timing(source_id);
 
-    signal_history_.push_back(signal);
-
-    // Limit history size
-    while (signal_history_.size() > max_history_size_) {
-      signal_history_.erase(signal_history_.begin());
-    }
+    record_signal(signal);
   }
 
   return is_pre_spike;
 }
 
+void FilamentCommunicator::record_signal(const FilamentSignal &signal) {
+  // Global history, with running strength sums
+  signal_history_.push_back(signal);
+  strength_sum_ += signal.signal_strength;
+  strength_sq_sum_ +=
+      static_cast<double>(signal.signal_strength) * signal.signal_strength;
+  while (signal_history_.size() > max_history_size_) {
+    float evicted = signal_history_.front().signal_strength;
+    strength_sum_ -= evicted;
+    strength_sq_sum_ -= static_cast<double>(evicted) * evicted;
+    signal_history_.pop_front();
+  }
+
+  int32_t target =
+      signal.target_id.empty() ? -1 : intern_source(signal.target_id);
+  SourceTimeline &timeline = timelines_[intern_source(signal.source_id)];
+
+  // Interval statistics (incremental EWMA mean and variance)
+  FilamentSourceStats &stats = timeline.stats;
+  if (stats.signal_count > 0) {
+    float interval =
+        static_cast<float>(signal.timestamp - stats.last_timestamp);
+    if (stats.signal_count == 1) {
+      stats.interval_mean = interval;
+      stats.interval_variance = 0.0f;
+    } else {
+      float diff = interval - stats.interval_mean;
+      float increment = interval_smoothing_ * diff;
+      stats.interval_mean += increment;
+      stats.interval_variance = (1.0f - interval_smoothing_) *
+                                (stats.interval_variance + diff * increment);
+    }
+  }
+  stats.signal_count++;
+  stats.last_timestamp = signal.timestamp;
+  stats.last_strength = signal.signal_strength;
+
+  // Recent samples ring
+  SourceSample sample{signal.timestamp, signal.signal_strength,
+                      signal.predicted_timing, target, signal.is_pre_spike};
+  if (timeline.ring.size() < source_history_size_) {
+    if (timeline.ring.empty())
+      timeline.ring.reserve(source_history_size_);
+    timeline.ring.push_back(sample);
+  } else {
+    timeline.ring[timeline.head] = sample;
+    timeline.head = (timeline.head + 1) % timeline.ring.size();
+  }
+}
+
 const FilamentSignal *FilamentCommunicator::get_last_signal() const {
   if (signal_history_.empty())
     return nullptr;
@@ -1123,63 +1609,77 @@ const FilamentSignal *FilamentCommunicator::get_last_signal() const {
 std::vector<FilamentSignal> FilamentCommunicator::get_signals_for_source(
     const std::string &source_id) const {
   std::vector<FilamentSignal> signals;
-  for (const auto &signal : signal_history_) {
-    if (signal.source_id == source_id) {
-      signals.push_back(signal);
-    }
+  const SourceTimeline *timeline = find_timeline(source_id);
+  if (!timeline)
+    return signals;
+
+  size_t n = timeline->ring.size();
+  signals.reserve(n);
+  for (size_t i = 0; i < n; i++) {
+    const SourceSample &sample = timeline->ring[(timeline->head + i) % n];
+    FilamentSignal signal;
+    signal.source_id = source_id;
+    if (sample.target >= 0)
+      signal.target_id = source_names_[sample.target];
+    signal.timestamp = sample.timestamp;
+    signal.signal_strength = sample.signal_strength;
+    signal.prime_encoding = generate_signal_primes(sample.signal_strength);
+    signal.is_pre_spike = sample.is_pre_spike;
+    signal.predicted_timing = sample.predicted_timing;
+    signals.push_back(std::move(signal));
   }
   return signals;
 }
 
-float FilamentCommunicator::predict_spike_timing(const std::string &source_id) {
-  // Get recent signals for this source
-  auto signals = get_signals_for_source(source_id);
-
-  if (signals.size() < 2) {
-    return 10.0f; // Default: 10ms
+std::vector<float> FilamentCommunicator::get_recent_intervals(
+    const std::string &source_id) const {
+  std::vector<float> intervals;
+  const SourceTimeline *timeline = find_timeline(source_id);
+  if (!timeline || timeline->ring.size() < 2)
+    return intervals;
+
+  size_t n = timeline->ring.size();
+  intervals.reserve(n - 1);
+  for (size_t i = 1; i < n; i++) {
+    intervals.push_back(static_cast<float>(
+        timeline->ring[(timeline->head + i) % n].timestamp -
+        timeline->ring[(timeline->head + i - 1) % n].timestamp));
   }
+  return intervals;
+}
+
+FilamentSourceStats
+FilamentCommunicator::get_source_stats(const std::string &source_id) const {
+  const SourceTimeline *timeline = find_timeline(source_id);
+  return timeline ? timeline->stats : FilamentSourceStats{};
+}
 
-  // Calculate average interval between signals
-  float avg_interval = 0.0f;
-  for (size_t i = 1; i < signals.size(); i++) {
-    avg_interval += signals[i].timestamp - signals[i - 1].timestamp;
+float FilamentCommunicator::predict_spike_timing(const std::string &source_id) {
+  const SourceTimeline *timeline = find_timeline(source_id);
+  if (!timeline || timeline->stats.signal_count < 2) {
+    return 10.0f; // Default: 10ms
   }
-  avg_interval /= (signals.size() - 1);
 
-  // Predict next spike based on current signal strength
-  const auto *last = get_last_signal();
-  if (last && last->signal_strength > 0) {
+  // Predict next spike based on the source's latest signal strength
+  const FilamentSourceStats &stats = timeline->stats;
+  if (stats.last_strength > 0) {
     // Stronger signal = faster spike
-    return avg_interval / last->signal_strength;
+    return stats.interval_mean / stats.last_strength;
   }
 
-  return avg_interval;
+  return stats.interval_mean;
 }
 
 float FilamentCommunicator::get_prediction_confidence(
     const std::string &source_id) const {
-  auto signals = get_signals_for_source(source_id);
-
-  if (signals.size() < 3)
+  const SourceTimeline *timeline = find_timeline(source_id);
+  if (!timeline || timeline->stats.signal_count < 3)
     return 0.3f; // Low confidence with few samples
 
-  // Calculate variance in inter-signal intervals
-  std::vector<float> intervals;
-  for (size_t i = 1; i < signals.size(); i++) {
-    intervals.push_back(
-        static_cast<float>(signals[i].timestamp - signals[i - 1].timestamp));
-  }
-
-  float mean = std::accumulate(intervals.begin(), intervals.end(), 0.0f) /
-               intervals.size();
-  float variance = 0.0f;
-  for (float interval : intervals) {
-    variance += (interval - mean) * (interval - mean);
-  }
-  variance /= intervals.size();
-
   // Lower variance = higher confidence
-  float cv = std::sqrt(variance) / (mean + 1.0f); // Coefficient of variation
+  const FilamentSourceStats &stats = timeline->stats;
+  float cv = std::sqrt(stats.interval_variance) /
+             (stats.interval_mean + 1.0f); // Coefficient of variation
   return std::max(0.1f, 1.0f - cv);
 }
 
@@ -1196,7 +1696,7 @@ FilamentCommunicator::encode_hidden_signal(const std::string &source_id,
   signal.is_pre_spike = signal_strength > pre_spike_threshold_;
   signal.predicted_timing = predict_spike_timing(source_id);
 
-  signal_history_.push_back(signal);
+  record_signal(signal);
 
   return signal;
 }
@@ -1222,30 +1722,26 @@ float FilamentCommunicator::decode_hidden_signal(const FilamentSignal &signal) {
 float FilamentCommunicator::get_mean_signal_strength() const {
   if (signal_history_.empty())
     return 0.0f;
-
-  float sum = 0.0f;
-  for (const auto &signal : signal_history_) {
-    sum += signal.signal_strength;
-  }
-  return sum / signal_history_.size();
+  return static_cast<float>(strength_sum_ / signal_history_.size());
 }
 
 float FilamentCommunicator::get_signal_variance() const {
   if (signal_history_.size() < 2)
     return 0.0f;
 
-  float mean = get_mean_signal_strength();
-  float variance = 0.0f;
-
-  for (const auto &signal : signal_history_) {
-    float diff = signal.signal_strength - mean;
-    variance += diff * diff;
-  }
-
-  return variance / signal_history_.size();
+  double mean = strength_sum_ / signal_history_.size();
+  double variance = strength_sq_sum_ / signal_history_.size() - mean * mean;
+  return static_cast<float>(std::max(0.0, variance));
 }
 
-void FilamentCommunicator::clear_history() { signal_history_.clear(); }
+void FilamentCommunicator::clear_history() {
+  signal_history_.clear();
+  strength_sum_ = 0.0;
+  strength_sq_sum_ = 0.0;
+  source_ids_.clear();
+  source_names_.clear();
+  timelines_.clear();
+}
 
 float FilamentCommunicator::calculate_attention_derivative(
     const std::string &source_id, const std::vector<NodeTensor *> &nodes) {
@@ -1264,7 +1760,8 @@ float FilamentCommunicator::calculate_attention_derivative(
   return 0.0f;
 }
 
-std::vector<int> FilamentCommunicator::generate_signal_primes(float strength) {
+std::vector<int>
+FilamentCommunicator::generate_signal_primes(float strength) const {
   std::vector<int> primes;
 
   // Select primes based on strength level
@@ -1281,6 +1778,24 @@ std::vector<int> FilamentCommunicator::generate_signal_primes(float strength) {
   return primes;
 }
 
+int32_t FilamentCommunicator::intern_source(const std::string &id) {
+  auto it = source_ids_.find(id);
+  if (it != source_ids_.end())
+    return it->second;
+
+  int32_t index = static_cast<int32_t>(timelines_.size());
+  source_ids_.emplace(id, index);
+  source_names_.push_back(id);
+  timelines_.emplace_back();
+  return index;
+}
+
+const FilamentCommunicator::SourceTimeline *
+FilamentCommunicator::find_timeline(const std::string &source_id) const {
+  auto it = source_ids_.find(source_id);
+  return it == source_ids_.end() ? nullptr : &timelines_[it->second];
+}
+
 int64_t FilamentCommunicator::current_time_millis() const {
   return std::chrono::duration_cast<std::chrono::milliseconds>(
              std::chrono::system_clock::now().time_since_epoch())
@@ -19,10 +19,13 @@
 #include "nanobrain_kernel.h"
 #include "nanobrain_time_crystal.h"
 #include <array>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // ================================================================
@@ -42,6 +45,9 @@ constexpr int TRIPLET_NESTING_DEPTH = 3;
 // Cellular automaton constants
 constexpr int CA_DEFAULT_WIDTH = 256;
 constexpr int CA_DEFAULT_HEIGHT = 256;
+constexpr int CA_TILE_WIDTH = 64;              // Cells per sparse-update tile
+constexpr size_t CA_MEMO_MAX_NODES = 1u << 22; // Memo table cap (HashLife)
+constexpr size_t CA_MIN_PARALLEL_CELLS = 8192; // Min cells per pool chunk
 
 // Neuron time crystal constants
 constexpr int AXON_SCALE_LEVELS = 5; // Multi-scale band levels
@@ -122,6 +128,45 @@ struct NeuronSegment {
   int scale_level; // 0 = finest, AXON_SCALE_LEVELS-1 = coarsest
 };
 
+/**
+ * Neuron segment kinds (NeuronSegment::segment_type as an enum)
+ */
+enum class NeuronSegmentKind : uint8_t { Soma, Axon, Dendrite };
+
+/**
+ * One segment of a morphology to import. Segments are listed parents
+ * first, as in SWC files; the first one is the soma.
+ */
+struct NeuronSegmentSpec {
+  NeuronSegmentKind kind;
+  int scale_level;
+  int32_t parent; // Index within the morphology, -1 for the soma
+};
+
+/**
+ * Flattened morphology of every mapped neuron: one dense index per segment
+ * (the N of "segment_N"), parent offsets and SoA crystal state
+ */
+struct NeuronMorphologyStore {
+  // Topology
+  std::vector<uint32_t> neuron; // Owning neuron index
+  std::vector<int32_t> parent;  // Parent segment index, -1 for a soma
+  std::vector<NeuronSegmentKind> kind;
+  std::vector<int32_t> scale_level;
+
+  // Crystal state
+  std::vector<float> quantum_phase;
+  std::vector<float> temporal_coherence;
+  std::vector<float> fractal_dimension;
+  std::vector<float> resonance_frequency;
+  std::vector<std::array<float, TRIPLET_INNER_BANDS>> triplet_bands;
+
+  // PPM coherence of the segment's primes, restored on decoherence
+  std::vector<float> regenerated_coherence;
+
+  size_t size() const { return neuron.size(); }
+};
+
 /**
  * Neuron time crystal map - complete neuron structure
  */
@@ -148,6 +193,18 @@ struct FilamentSignal {
   float predicted_timing; // Predicted milliseconds to spike
 };
 
+/**
+ * Inter-signal statistics of one filament source, updated as each signal
+ * is recorded
+ */
+struct FilamentSourceStats {
+  size_t signal_count = 0; // Signals recorded since the last clear
+  int64_t last_timestamp = 0;
+  float last_strength = 0.0f;
+  float interval_mean = 0.0f;     // EWMA of inter-signal intervals (ms)
+  float interval_variance = 0.0f; // EWMA variance of the intervals
+};
+
 // ================================================================
 // TubulinPPMModel Class
 // ================================================================
@@ -223,6 +280,8 @@ private:
   std::vector<TubulinRing> rings_;
   WaterChannel water_channel_;
   bool initialized_ = false;
+  uint64_t seed_;                 // Counter RNG seed, from the kernel config
+  uint64_t channels_encoded_ = 0; // Counter RNG step
 
   // Internal helpers
   std::vector<int> generate_ring_primes(int ring_id, bool is_alpha);
@@ -305,6 +364,63 @@ private:
   float calculate_energy_recursive(const TripletResonance *node) const;
 };
 
+// ================================================================
+// Cellular Automaton Stencil Rules
+// ================================================================
+
+/**
+ * Moore neighbourhood (3x3) handed to compile-time rules; cells are read
+ * from a padded flat grid, row above, own row, row below
+ */
+struct MooreNeighborhood {
+  int nw, n, ne;
+  int w, c, e;
+  int sw, s, se;
+
+  static MooreNeighborhood gather(const uint8_t *above, const uint8_t *row,
+                                  const uint8_t *below, int x) {
+    return {above[x - 1], above[x], above[x + 1], //
+            row[x - 1],   row[x],   row[x + 1],   //
+            below[x - 1], below[x], below[x + 1]};
+  }
+
+  // Neighbours, centre excluded
+  int sum() const { return nw + n + ne + w + e + sw + s + se; }
+};
+
+/**
+ * Von Neumann neighbourhood (centre and its four edge neighbours)
+ */
+struct VonNeumannNeighborhood {
+  int n;
+  int w, c, e;
+  int s;
+
+  static VonNeumannNeighborhood gather(const uint8_t *above,
+                                       const uint8_t *row,
+                                       const uint8_t *below, int x) {
+    return {above[x], row[x - 1], row[x], row[x + 1], below[x]};
+  }
+
+  // Neighbours, centre excluded
+  int sum() const { return n + w + e + s; }
+};
+
+/**
+ * Life-like rule: a dead cell is born with a neighbour count in Birth, a
+ * live one survives with a count in Survive (bit masks over 0-8)
+ */
+template <uint32_t Birth, uint32_t Survive> struct LifeLikeRule {
+  using Neighborhood = MooreNeighborhood;
+
+  int operator()(const MooreNeighborhood &cell) const {
+    return static_cast<int>(((cell.c ? Survive : Birth) >> cell.sum()) & 1u);
+  }
+};
+
+// Conway's Game of Life, B3/S23
+using ConwayLifeRule = LifeLikeRule<1u << 3, (1u << 2) | (1u << 3)>;
+
 // ================================================================
 // CellularAutomatonEngine Class
 // ================================================================
@@ -329,8 +445,9 @@ public:
   // Set initial state
   void set_initial_state(const std::vector<std::vector<int>> &state);
 
-  // Random initialization
-  void randomize(float density = 0.5f);
+  // Random initialization; repeated calls draw fresh, reproducible grids
+  void randomize(float density = 0.5f,
+                 uint64_t seed = NANOBRAIN_DEFAULT_SEED);
 
   // ================================================================
   // Rule System
@@ -347,6 +464,11 @@ public:
   // Apply PPM-derived rules
   void apply_ppm_rules(const std::vector<int> &primes);
 
+  // Update rows of update_parallel() and run_with_rule() on a shared pool
+  // (nullptr = serial). Custom rules are then called from pool workers.
+  // The pool must outlive the engine.
+  void set_thread_pool(NanoBrainThreadPool *pool) { thread_pool_ = pool; }
+
   // Explore rule space
   std::vector<int> explore_rule_space(int num_generations);
 
@@ -354,12 +476,34 @@ public:
   // Evolution
   // ================================================================
 
-  // Single generation update (parallel)
+  // Single generation update; rows split across the thread pool if set
   void update_parallel();
 
   // Run multiple generations
   void run(int generations);
 
+  // Single generation recomputing only the row tiles next to the previous
+  // generation's changes; same result as update_parallel(). Custom rules
+  // may read any cell, so they update the full grid.
+  void update_sparse();
+  void run_sparse(int generations);
+
+  // Elementary rules with HashLife-style memoization: every row is a ring
+  // advanced in power-of-two jumps over hash-consed binary trees, so
+  // sparse or periodic rows cost far less than stepping each generation.
+  // Same result as run(); custom rules fall back to run().
+  void run_memoized(int generations);
+
+  // Run generations of a compile-time rule: a functor with a Neighborhood
+  // type (MooreNeighborhood, VonNeumannNeighborhood or one with the same
+  // gather()) and int operator()(const Neighborhood &) returning the new
+  // cell (0-255). The grid wraps like update_parallel(). The rule is
+  // inlined into a flat stencil loop, so simple rules vectorize.
+  template <typename Rule> void run_with_rule(int generations, Rule rule = {});
+
+  size_t get_active_tile_count() const { return active_tiles_.size(); }
+  size_t get_memo_node_count() const { return memo_nodes_.size(); }
+
   // Get current state
   const CellularAutomatonState &get_state() const { return state_; }
 
@@ -385,6 +529,40 @@ private:
   RuleFunction custom_rule_;
   int rule_number_ = 110; // Default Rule 110
   bool initialized_ = false;
+  uint64_t randomize_calls_ = 0; // Counter RNG step
+  NanoBrainThreadPool *thread_pool_ = nullptr;
+
+  // Sparse updates: tiles queued for the next generation. Invalid after
+  // any change not made by update_sparse() (every tile is then queued).
+  std::vector<uint32_t> active_tiles_;
+  std::vector<uint32_t> tile_stamp_; // Pass that last queued each tile
+  std::vector<int> tile_scratch_;
+  uint32_t sparse_pass_ = 0;
+  bool tiles_valid_ = false;
+
+  // Memoized evolution: nodes 0 and 1 are the dead and live cells; a node
+  // of level k holds 2^k cells and, once computed, its centre 2^(k-1)
+  // cells after 2^(k-2) generations
+  struct MemoNode {
+    uint32_t left;
+    uint32_t right;
+    int level;
+    int64_t result; // Node id, -1 until computed
+  };
+  std::vector<MemoNode> memo_nodes_;
+  std::unordered_map<uint64_t, uint32_t> memo_index_;
+  int memo_rule_ = -1; // Rule the memo table was built for
+
+  void reset_memo();
+  uint32_t memo_node(uint32_t left, uint32_t right);
+  uint32_t memo_result(uint32_t node);
+  void memo_jump_row(std::vector<int> &row, int log2_generations);
+
+  // Flat grids for run_with_rule(): (width + 2) x (height + 2) with a
+  // one-cell halo copied from the opposite edges
+  void load_padded(std::vector<uint8_t> &padded) const;
+  void store_padded(const std::vector<uint8_t> &padded);
+  void wrap_padded(std::vector<uint8_t> &padded) const;
 
   // Apply elementary rule to neighborhood
   int apply_elementary_rule(int left, int center, int right) const;
@@ -393,6 +571,52 @@ private:
   std::array<int, 9> get_neighborhood(int x, int y) const;
 };
 
+template <typename Rule>
+void CellularAutomatonEngine::run_with_rule(int generations, Rule rule) {
+  using Neighborhood = typename Rule::Neighborhood;
+  if (!initialized_ || generations <= 0)
+    return;
+
+  const int width = state_.width;
+  const int height = state_.height;
+  const size_t stride = static_cast<size_t>(width) + 2;
+  std::vector<uint8_t> current, next(stride * (height + 2));
+  load_padded(current);
+
+  auto step_rows = [&](size_t first, size_t last) {
+    for (size_t y = first; y < last; y++) {
+      const uint8_t *above = current.data() + (y - 1) * stride;
+      const uint8_t *row = above + stride;
+      const uint8_t *below = row + stride;
+      uint8_t *out = next.data() + y * stride;
+      for (int x = 1; x <= width; x++) {
+        out[x] = static_cast<uint8_t>(
+            rule(Neighborhood::gather(above, row, below, x)));
+      }
+    }
+  };
+
+  // Rows only read the previous generation, so they split freely
+  const size_t rows = static_cast<size_t>(height);
+  size_t grain = rows;
+  if (thread_pool_) {
+    grain = thread_pool_->grain_for(rows, CA_MIN_PARALLEL_CELLS / stride + 1);
+  }
+  for (int g = 0; g < generations; g++) {
+    wrap_padded(current);
+    if (grain < rows) {
+      thread_pool_->parallel_for(1, rows + 1, grain, step_rows);
+    } else {
+      step_rows(1, rows + 1);
+    }
+    current.swap(next);
+  }
+
+  store_padded(current);
+  state_.generation += generations;
+  tiles_valid_ = false;
+}
+
 // ================================================================
 // NeuronTimeCrystalMapper Class
 // ================================================================
@@ -416,13 +640,23 @@ public:
   // Create a new neuron map
   std::string create_neuron(const std::string &name);
 
-  // Add axon segment
+  // Add axon segment (attached to the soma)
   std::string add_axon_segment(const std::string &neuron_id, int scale_level);
 
-  // Add dendrite segment
+  // Add dendrite segment (attached to the soma)
   std::string add_dendrite_segment(const std::string &neuron_id,
                                    int scale_level);
 
+  // Import a neuron from a compact morphology; "" if the morphology is
+  // malformed (no leading soma, or a parent listed after its child)
+  std::string import_neuron(const std::string &name,
+                            const std::vector<NeuronSegmentSpec> &morphology);
+
+  // Import one neuron per name, all with the same morphology
+  std::vector<std::string>
+  import_neurons(const std::vector<std::string> &names,
+                 const std::vector<NeuronSegmentSpec> &morphology);
+
   // ================================================================
   // Triplet Band Mapping
   // ================================================================
@@ -444,39 +678,72 @@ public:
   // Create full neuron crystal hierarchy
   void create_neuron_crystal_hierarchy(const std::string &neuron_id);
 
-  // Update time crystal states
+  // Step every segment's crystal state over the SoA store, split across
+  // the thread pool for large morphologies
   void update_crystal_states();
 
-  // Get time crystal state for segment
-  const TimeCrystalQuantumState *
-  get_segment_crystal(const std::string &segment_id) const;
+  // Update on a shared pool (nullptr = serial). The pool must outlive the
+  // mapper.
+  void set_thread_pool(NanoBrainThreadPool *pool) { thread_pool_ = pool; }
+
+  // Copy a segment's time crystal state into out; false if unknown
+  bool get_segment_crystal(const std::string &segment_id,
+                           TimeCrystalQuantumState &out) const;
 
   // ================================================================
   // Neuron Access
   // ================================================================
 
-  // Get neuron map
-  const NeuronTimeCrystalMap *get_neuron(const std::string &neuron_id) const;
+  // Build a neuron map from the store into out; false if unknown
+  bool get_neuron(const std::string &neuron_id,
+                  NeuronTimeCrystalMap &out) const;
 
   // Get all neuron IDs
   std::vector<std::string> get_all_neuron_ids() const;
 
-  // Get segment by ID
-  const NeuronSegment *get_segment(const std::string &segment_id) const;
+  // Build a segment from the store into out; false if unknown
+  bool get_segment(const std::string &segment_id, NeuronSegment &out) const;
+
+  // Direct read access to the flattened morphology
+  const NeuronMorphologyStore &get_morphology() const { return store_; }
+
+  size_t get_neuron_count() const { return neurons_.size(); }
+  size_t get_segment_count() const { return store_.size(); }
 
 private:
   NanoBrainKernel *kernel_;
   TimeCrystalKernel *tc_kernel_;
 
-  std::map<std::string, NeuronTimeCrystalMap> neurons_;
-  std::map<std::string, NeuronSegment> all_segments_;
-  int neuron_counter_ = 0;
-  int segment_counter_ = 0;
-
-  std::string generate_neuron_id();
-  std::string generate_segment_id();
-  std::vector<int> generate_segment_primes(const std::string &segment_type,
-                                           int scale_level);
+  struct NeuronRecord {
+    std::string name;
+    uint32_t soma = 0;
+    std::vector<uint32_t> axons; // Segment indices, in creation order
+    std::vector<uint32_t> dendrites;
+  };
+
+  // PPM values of a prime encoding
+  struct PrimeSetValues {
+    float coherence;
+    float resonance;
+  };
+
+  std::vector<NeuronRecord> neurons_; // Indexed by the N of "neuron_N"
+  NeuronMorphologyStore store_;
+
+  // Keyed by prime mask (4-bit count per fundamental prime)
+  std::unordered_map<uint64_t, PrimeSetValues> prime_cache_;
+
+  size_t update_grain_ = 16384; // Minimum segments per update chunk
+  NanoBrainThreadPool *thread_pool_ = nullptr;
+
+  uint32_t add_segment(uint32_t neuron, NeuronSegmentKind kind,
+                       int scale_level, int32_t parent);
+  PrimeSetValues get_prime_set_values(const std::vector<int> &primes);
+  void fill_segment_view(uint32_t index, NeuronSegment &segment) const;
+  bool find_neuron(const std::string &neuron_id, uint32_t &index) const;
+  bool find_segment(const std::string &segment_id, uint32_t &index) const;
+  std::vector<int> generate_segment_primes(NeuronSegmentKind kind,
+                                           int scale_level) const;
 };
 
 // ================================================================
@@ -498,8 +765,9 @@ public:
   // Initialization
   // ================================================================
 
-  // Initialize with signal history size
-  void initialize(size_t history_size = 1000);
+  // Initialize with the global signal history size and the number of
+  // recent signals kept per source
+  void initialize(size_t history_size = 1000, size_t source_history_size = 16);
 
   // ================================================================
   // Signal Detection
@@ -512,15 +780,27 @@ public:
   // Get last detected signal
   const FilamentSignal *get_last_signal() const;
 
-  // Get all signals for a source
+  // Record an externally timed signal (replay, simulation)
+  void record_signal(const FilamentSignal &signal);
+
+  // Recent signals for a source, oldest first (up to source_history_size)
   std::vector<FilamentSignal>
   get_signals_for_source(const std::string &source_id) const;
 
+  // Last source_history_size - 1 inter-signal intervals (ms), oldest first
+  std::vector<float> get_recent_intervals(const std::string &source_id) const;
+
+  // Interval statistics for a source (zeroed if it never signalled)
+  FilamentSourceStats get_source_stats(const std::string &source_id) const;
+
+  // Interned ids (sources and targets) since the last clear
+  size_t get_source_count() const { return source_ids_.size(); }
+
   // ================================================================
   // Timing Prediction
   // ================================================================
 
-  // Predict spike timing based on current signal patterns
+  // Predict spike timing from the source's interval statistics, O(1)
   float predict_spike_timing(const std::string &source_id);
 
   // Get prediction confidence
@@ -553,17 +833,43 @@ private:
   NanoBrainKernel *kernel_;
   AttentionAllocationEngine *attention_engine_;
 
-  std::vector<FilamentSignal> signal_history_;
+  // Global history (last signal, strength statistics)
+  std::deque<FilamentSignal> signal_history_;
   size_t max_history_size_ = 1000;
+  double strength_sum_ = 0.0; // Running sums over signal_history_
+  double strength_sq_sum_ = 0.0;
   bool initialized_ = false;
 
+  // Per-source history: a fixed-size ring of compact samples plus the
+  // interval statistics, indexed by interned id (targets are interned in
+  // the same table)
+  struct SourceSample {
+    int64_t timestamp;
+    float signal_strength;
+    float predicted_timing;
+    int32_t target; // Interned id, -1 if none
+    bool is_pre_spike;
+  };
+  struct SourceTimeline {
+    std::vector<SourceSample> ring; // Allocated on the first signal
+    size_t head = 0;                // Oldest sample once the ring is full
+    FilamentSourceStats stats;
+  };
+  std::unordered_map<std::string, int32_t> source_ids_;
+  std::vector<std::string> source_names_;
+  std::vector<SourceTimeline> timelines_;
+  size_t source_history_size_ = 16;
+  float interval_smoothing_ = 0.125f; // EWMA weight of the newest interval
+
   // Pre-spike detection threshold
   float pre_spike_threshold_ = 0.7f;
 
   // Internal helpers
   float calculate_attention_derivative(const std::string &source_id,
                                        const std::vector<NodeTensor *> &nodes);
-  std::vector<int> generate_signal_primes(float strength);
+  std::vector<int> generate_signal_primes(float strength) const;
+  int32_t intern_source(const std::string &id);
+  const SourceTimeline *find_timeline(const std::string &source_id) const;
   int64_t current_time_millis() const;
 };
 
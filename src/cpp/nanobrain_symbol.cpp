@@ -0,0 +1,71 @@
+#include "nanobrain_symbol.h"
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+// Strings live in a deque (stable addresses); the map is keyed by views
+// into them, so lookups need no temporary std::string
+struct SymbolTable {
+  std::mutex mutex;
+  std::deque<std::string> strings;
+  std::unordered_map<std::string_view, const std::string *> index;
+
+  SymbolTable() {
+    strings.emplace_back();
+    index.emplace(std::string_view(strings.back()), &strings.back());
+  }
+};
+
+SymbolTable &symbol_table() {
+  static SymbolTable *table = new SymbolTable(); // Outlives static Symbols
+  return *table;
+}
+
+} // namespace
+
+// ================================================================
+// Symbol Implementation
+// ================================================================
+
+Symbol::Symbol() {
+  static const std::string *empty = intern("", 0);
+  text = empty;
+}
+
+Symbol::Symbol(const std::string &text)
+    : text(intern(text.data(), text.size())) {}
+
+Symbol::Symbol(const char *text)
+    : text(intern(text ? text : "", text ? std::strlen(text) : 0)) {}
+
+const std::string *Symbol::intern(const char *data, size_t size) {
+  SymbolTable &table = symbol_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  auto it = table.index.find(std::string_view(data, size));
+  if (it != table.index.end())
+    return it->second;
+  table.strings.emplace_back(data, size);
+  const std::string *entry = &table.strings.back();
+  table.index.emplace(std::string_view(*entry), entry);
+  return entry;
+}
+
+bool Symbol::find(const std::string &text, Symbol &symbol) {
+  SymbolTable &table = symbol_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  auto it = table.index.find(std::string_view(text));
+  if (it == table.index.end())
+    return false;
+  symbol.text = it->second;
+  return true;
+}
+
+size_t Symbol::table_size() {
+  SymbolTable &table = symbol_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  return table.strings.size();
+}
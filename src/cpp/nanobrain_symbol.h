@@ -0,0 +1,84 @@
+#ifndef NANOBRAIN_SYMBOL_H
+#define NANOBRAIN_SYMBOL_H
+
+/**
+ * NanoBrain Interned Symbols
+ *
+ * A Symbol is a pointer into a process-wide table of strings. Atom and
+ * link types come from a small vocabulary ("ConceptNode",
+ * "InheritanceLink", ...), so storing them as Symbols makes copies a
+ * pointer copy and Symbol == Symbol a pointer comparison.
+ *
+ * Interning takes a lock, so build Symbols once (e.g. as function-local
+ * statics) rather than per comparison; comparing with a literal compares
+ * characters and does not intern. Entries are never freed, so only intern
+ * bounded vocabularies, not names or ids; map untrusted text with find().
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+
+class Symbol {
+public:
+  Symbol(); // The empty symbol
+  Symbol(const std::string &text);
+  Symbol(const char *text);
+
+  const std::string &str() const { return *text; }
+  const char *c_str() const { return text->c_str(); }
+  operator const std::string &() const { return *text; }
+  size_t size() const { return text->size(); }
+  bool empty() const { return text->empty(); }
+
+  // Stable for the process lifetime; useful as a hash
+  uintptr_t id() const { return reinterpret_cast<uintptr_t>(text); }
+
+  friend bool operator==(const Symbol &a, const Symbol &b) {
+    return a.text == b.text;
+  }
+  friend bool operator!=(const Symbol &a, const Symbol &b) {
+    return a.text != b.text;
+  }
+  friend bool operator==(const Symbol &a, const char *b) {
+    return *a.text == b;
+  }
+  friend bool operator!=(const Symbol &a, const char *b) {
+    return *a.text != b;
+  }
+  friend bool operator==(const Symbol &a, const std::string &b) {
+    return *a.text == b;
+  }
+  friend bool operator!=(const Symbol &a, const std::string &b) {
+    return *a.text != b;
+  }
+  friend bool operator<(const Symbol &a, const Symbol &b) {
+    return *a.text < *b.text;
+  }
+  friend std::ostream &operator<<(std::ostream &out, const Symbol &s) {
+    return out << *s.text;
+  }
+
+  // Symbol for text if it is already interned; never adds an entry
+  static bool find(const std::string &text, Symbol &symbol);
+
+  // Number of interned strings
+  static size_t table_size();
+
+private:
+  const std::string *text;
+
+  static const std::string *intern(const char *data, size_t size);
+};
+
+namespace std {
+template <> struct hash<Symbol> {
+  size_t operator()(const Symbol &s) const {
+    return std::hash<uintptr_t>()(s.id());
+  }
+};
+} // namespace std
+
+#endif // NANOBRAIN_SYMBOL_H
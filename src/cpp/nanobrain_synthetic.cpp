@@ -0,0 +1,270 @@
+#include "nanobrain_synthetic.h"
+#include "nanobrain_distributed.h"
+#include "nanobrain_sharded.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+
+// ================================================================
+// Prime Distribution Tables
+// ================================================================
+
+namespace {
+
+// Cumulative weights over the 15 fundamental primes
+struct PrimeCdf {
+  std::array<double, FUNDAMENTAL_PRIMES_COUNT> cdf;
+
+  template <typename WeightFn> explicit PrimeCdf(WeightFn weight) {
+    double total = 0.0;
+    for (int i = 0; i < FUNDAMENTAL_PRIMES_COUNT; i++) {
+      total += weight(i);
+      cdf[i] = total;
+    }
+    for (auto &c : cdf) {
+      c /= total;
+    }
+  }
+
+  int sample(double u) const {
+    auto it = std::upper_bound(cdf.begin(), cdf.end(), u);
+    size_t idx = std::min<size_t>(it - cdf.begin(), cdf.size() - 1);
+    return FUNDAMENTAL_PRIMES[idx];
+  }
+};
+
+const PrimeCdf &small_prime_cdf() {
+  static const PrimeCdf table([](int i) { return std::pow(0.65, i); });
+  return table;
+}
+
+const PrimeCdf &zipf_cdf() {
+  static const PrimeCdf table([](int i) { return 1.0 / (i + 1); });
+  return table;
+}
+
+const char *SYNTHETIC_TYPES[] = {"ConceptNode", "PredicateNode", "NumberNode",
+                                 "SchemaNode"};
+
+} // namespace
+
+std::string prime_distribution_to_string(PrimeDistribution distribution) {
+  switch (distribution) {
+  case PrimeDistribution::Uniform:
+    return "uniform";
+  case PrimeDistribution::SmallPrimeBiased:
+    return "small";
+  case PrimeDistribution::Zipf:
+    return "zipf";
+  case PrimeDistribution::SingleFundamental:
+    return "single";
+  }
+  return "unknown";
+}
+
+bool parse_prime_distribution(const std::string &name,
+                              PrimeDistribution &distribution) {
+  static const PrimeDistribution all[] = {
+      PrimeDistribution::Uniform, PrimeDistribution::SmallPrimeBiased,
+      PrimeDistribution::Zipf, PrimeDistribution::SingleFundamental};
+  for (auto d : all) {
+    if (prime_distribution_to_string(d) == name) {
+      distribution = d;
+      return true;
+    }
+  }
+  return false;
+}
+
+// ================================================================
+// SyntheticAtomSpaceGenerator Implementation
+// ================================================================
+
+SyntheticAtomSpaceGenerator::SyntheticAtomSpaceGenerator(
+    const SyntheticAtomSpaceConfig &cfg)
+    : config(cfg), state(cfg.seed) {}
+
+void SyntheticAtomSpaceGenerator::reset() {
+  state = config.seed;
+  stats = SyntheticAtomSpaceStats{};
+}
+
+uint64_t SyntheticAtomSpaceGenerator::next_u64() {
+  // splitmix64
+  uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+size_t SyntheticAtomSpaceGenerator::next_index(size_t bound) {
+  return bound > 0 ? static_cast<size_t>(next_u64() % bound) : 0;
+}
+
+float SyntheticAtomSpaceGenerator::next_unit() {
+  return static_cast<float>((next_u64() >> 40) * (1.0 / 16777216.0));
+}
+
+int SyntheticAtomSpaceGenerator::draw_prime() {
+  double u = (next_u64() >> 11) * (1.0 / 9007199254740992.0);
+  switch (config.prime_distribution) {
+  case PrimeDistribution::SmallPrimeBiased:
+    return small_prime_cdf().sample(u);
+  case PrimeDistribution::Zipf:
+    return zipf_cdf().sample(u);
+  case PrimeDistribution::Uniform:
+  case PrimeDistribution::SingleFundamental:
+  default:
+    return FUNDAMENTAL_PRIMES[next_index(FUNDAMENTAL_PRIMES_COUNT)];
+  }
+}
+
+std::vector<int> SyntheticAtomSpaceGenerator::next_prime_set() {
+  if (config.prime_distribution == PrimeDistribution::SingleFundamental) {
+    return {draw_prime()};
+  }
+
+  int lo = std::max(1, config.min_primes_per_atom);
+  int hi = std::min(std::max(lo, config.max_primes_per_atom),
+                    FUNDAMENTAL_PRIMES_COUNT);
+  size_t count = lo + next_index(hi - lo + 1);
+
+  std::vector<int> primes;
+  primes.reserve(count);
+  // Bounded retries keep heavily skewed distributions from spinning
+  for (size_t attempt = 0; primes.size() < count && attempt < count * 8;
+       attempt++) {
+    int p = draw_prime();
+    if (std::find(primes.begin(), primes.end(), p) == primes.end()) {
+      primes.push_back(p);
+    }
+  }
+  std::sort(primes.begin(), primes.end());
+  return primes;
+}
+
+GeometricPattern
+SyntheticAtomSpaceGenerator::make_geometry(const std::vector<int> &primes,
+                                           size_t index) {
+  GeometricPattern geom;
+  geom.shape = index_to_gml_shape(static_cast<int>(index % 19));
+  geom.dimensions = 1 + static_cast<int>(next_index(TIME_CRYSTAL_DIMENSIONS));
+  geom.symmetry_group = "C" + std::to_string(primes.empty() ? 1 : primes[0]);
+  geom.musical_note = index_to_musical_note(static_cast<int>(next_index(12)));
+  geom.prime_resonance = primes;
+  geom.scale_factor = 0.5f + next_unit();
+  return geom;
+}
+
+template <typename Kernel>
+std::vector<std::string>
+SyntheticAtomSpaceGenerator::populate_kernel(Kernel &kernel) {
+  auto start = std::chrono::steady_clock::now();
+  stats = SyntheticAtomSpaceStats{};
+
+  std::vector<std::string> ids;
+  ids.reserve(config.atom_count);
+
+  for (size_t i = 0; i < config.atom_count; i++) {
+    std::vector<int> primes = next_prime_set();
+    GeometricPattern geom = make_geometry(primes, i);
+
+    bool gml = next_unit() < config.gml_fraction;
+    std::string name = (gml ? "GMLSynthetic" : "Synthetic") + std::to_string(i);
+
+    TruthValue tv{0.5f + 0.5f * next_unit(), 0.5f + 0.5f * next_unit(), 1.0f};
+    AttentionValue av{1000.0f * next_unit(), 500.0f * next_unit(),
+                      100.0f * next_unit()};
+
+    ids.push_back(kernel.create_atom(SYNTHETIC_TYPES[next_index(4)], name, tv,
+                                     av, primes, geom));
+  }
+  stats.atoms_created = ids.size();
+
+  size_t link_count =
+      static_cast<size_t>(config.link_density * static_cast<float>(ids.size()));
+  if (ids.size() > 1) {
+    for (size_t i = 0; i < link_count; i++) {
+      size_t a = next_index(ids.size());
+      size_t b = next_index(ids.size() - 1);
+      if (b >= a)
+        b++;
+      auto rule = static_cast<InferenceRuleType>(next_index(6));
+      if (!kernel.create_inference(ids[a], ids[b], rule).empty()) {
+        stats.links_created++;
+      }
+    }
+  }
+
+  stats.generation_seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+  return ids;
+}
+
+std::vector<std::string>
+SyntheticAtomSpaceGenerator::populate(TimeCrystalKernel &kernel) {
+  return populate_kernel(kernel);
+}
+
+std::vector<std::string>
+SyntheticAtomSpaceGenerator::populate(ShardedNanoBrainKernel &kernel) {
+  return populate_kernel(kernel);
+}
+
+std::vector<std::string>
+SyntheticAtomSpaceGenerator::populate(DistributedCoordinator &kernel) {
+  return populate_kernel(kernel);
+}
+
+std::vector<std::vector<int>>
+SyntheticAtomSpaceGenerator::generate_prime_sets(size_t count) {
+  std::vector<std::vector<int>> sets;
+  sets.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    sets.push_back(next_prime_set());
+  }
+  return sets;
+}
+
+std::vector<Atom> SyntheticAtomSpaceGenerator::generate_atoms(size_t count) {
+  std::vector<Atom> atoms(count);
+  for (size_t i = 0; i < count; i++) {
+    Atom &a = atoms[i];
+    a.id = "synthetic_" + std::to_string(i);
+    a.type = SYNTHETIC_TYPES[next_index(4)];
+    a.name = "Synthetic" + std::to_string(i);
+    a.truth_value[0] = next_unit();
+    a.truth_value[1] = next_unit();
+    a.truth_value[2] = 1.0f;
+    a.attention_value[0] = 1000.0f * next_unit();
+    a.attention_value[1] = 500.0f * next_unit();
+    a.attention_value[2] = 100.0f * next_unit();
+  }
+  return atoms;
+}
+
+std::string SyntheticAtomSpaceGenerator::generate_atomese(size_t count) {
+  static const char *links[] = {"InheritanceLink", "SimilarityLink",
+                                "ImplicationLink", "AndLink"};
+  size_t vocabulary = std::max<size_t>(count / 4, 16);
+
+  std::ostringstream ss;
+  ss.setf(std::ios::fixed);
+  ss.precision(3);
+  for (size_t i = 0; i < count; i++) {
+    if (next_index(4) == 0) {
+      // EvaluationLink with a predicate over a two-element ListLink
+      ss << "(EvaluationLink (stv " << next_unit() << " " << next_unit()
+         << ") (PredicateNode \"p" << next_index(vocabulary / 8 + 1)
+         << "\") (ListLink (ConceptNode \"c" << next_index(vocabulary)
+         << "\") (ConceptNode \"c" << next_index(vocabulary) << "\")))\n";
+    } else {
+      ss << "(" << links[next_index(4)] << " (stv " << next_unit() << " "
+         << next_unit() << ") (ConceptNode \"c" << next_index(vocabulary)
+         << "\") (ConceptNode \"c" << next_index(vocabulary) << "\"))\n";
+    }
+  }
+  return ss.str();
+}
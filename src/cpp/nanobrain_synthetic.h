@@ -0,0 +1,107 @@
+#ifndef NANOBRAIN_SYNTHETIC_H
+#define NANOBRAIN_SYNTHETIC_H
+
+/**
+ * Deterministic synthetic workload generators
+ *
+ * Builds reproducible AtomSpaces, prime sets and Atomese sources of arbitrary
+ * size for benchmarking and scaling experiments. The same configuration and
+ * seed always yield the same atoms, links and text on every platform.
+ */
+
+#include "nanobrain_time_crystal.h"
+#include "nanobrain_types.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ShardedNanoBrainKernel;
+class DistributedCoordinator;
+
+/**
+ * How prime signatures are drawn for synthetic atoms
+ */
+enum class PrimeDistribution {
+  Uniform,           // Every fundamental prime equally likely
+  SmallPrimeBiased,  // Geometric falloff favouring 2, 3, 5, ...
+  Zipf,              // Zipf(s = 1) over the 15 fundamental primes
+  SingleFundamental  // Exactly one fundamental prime per atom
+};
+
+/**
+ * Synthetic AtomSpace configuration
+ */
+struct SyntheticAtomSpaceConfig {
+  size_t atom_count = 1000;  // Base atoms (inference conclusions are extra)
+  float link_density = 0.1f; // Inference links per base atom
+  PrimeDistribution prime_distribution = PrimeDistribution::SmallPrimeBiased;
+  int min_primes_per_atom = 1;
+  int max_primes_per_atom = 5;
+  float gml_fraction = 0.05f; // Fraction of atoms named into the GML family
+  uint64_t seed = 42;
+};
+
+/**
+ * Statistics from the last populate() call
+ */
+struct SyntheticAtomSpaceStats {
+  size_t atoms_created = 0;
+  size_t links_created = 0;
+  double generation_seconds = 0.0;
+};
+
+/**
+ * Synthetic AtomSpace Generator
+ *
+ * Uses a splitmix64 stream rather than <random> distributions, whose output
+ * is implementation-defined, so generated workloads are bit-identical across
+ * standard libraries.
+ */
+class SyntheticAtomSpaceGenerator {
+public:
+  explicit SyntheticAtomSpaceGenerator(
+      const SyntheticAtomSpaceConfig &config = SyntheticAtomSpaceConfig{});
+
+  // Populate a kernel with atom_count atoms plus link_density * atom_count
+  // inference links. Returns the ids of the base atoms.
+  std::vector<std::string> populate(TimeCrystalKernel &kernel);
+  std::vector<std::string> populate(ShardedNanoBrainKernel &kernel);
+  std::vector<std::string> populate(DistributedCoordinator &kernel);
+
+  // Prime signatures following the configured distribution
+  std::vector<std::vector<int>> generate_prime_sets(size_t count);
+
+  // Plain Atom records for encoder benchmarks
+  std::vector<Atom> generate_atoms(size_t count);
+
+  // Atomese (Scheme) source with `count` top-level expressions
+  std::string generate_atomese(size_t count);
+
+  // Restart the stream from the configured seed
+  void reset();
+
+  const SyntheticAtomSpaceStats &get_stats() const { return stats; }
+  const SyntheticAtomSpaceConfig &get_config() const { return config; }
+
+private:
+  SyntheticAtomSpaceConfig config;
+  uint64_t state;
+  SyntheticAtomSpaceStats stats;
+
+  uint64_t next_u64();
+  size_t next_index(size_t bound);
+  float next_unit();
+  int draw_prime();
+  std::vector<int> next_prime_set();
+  GeometricPattern make_geometry(const std::vector<int> &primes, size_t index);
+
+  template <typename Kernel>
+  std::vector<std::string> populate_kernel(Kernel &kernel);
+};
+
+// Convert prime distribution to/from its command-line name
+std::string prime_distribution_to_string(PrimeDistribution distribution);
+bool parse_prime_distribution(const std::string &name,
+                              PrimeDistribution &distribution);
+
+#endif // NANOBRAIN_SYNTHETIC_H
@@ -0,0 +1,402 @@
+#include "nanobrain_thread_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// Pool and slot of the current thread, when it is a pool worker
+thread_local const NanoBrainThreadPool *tls_pool = nullptr;
+thread_local int tls_slot = 0;
+thread_local int tls_depth = 0; // Chunks running on this thread (nesting)
+
+// "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+std::vector<int> parse_cpu_list(const std::string &list) {
+  std::vector<int> cpus;
+  std::stringstream ss(list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    if (range.empty())
+      continue;
+    size_t dash = range.find('-');
+    int first = std::atoi(range.substr(0, dash).c_str());
+    int last = dash == std::string::npos
+                   ? first
+                   : std::atoi(range.substr(dash + 1).c_str());
+    for (int cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Cores of each NUMA node; a single node of all cores if unknown
+std::vector<std::vector<int>> numa_topology() {
+  std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+  for (int node = 0; node < 256; node++) {
+    std::ifstream file("/sys/devices/system/node/node" +
+                       std::to_string(node) + "/cpulist");
+    if (!file.is_open())
+      continue;
+    std::string list;
+    std::getline(file, list);
+    std::vector<int> cpus = parse_cpu_list(list);
+    if (!cpus.empty())
+      nodes.push_back(std::move(cpus));
+  }
+#endif
+  if (nodes.empty()) {
+    int cores = std::max(1u, std::thread::hardware_concurrency());
+    nodes.emplace_back();
+    for (int cpu = 0; cpu < cores; cpu++) {
+      nodes.back().push_back(cpu);
+    }
+  }
+  return nodes;
+}
+
+void set_thread_affinity(const std::vector<int> &cpus) {
+#if defined(__linux__)
+  if (cpus.empty())
+    return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &set);
+  }
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpus;
+#endif
+}
+
+} // namespace
+
+// ================================================================
+// WorkerArena Implementation
+// ================================================================
+
+void *WorkerArena::allocate(size_t bytes, size_t alignment) {
+  uintptr_t base = reinterpret_cast<uintptr_t>(buffer.get());
+  uintptr_t start = (base + used + alignment - 1) & ~(alignment - 1);
+  size_t offset = start - base;
+  if (!buffer || offset + bytes > size)
+    return nullptr;
+  used = offset + bytes;
+  return buffer.get() + offset;
+}
+
+// ================================================================
+// NanoBrainThreadPool Implementation
+// ================================================================
+
+NanoBrainThreadPool::NanoBrainThreadPool(const ThreadPoolConfig &config)
+    : config(config) {
+  int threads = config.threads > 0
+                    ? config.threads
+                    : static_cast<int>(
+                          std::max(1u, std::thread::hardware_concurrency()));
+  for (int slot = 0; slot < threads; slot++) {
+    workers.push_back(std::make_unique<Worker>());
+  }
+  place_workers();
+  reset_stats();
+
+  // Slot 0 is the caller; the others allocate their own arenas
+  workers[0]->arena.reserve(config.scratch_size);
+  for (int slot = 1; slot < threads; slot++) {
+    workers[slot]->thread = std::thread([this, slot] { worker_main(slot); });
+  }
+}
+
+NanoBrainThreadPool::~NanoBrainThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (auto &worker : workers) {
+    if (worker->thread.joinable())
+      worker->thread.join();
+  }
+}
+
+void NanoBrainThreadPool::place_workers() {
+  std::vector<std::vector<int>> nodes = numa_topology();
+  numa_nodes = static_cast<int>(nodes.size());
+  const bool partition = config.numa_policy == NumaPolicy::Partition;
+  const size_t count = workers.size();
+
+  std::vector<int> all_cpus;
+  std::vector<int> cpu_node;
+  for (size_t node = 0; node < nodes.size(); node++) {
+    for (int cpu : nodes[node]) {
+      all_cpus.push_back(cpu);
+      cpu_node.push_back(static_cast<int>(node));
+    }
+  }
+
+  // Partition: contiguous slots per node, so the contiguous chunk blocks
+  // dealt to consecutive slots stay on one node
+  std::vector<size_t> index_in_node(nodes.size(), 0);
+  for (size_t slot = 0; slot < count; slot++) {
+    Worker &worker = *workers[slot];
+    if (partition) {
+      size_t node = slot * nodes.size() / count;
+      worker.numa_node = static_cast<int>(node);
+      worker.node_cpus = nodes[node];
+      if (config.pin_threads) {
+        worker.cpu = nodes[node][index_in_node[node] % nodes[node].size()];
+      }
+      index_in_node[node]++;
+    } else if (config.pin_threads) {
+      size_t i = slot % all_cpus.size();
+      worker.cpu = all_cpus[i];
+      worker.numa_node = cpu_node[i];
+    }
+  }
+  workers[0]->cpu = -1; // The caller is never pinned
+
+  // Steal from the own node first, nearest slots first
+  for (size_t slot = 0; slot < count; slot++) {
+    Worker &worker = *workers[slot];
+    worker.victims.clear();
+    for (int pass = 0; pass < 2; pass++) {
+      for (size_t step = 1; step < count; step++) {
+        size_t victim = (slot + step) % count;
+        bool same = workers[victim]->numa_node == worker.numa_node;
+        if (same == (pass == 0))
+          worker.victims.push_back(static_cast<int>(victim));
+      }
+    }
+  }
+}
+
+void NanoBrainThreadPool::worker_main(int slot) {
+  tls_pool = this;
+  tls_slot = slot;
+
+  Worker &worker = *workers[slot];
+  if (worker.cpu >= 0) {
+    set_thread_affinity({worker.cpu});
+  } else if (config.numa_policy == NumaPolicy::Partition) {
+    set_thread_affinity(worker.node_cpus);
+  }
+
+  // Touch the arena from this thread so its pages land on this node
+  worker.arena.reserve(config.scratch_size);
+  if (void *pages = worker.arena.allocate(config.scratch_size, 1))
+    std::memset(pages, 0, config.scratch_size);
+  worker.arena.release(0);
+
+  while (true) {
+    if (try_run_one(slot))
+      continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    wake.wait(lock, [this] {
+      return stopping || queued.load(std::memory_order_acquire) > 0;
+    });
+    if (stopping && queued.load(std::memory_order_acquire) == 0)
+      return;
+  }
+}
+
+int NanoBrainThreadPool::current_worker() const {
+  return tls_pool == this ? tls_slot : 0;
+}
+
+WorkerArena &NanoBrainThreadPool::scratch() {
+  return workers[current_worker()]->arena;
+}
+
+size_t NanoBrainThreadPool::grain_for(size_t items, size_t min_grain) const {
+  size_t target = workers.size() * 4;
+  return std::max<size_t>({min_grain, 1, (items + target - 1) / target});
+}
+
+void NanoBrainThreadPool::run_chunks(
+    size_t count, const std::function<void(size_t)> &chunk) {
+  if (count == 0)
+    return;
+  jobs.fetch_add(1, std::memory_order_relaxed);
+
+  if (tls_pool == this) {
+    run_job(tls_slot, count, chunk);
+  } else {
+    // The caller becomes slot 0 for the job, so its chunks can nest
+    std::lock_guard<std::mutex> lock(external_mutex);
+    struct SlotScope {
+      const NanoBrainThreadPool *outer_pool = tls_pool;
+      int outer_slot = tls_slot;
+      ~SlotScope() {
+        tls_pool = outer_pool;
+        tls_slot = outer_slot;
+      }
+    } scope;
+    tls_pool = this;
+    tls_slot = 0;
+    run_job(0, count, chunk);
+  }
+}
+
+void NanoBrainThreadPool::run_job(int slot, size_t count,
+                                  const std::function<void(size_t)> &chunk) {
+  Job job;
+  job.body = &chunk;
+  job.remaining.store(count, std::memory_order_relaxed);
+
+  const size_t threads = workers.size();
+  if (threads == 1 || count == 1) {
+    for (size_t c = 0; c < count; c++) {
+      run_task(slot, {&job, c}, false);
+    }
+    if (job.error)
+      std::rethrow_exception(job.error);
+    return;
+  }
+
+  // Deal contiguous blocks of chunks, block w to slot w
+  for (size_t w = 0; w < threads; w++) {
+    size_t lo = count * w / threads;
+    size_t hi = count * (w + 1) / threads;
+    if (lo == hi)
+      continue;
+    std::lock_guard<std::mutex> lock(workers[w]->mutex);
+    for (size_t c = lo; c < hi; c++) {
+      workers[w]->tasks.push_back({&job, c});
+    }
+  }
+  queued.fetch_add(count, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+  }
+  wake.notify_all();
+
+  // Work (any job's chunks) until this job is done. Chunks of other jobs
+  // run here keep their exceptions in their own job.
+  while (job.remaining.load(std::memory_order_acquire) != 0) {
+    if (!try_run_one(slot))
+      std::this_thread::yield();
+  }
+  if (job.error)
+    std::rethrow_exception(job.error);
+}
+
+bool NanoBrainThreadPool::try_run_one(int slot) {
+  Worker &self = *workers[slot];
+  Task task;
+  bool stolen = false;
+  {
+    std::lock_guard<std::mutex> lock(self.mutex);
+    if (!self.tasks.empty()) {
+      task = self.tasks.front();
+      self.tasks.pop_front();
+    }
+  }
+  for (size_t i = 0; !task.job && i < self.victims.size(); i++) {
+    Worker &victim = *workers[self.victims[i]];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.back();
+      victim.tasks.pop_back();
+      stolen = true;
+    }
+  }
+  if (!task.job)
+    return false;
+
+  queued.fetch_sub(1, std::memory_order_acq_rel);
+  run_task(slot, task, stolen);
+  return true;
+}
+
+void NanoBrainThreadPool::run_task(int slot, const Task &task, bool stolen) {
+  Worker &worker = *workers[slot];
+  size_t mark = worker.arena.mark();
+  int64_t start = now_ns();
+
+  // A throwing chunk must still count as finished, or the job's owner
+  // would wait forever; the owner rethrows the first exception
+  tls_depth++;
+  try {
+    (*task.job->body)(task.chunk);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(task.job->error_mutex);
+    if (!task.job->error)
+      task.job->error = std::current_exception();
+  }
+  tls_depth--;
+
+  // Nested chunks are already inside the outer chunk's busy time
+  if (tls_depth == 0)
+    worker.busy_ns.fetch_add(static_cast<uint64_t>(now_ns() - start),
+                             std::memory_order_relaxed);
+  worker.chunks.fetch_add(1, std::memory_order_relaxed);
+  if (stolen)
+    worker.steals.fetch_add(1, std::memory_order_relaxed);
+  worker.arena.release(mark);
+
+  // Last touch of the job: its owner may return once this reaches zero
+  task.job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+ThreadPoolStats NanoBrainThreadPool::get_stats() const {
+  ThreadPoolStats stats;
+  stats.threads = static_cast<int>(workers.size());
+  stats.numa_nodes = numa_nodes;
+  stats.jobs = jobs.load(std::memory_order_relaxed);
+  stats.uptime_seconds =
+      static_cast<double>(now_ns() -
+                          stats_epoch_ns.load(std::memory_order_relaxed)) *
+      1e-9;
+
+  double busy_total = 0.0;
+  for (const auto &worker : workers) {
+    ThreadPoolWorkerStats w;
+    w.chunks = worker->chunks.load(std::memory_order_relaxed);
+    w.steals = worker->steals.load(std::memory_order_relaxed);
+    w.busy_seconds =
+        static_cast<double>(worker->busy_ns.load(std::memory_order_relaxed)) *
+        1e-9;
+    w.utilization =
+        stats.uptime_seconds > 0.0 ? w.busy_seconds / stats.uptime_seconds
+                                   : 0.0;
+    w.cpu = worker->cpu;
+    w.numa_node = worker->numa_node;
+    stats.chunks += w.chunks;
+    stats.steals += w.steals;
+    busy_total += w.busy_seconds;
+    stats.workers.push_back(w);
+  }
+  if (stats.uptime_seconds > 0.0) {
+    stats.utilization = busy_total / (stats.uptime_seconds * stats.threads);
+  }
+  return stats;
+}
+
+void NanoBrainThreadPool::reset_stats() {
+  for (auto &worker : workers) {
+    worker->chunks.store(0, std::memory_order_relaxed);
+    worker->steals.store(0, std::memory_order_relaxed);
+    worker->busy_ns.store(0, std::memory_order_relaxed);
+  }
+  jobs.store(0, std::memory_order_relaxed);
+  stats_epoch_ns.store(now_ns(), std::memory_order_relaxed);
+}
+
+int64_t NanoBrainThreadPool::now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
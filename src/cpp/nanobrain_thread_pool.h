@@ -0,0 +1,243 @@
+#ifndef NANOBRAIN_THREAD_POOL_H
+#define NANOBRAIN_THREAD_POOL_H
+
+/**
+ * NanoBrain Shared Thread Pool
+ *
+ * One work-stealing scheduler for every engine, so subsystems stop
+ * spawning their own threads per call:
+ *
+ * - parallel_for / parallel_reduce split a range into grain-sized chunks;
+ *   contiguous blocks of chunks are dealt to the workers' deques, owners
+ *   take their own chunks in order and idle workers steal from the other
+ *   end. The calling thread works too, so nested calls cannot deadlock.
+ * - parallel_reduce combines chunk results in chunk order: the result
+ *   depends on the grain, never on the thread count or the schedule.
+ * - Workers can be pinned to cores; the Partition NUMA policy spreads
+ *   workers evenly over NUMA nodes, keeps each on its node's cores and
+ *   makes idle workers steal from their own node first.
+ * - Every worker owns a scratch arena (allocated by the worker itself, so
+ *   first touch places it on the worker's node). Chunks get scratch() and
+ *   anything they allocate is released when the chunk ends.
+ * - get_stats() reports per-worker chunks, steals and busy time.
+ *
+ * Topology comes from /sys/devices/system/node on Linux; elsewhere the
+ * machine is one node and pinning is a no-op.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * NUMA placement of workers
+ */
+enum class NumaPolicy {
+  None,     // Workers run wherever the OS puts them
+  Partition // Workers spread over nodes and kept on their node's cores
+};
+
+/**
+ * Thread pool configuration
+ */
+struct ThreadPoolConfig {
+  int threads = 0;                // Including the caller (0 = hardware)
+  bool pin_threads = false;       // Pin each worker to one core
+  NumaPolicy numa_policy = NumaPolicy::None;
+  size_t scratch_size = 1u << 20; // Scratch arena bytes per worker
+};
+
+/**
+ * Per-worker counters
+ */
+struct ThreadPoolWorkerStats {
+  size_t chunks = 0;         // Chunks executed
+  size_t steals = 0;         // Chunks taken from another worker's deque
+  double busy_seconds = 0.0; // Time spent running chunks
+  double utilization = 0.0;  // busy_seconds / pool uptime
+  int cpu = -1;              // Pinned core (-1 = not pinned)
+  int numa_node = 0;
+};
+
+/**
+ * Pool counters; worker 0 is the calling thread
+ */
+struct ThreadPoolStats {
+  int threads = 0;
+  int numa_nodes = 1;
+  size_t jobs = 0; // parallel_for / parallel_reduce calls
+  size_t chunks = 0;
+  size_t steals = 0;
+  double uptime_seconds = 0.0;
+  double utilization = 0.0; // Mean worker utilization
+  std::vector<ThreadPoolWorkerStats> workers;
+};
+
+/**
+ * Bump allocator for per-chunk scratch
+ */
+class WorkerArena {
+public:
+  WorkerArena() = default;
+  explicit WorkerArena(size_t capacity) { reserve(capacity); }
+
+  void reserve(size_t capacity) {
+    buffer.reset(new unsigned char[capacity]);
+    size = capacity;
+    used = 0;
+  }
+
+  // nullptr if the arena is full
+  void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  template <typename T> T *allocate_array(size_t count) {
+    return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+  }
+
+  size_t mark() const { return used; }
+  void release(size_t mark) { used = mark; }
+
+  size_t get_capacity() const { return size; }
+  size_t get_used() const { return used; }
+
+private:
+  std::unique_ptr<unsigned char[]> buffer;
+  size_t size = 0;
+  size_t used = 0;
+};
+
+/**
+ * NanoBrain Thread Pool
+ *
+ * If chunks throw, the call still waits for every chunk of the job and
+ * then rethrows the first exception caught. Calls from threads outside
+ * the pool are serialized (they share worker slot 0); calls from inside a
+ * chunk run nested on the calling worker.
+ */
+class NanoBrainThreadPool {
+public:
+  explicit NanoBrainThreadPool(const ThreadPoolConfig &config = {});
+  ~NanoBrainThreadPool();
+
+  NanoBrainThreadPool(const NanoBrainThreadPool &) = delete;
+  NanoBrainThreadPool &operator=(const NanoBrainThreadPool &) = delete;
+
+  // ================================================================
+  // Parallel Primitives
+  // ================================================================
+
+  // body(lo, hi) over [begin, end) in chunks of `grain` items
+  template <typename Body>
+  void parallel_for(size_t begin, size_t end, size_t grain, Body &&body) {
+    if (end <= begin)
+      return;
+    grain = grain > 0 ? grain : 1;
+    size_t chunks = (end - begin + grain - 1) / grain;
+    run_chunks(chunks, [&](size_t chunk) {
+      size_t lo = begin + chunk * grain;
+      body(lo, lo + grain < end ? lo + grain : end);
+    });
+  }
+
+  // combine(...combine(identity, map(chunk 0)), ..., map(chunk n-1)) with
+  // map(lo, hi) -> T per chunk of `grain` items
+  template <typename T, typename Map, typename Combine>
+  T parallel_reduce(size_t begin, size_t end, size_t grain, T identity,
+                    Map &&map, Combine &&combine) {
+    if (end <= begin)
+      return identity;
+    grain = grain > 0 ? grain : 1;
+    size_t chunks = (end - begin + grain - 1) / grain;
+    std::vector<T> partials(chunks, identity);
+    run_chunks(chunks, [&](size_t chunk) {
+      size_t lo = begin + chunk * grain;
+      partials[chunk] = map(lo, lo + grain < end ? lo + grain : end);
+    });
+    T result = identity;
+    for (const T &partial : partials) {
+      result = combine(result, partial);
+    }
+    return result;
+  }
+
+  // Run chunk(0) ... chunk(count - 1) across the pool and wait for them
+  void run_chunks(size_t count, const std::function<void(size_t)> &chunk);
+
+  // Grain giving about four chunks per thread, at least min_grain
+  size_t grain_for(size_t items, size_t min_grain = 1) const;
+
+  // ================================================================
+  // Workers
+  // ================================================================
+
+  int get_thread_count() const { return static_cast<int>(workers.size()); }
+  int get_numa_node_count() const { return numa_nodes; }
+
+  // Current worker slot (0 outside the pool)
+  int current_worker() const;
+
+  // Scratch arena of the current worker; released after each chunk
+  WorkerArena &scratch();
+
+  ThreadPoolStats get_stats() const;
+  void reset_stats();
+
+private:
+  struct Job {
+    const std::function<void(size_t)> *body = nullptr;
+    std::atomic<size_t> remaining{0};
+    std::mutex error_mutex;
+    std::exception_ptr error; // First exception thrown by a chunk
+  };
+
+  struct Task {
+    Job *job = nullptr;
+    size_t chunk = 0;
+  };
+
+  struct alignas(64) Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks; // Owner pops the front, thieves the back
+    std::thread thread;
+    WorkerArena arena;
+    int cpu = -1;
+    int numa_node = 0;
+    std::vector<int> node_cpus; // Cores of its node (Partition policy)
+    std::vector<int> victims;   // Steal order: own node first
+
+    std::atomic<size_t> chunks{0};
+    std::atomic<size_t> steals{0};
+    std::atomic<uint64_t> busy_ns{0};
+  };
+
+  ThreadPoolConfig config;
+  std::vector<std::unique_ptr<Worker>> workers;
+  int numa_nodes = 1;
+
+  std::mutex sleep_mutex;
+  std::condition_variable wake;
+  std::atomic<size_t> queued{0}; // Tasks in all deques
+  bool stopping = false;
+
+  std::mutex external_mutex; // Serializes callers from outside the pool
+  std::atomic<size_t> jobs{0};
+  std::atomic<int64_t> stats_epoch_ns{0};
+
+  void place_workers();
+  void worker_main(int slot);
+  bool try_run_one(int slot);
+  void run_task(int slot, const Task &task, bool stolen);
+  void run_job(int slot, size_t count,
+               const std::function<void(size_t)> &chunk);
+  static int64_t now_ns();
+};
+
+#endif // NANOBRAIN_THREAD_POOL_H
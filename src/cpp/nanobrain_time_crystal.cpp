@@ -1,16 +1,33 @@
 #include "nanobrain_time_crystal.h"
+#include "nanobrain_trace.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <numeric>
-#include <random>
-#include <sstream>
 
 // ================================================================
 // Utility Functions Implementation
 // ================================================================
 
+bool lookup_atom_type(const std::string &text, Symbol &type) {
+  // Interned on first use so a fresh process knows the standard vocabulary
+  static const Symbol standard_types[] = {
+      "ConceptNode",     "PredicateNode",    "NumberNode",
+      "VariableNode",    "SchemaNode",       "GroundedSchemaNode",
+      "TypeNode",        "AnchorNode",       "ListLink",
+      "SetLink",         "AndLink",          "OrLink",
+      "NotLink",         "InheritanceLink",  "SimilarityLink",
+      "ImplicationLink", "EvaluationLink",   "ExecutionLink",
+      "BindLink",        "MemberLink",       "ContextLink",
+      "DefineLink",      "LambdaLink",       "PutLink",
+      "GetLink",         "EquivalenceLink",  "SatisfactionLink",
+      "StateLink",       "AtTimeLink"};
+  (void)standard_types;
+  return Symbol::find(text, type);
+}
+
 std::string gml_shape_to_string(GMLShape shape) {
   switch (shape) {
   case GMLShape::Sphere:
@@ -105,6 +122,87 @@ GMLShape index_to_gml_shape(int index) {
   return shapes[index % 19];
 }
 
+// ================================================================
+// Time Crystal State Stepping Kernel
+// ================================================================
+
+namespace {
+
+constexpr float TWO_PI_F = 2.0f * static_cast<float>(PI);
+constexpr float HALF_PI_F = 0.5f * static_cast<float>(PI);
+
+// sin() of a phase already wrapped to [0, 2*PI). Folds to [-PI/2, PI/2] with
+// selects and evaluates a degree-11 Taylor polynomial (error < 1e-7), which
+// unlike std::sin lets the stepping loop vectorize without -ffast-math.
+inline float wrapped_phase_sin(float phase) {
+  float x = phase - static_cast<float>(PI); // sin(phase) = -sin(x)
+  x = x > HALF_PI_F ? static_cast<float>(PI) - x : x;
+  x = x < -HALF_PI_F ? -static_cast<float>(PI) - x : x;
+  float x2 = x * x;
+  float poly =
+      1.0f +
+      x2 * (-1.0f / 6.0f +
+            x2 * (1.0f / 120.0f +
+                  x2 * (-1.0f / 5040.0f +
+                        x2 * (1.0f / 362880.0f + x2 * (-1.0f / 39916800.0f)))));
+  return -x * poly;
+}
+
+inline int count_trailing_zeros(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(bits);
+#else
+  int n = 0;
+  while (!(bits & 1u)) {
+    bits >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+// Copy the evolving scalars of slots [begin, end) into their owning atoms'
+// state views. Writer-side only, so const readers never touch the atoms.
+void copy_state_views(const TimeCrystalStateStore &store, size_t begin,
+                      size_t end) {
+  for (size_t i = begin; i < end; i++) {
+    auto &state = store.owners[i]->time_crystal_state;
+    state.quantum_phase = store.quantum_phase[i];
+    state.temporal_coherence = store.temporal_coherence[i];
+    state.fractal_dimension = store.fractal_dimension[i];
+    state.resonance_frequency = store.resonance_frequency[i];
+  }
+}
+
+} // namespace
+
+void step_time_crystal_range(TimeCrystalStateStore &store, size_t begin,
+                             size_t end, float phase_step,
+                             float coherence_threshold) {
+  NB_TRACE_SCOPE("time_crystal", "step_time_crystal_range");
+  float *__restrict phase = store.quantum_phase.data();
+  float *__restrict coherence = store.temporal_coherence.data();
+  float *__restrict fractal = store.fractal_dimension.data();
+  const float *__restrict resonance = store.resonance_frequency.data();
+  const float *__restrict max_fractal = store.max_fractal_dimension.data();
+  const float *__restrict regenerated = store.regenerated_coherence.data();
+
+  for (size_t i = begin; i < end; i++) {
+    // Phase evolution based on prime resonance, wrapped to [0, 2*PI)
+    float p = phase[i] + resonance[i] * phase_step;
+    p -= TWO_PI_F * std::floor(p * (1.0f / TWO_PI_F));
+    phase[i] = p;
+
+    // Temporal coherence decay, regenerated through prime alignment
+    float c = coherence[i] * 0.999f;
+    coherence[i] = c < coherence_threshold ? regenerated[i] : c;
+
+    // Fractal dimension evolution
+    float fd = fractal[i] + wrapped_phase_sin(p) * 0.01f;
+    fractal[i] = std::max(1.0f, std::min(max_fractal[i], fd));
+  }
+}
+
 // ================================================================
 // TimeCrystalKernel Implementation
 // ================================================================
@@ -116,6 +214,12 @@ TimeCrystalKernel::TimeCrystalKernel(const TimeCrystalConfig &cfg)
   NanoBrainConfig kernel_config;
   kernel_config.memory_size = config.memory_size;
   kernel_config.use_gpu = false;
+  kernel_config.scratch_size = config.scratch_memory_size;
+  kernel_config.budget_policy = config.memory_budget_policy;
+  kernel_config.budget_fraction = config.memory_budget_fraction;
+  kernel_config.memory_provisioning = config.memory_provisioning;
+  kernel_config.seed = config.seed;
+  kernel_config.thread_pool = config.thread_pool;
   kernel = std::make_unique<NanoBrainKernel>(kernel_config);
 }
 
@@ -128,9 +232,8 @@ int64_t TimeCrystalKernel::current_time_millis() const {
 }
 
 std::string TimeCrystalKernel::generate_atom_id() {
-  std::stringstream ss;
-  ss << "atom_" << atom_counter++;
-  return ss.str();
+  // Short enough for the small-string buffer: no allocation
+  return "atom_" + std::to_string(atom_counter++);
 }
 
 void TimeCrystalKernel::initialize() {
@@ -152,6 +255,8 @@ void TimeCrystalKernel::initialize() {
 
 void TimeCrystalKernel::shutdown() {
   active = false;
+  std::atomic_store(&published_metrics,
+                    std::shared_ptr<const NanoBrainMetrics>());
   std::cout << "[TimeCrystalKernel] Shutdown after " << cycle_count << " cycles"
             << std::endl;
 }
@@ -221,9 +326,9 @@ void TimeCrystalKernel::initialize_gml_atoms() {
 }
 
 std::string
-TimeCrystalKernel::create_atom(const std::string &type, const std::string &name,
+TimeCrystalKernel::create_atom(Symbol type, const std::string &name,
                                const TruthValue &tv, const AttentionValue &av,
-                               const std::vector<int> &prime_encoding,
+                               PrimeView prime_encoding,
                                const GeometricPattern &geometry) {
   std::string id = generate_atom_id();
 
@@ -233,55 +338,153 @@ TimeCrystalKernel::create_atom(const std::string &type, const std::string &name,
   atom.name = name;
   atom.truth_value = tv;
   atom.attention_value = av;
-  atom.prime_encoding = prime_encoding;
+  atom.prime_encoding = PrimeSet(prime_encoding);
   atom.fractal_geometry = geometry;
 
   // Generate quantum state
   TimeCrystalQuantumState quantum_state;
   quantum_state.dimensions = generate_quantum_coordinates();
-  quantum_state.prime_signature = prime_encoding;
+  quantum_state.prime_signature = atom.prime_encoding;
 
-  // Random temporal coherence in 0.5-1.0 range
-  static std::mt19937 rng(std::random_device{}());
-  static std::uniform_real_distribution<float> coherence_dist(0.5f, 1.0f);
-  static std::uniform_real_distribution<float> phase_dist(0.0f, 2.0f * PI);
+  // Random temporal coherence in 0.5-1.0 range, drawn from this atom's own
+  // stream so ids and states repeat for a given seed
+  CounterRng rng(config.seed, RandomSubsystem::TimeCrystal, atom_counter);
 
-  quantum_state.temporal_coherence = coherence_dist(rng);
+  quantum_state.temporal_coherence = rng.uniform(0.5f, 1.0f);
   quantum_state.fractal_dimension =
-      geometry.dimensions + (coherence_dist(rng) - 0.5f);
+      geometry.dimensions + (rng.uniform(0.5f, 1.0f) - 0.5f);
   quantum_state.resonance_frequency =
-      calculate_resonance_frequency(prime_encoding);
-  quantum_state.quantum_phase = phase_dist(rng);
+      calculate_resonance_frequency(atom.prime_encoding);
+  quantum_state.quantum_phase = rng.uniform(0.0f, 2.0f * PI);
 
   atom.time_crystal_state = quantum_state;
 
-  atom_space[id] = atom;
-  time_crystals[id] = quantum_state;
+  auto &entry = *atom_space.try_emplace(id).first;
+  entry.second = std::move(atom);
+  allocate_crystal_slot(entry.second, quantum_state);
+  index_atom(entry);
 
   return id;
 }
 
+size_t
+TimeCrystalKernel::allocate_crystal_slot(TimeCrystalAtom &atom,
+                                         const TimeCrystalQuantumState &state) {
+  auto &store = crystal_store;
+  size_t slot = store.size();
+
+  store.quantum_phase.push_back(state.quantum_phase);
+  store.temporal_coherence.push_back(state.temporal_coherence);
+  store.fractal_dimension.push_back(state.fractal_dimension);
+  store.resonance_frequency.push_back(state.resonance_frequency);
+  store.max_fractal_dimension.push_back(
+      static_cast<float>(atom.fractal_geometry.dimensions + 1));
+  store.regenerated_coherence.push_back(
+      compute_ppm_coherence(state.prime_signature));
+  store.base_resonance.push_back(
+      calculate_resonance_frequency(atom.prime_encoding));
+  store.owners.push_back(&atom);
+
+  if (slot / 64 >= store.gml_mask.size()) {
+    store.gml_mask.push_back(0);
+  }
+  if (atom.name.find("GML") != std::string::npos) {
+    store.gml_mask[slot / 64] |= uint64_t(1) << (slot % 64);
+  }
+
+  atom.crystal_slot = slot;
+  mark_snapshot_slot(slot);
+  queue_index_update(atom.id, slot);
+  return slot;
+}
+
+void TimeCrystalKernel::release_crystal_slot(size_t slot) {
+  auto &store = crystal_store;
+  size_t last = store.size() - 1;
+  auto bit = [](size_t s) { return uint64_t(1) << (s % 64); };
+
+  mark_snapshot_slot(slot);
+  mark_snapshot_slot(last);
+  queue_index_update(store.owners[slot]->id, REMOVED_SLOT);
+
+  if (slot != last) {
+    // Move the last slot into the hole to keep the arrays dense
+    queue_index_update(store.owners[last]->id, slot);
+    store.quantum_phase[slot] = store.quantum_phase[last];
+    store.temporal_coherence[slot] = store.temporal_coherence[last];
+    store.fractal_dimension[slot] = store.fractal_dimension[last];
+    store.resonance_frequency[slot] = store.resonance_frequency[last];
+    store.max_fractal_dimension[slot] = store.max_fractal_dimension[last];
+    store.regenerated_coherence[slot] = store.regenerated_coherence[last];
+    store.base_resonance[slot] = store.base_resonance[last];
+    store.owners[slot] = store.owners[last];
+    store.owners[slot]->crystal_slot = slot;
+
+    if (store.gml_mask[last / 64] & bit(last)) {
+      store.gml_mask[slot / 64] |= bit(slot);
+    } else {
+      store.gml_mask[slot / 64] &= ~bit(slot);
+    }
+  }
+  store.gml_mask[last / 64] &= ~bit(last);
+
+  store.quantum_phase.pop_back();
+  store.temporal_coherence.pop_back();
+  store.fractal_dimension.pop_back();
+  store.resonance_frequency.pop_back();
+  store.max_fractal_dimension.pop_back();
+  store.regenerated_coherence.pop_back();
+  store.base_resonance.pop_back();
+  store.owners.pop_back();
+  if (store.gml_mask.size() > (store.size() + 63) / 64) {
+    store.gml_mask.pop_back();
+  }
+}
+
 const TimeCrystalAtom *
 TimeCrystalKernel::get_atom(const std::string &id) const {
   auto it = atom_space.find(id);
-  if (it != atom_space.end()) {
-    return &it->second;
-  }
-  return nullptr;
+  return it != atom_space.end() ? &it->second : nullptr;
 }
 
 TimeCrystalAtom *TimeCrystalKernel::get_mutable_atom(const std::string &id) {
   auto it = atom_space.find(id);
   if (it != atom_space.end()) {
+    // The caller may change any field, so the next snapshot recopies it
+    mark_snapshot_slot(it->second.crystal_slot);
     return &it->second;
   }
   return nullptr;
 }
 
+TimeCrystalAtom *TimeCrystalKernel::find_atom(const std::string &id) {
+  // For internal attention updates only: attention values are captured on
+  // every publish, so the record page stays clean
+  auto it = atom_space.find(id);
+  return it != atom_space.end() ? &it->second : nullptr;
+}
+
 bool TimeCrystalKernel::remove_atom(const std::string &id) {
-  size_t erased = atom_space.erase(id);
-  time_crystals.erase(id);
-  return erased > 0;
+  auto it = atom_space.find(id);
+  if (it == atom_space.end())
+    return false;
+
+  // Inference links that reference the atom go with it rather than dangle
+  if (const auto *incoming = atom_index.incoming_set(it->first)) {
+    std::vector<std::string> link_ids;
+    link_ids.reserve(incoming->size());
+    for (const auto *link : *incoming) {
+      link_ids.push_back(link->first);
+    }
+    for (const auto &link_id : link_ids) {
+      remove_inference(link_id);
+    }
+  }
+
+  release_crystal_slot(it->second.crystal_slot);
+  unindex_atom(*it);
+  atom_space.erase(it);
+  return true;
 }
 
 std::vector<std::string> TimeCrystalKernel::get_all_atom_ids() const {
@@ -293,11 +496,116 @@ std::vector<std::string> TimeCrystalKernel::get_all_atom_ids() const {
   return ids;
 }
 
+// ================================================================
+// AtomSpace Indexes
+// ================================================================
+
+namespace {
+
+template <typename Set>
+const Set *find_bucket(const std::unordered_map<std::string, Set> &map,
+                       const std::string &key) {
+  auto it = map.find(key);
+  return it != map.end() ? &it->second : nullptr;
+}
+
+// Erase value from the bucket at key, dropping the bucket once empty
+template <typename Map, typename Key, typename Value>
+void erase_from_bucket(Map &map, const Key &key, const Value &value) {
+  auto it = map.find(key);
+  if (it == map.end())
+    return;
+  it->second.erase(value);
+  if (it->second.empty())
+    map.erase(it);
+}
+
+template <typename Set> std::vector<std::string> sorted_ids(const Set *set) {
+  std::vector<std::string> ids;
+  if (!set)
+    return ids;
+  ids.reserve(set->size());
+  for (const auto *entry : *set) {
+    ids.push_back(entry->first);
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+} // namespace
+
+const AtomSpaceIndex::AtomEntry *
+AtomSpaceIndex::find_atom(const std::string &atom_id) const {
+  auto it = by_id.find(std::string_view(atom_id));
+  return it != by_id.end() ? it->second : nullptr;
+}
+
+const AtomSpaceIndex::AtomSet *
+AtomSpaceIndex::atoms_of_type(Symbol type) const {
+  auto it = by_type.find(type);
+  return it != by_type.end() ? &it->second : nullptr;
+}
+
+const AtomSpaceIndex::AtomSet *
+AtomSpaceIndex::atoms_named(const std::string &name) const {
+  return find_bucket(by_name, name);
+}
+
+const AtomSpaceIndex::LinkSet *
+AtomSpaceIndex::incoming_set(const std::string &atom_id) const {
+  return find_bucket(incoming, atom_id);
+}
+
+void TimeCrystalKernel::index_atom(const AtomSpaceIndex::AtomEntry &entry) {
+  atom_index.by_id.emplace(std::string_view(entry.first), &entry);
+  atom_index.by_type[entry.second.type].insert(&entry);
+  atom_index.by_name[entry.second.name].insert(&entry);
+}
+
+void TimeCrystalKernel::unindex_atom(const AtomSpaceIndex::AtomEntry &entry) {
+  atom_index.by_id.erase(std::string_view(entry.first));
+  erase_from_bucket(atom_index.by_type, entry.second.type, &entry);
+  erase_from_bucket(atom_index.by_name, entry.second.name, &entry);
+}
+
+void TimeCrystalKernel::index_link(const AtomSpaceIndex::LinkEntry &entry) {
+  const TimeCrystalInference &inference = entry.second;
+  atom_index.by_rule[static_cast<size_t>(inference.rule)].insert(&entry);
+  for (const auto &premise_id : inference.premise_ids) {
+    atom_index.incoming[premise_id].insert(&entry);
+  }
+  atom_index.incoming[inference.conclusion_id].insert(&entry);
+}
+
+void TimeCrystalKernel::unindex_link(const AtomSpaceIndex::LinkEntry &entry) {
+  const TimeCrystalInference &inference = entry.second;
+  atom_index.by_rule[static_cast<size_t>(inference.rule)].erase(&entry);
+  for (const auto &premise_id : inference.premise_ids) {
+    erase_from_bucket(atom_index.incoming, premise_id, &entry);
+  }
+  erase_from_bucket(atom_index.incoming, inference.conclusion_id, &entry);
+}
+
+std::vector<std::string>
+TimeCrystalKernel::get_atoms_by_type(Symbol type) const {
+  return sorted_ids(atom_index.atoms_of_type(type));
+}
+
+std::vector<std::string>
+TimeCrystalKernel::get_atoms_by_name(const std::string &name) const {
+  return sorted_ids(atom_index.atoms_named(name));
+}
+
+std::vector<std::string>
+TimeCrystalKernel::get_incoming_set(const std::string &atom_id) const {
+  return sorted_ids(atom_index.incoming_set(atom_id));
+}
+
 // ================================================================
 // Phase Prime Metric (PPM) Functions
 // ================================================================
 
-float TimeCrystalKernel::compute_ppm_coherence(const std::vector<int> &primes) {
+float TimeCrystalKernel::compute_ppm_coherence(PrimeView primes) {
   if (primes.empty())
     return 0.5f;
 
@@ -319,8 +627,7 @@ float TimeCrystalKernel::compute_ppm_coherence(const std::vector<int> &primes) {
   return static_cast<float>(0.5 + 0.5 * std::sin(arg));
 }
 
-float TimeCrystalKernel::calculate_prime_importance(
-    const std::vector<int> &primes) {
+float TimeCrystalKernel::calculate_prime_importance(PrimeView primes) {
   if (primes.empty())
     return 1.0f;
 
@@ -338,8 +645,7 @@ float TimeCrystalKernel::calculate_prime_importance(
   return 0.5f + (total_score / primes.size()) * 0.5f;
 }
 
-float TimeCrystalKernel::calculate_resonance_frequency(
-    const std::vector<int> &primes) {
+float TimeCrystalKernel::calculate_resonance_frequency(PrimeView primes) {
   if (primes.empty())
     return 440.0f; // Default A note
 
@@ -361,12 +667,7 @@ bool TimeCrystalKernel::is_fundamental_prime(int prime) const {
 }
 
 int TimeCrystalKernel::get_fundamental_index(int prime) const {
-  for (size_t i = 0; i < FUNDAMENTAL_PRIMES.size(); i++) {
-    if (FUNDAMENTAL_PRIMES[i] == prime) {
-      return static_cast<int>(i);
-    }
-  }
-  return -1;
+  return fundamental_prime_index(prime);
 }
 
 // ================================================================
@@ -387,46 +688,49 @@ TimeCrystalKernel::generate_quantum_coordinates() {
 }
 
 void TimeCrystalKernel::update_time_crystal_states() {
-  float freq_factor = 2.0f * PI / config.temporal_processing_frequency;
-
-  for (auto &[atom_id, crystal] : time_crystals) {
-    auto *atom = get_mutable_atom(atom_id);
-    if (!atom)
-      continue;
-
-    // Phase evolution based on prime resonance
-    crystal.quantum_phase += crystal.resonance_frequency * freq_factor;
-    while (crystal.quantum_phase >= 2.0f * PI) {
-      crystal.quantum_phase -= 2.0f * PI;
-    }
-
-    // Temporal coherence decay and regeneration
-    crystal.temporal_coherence *= 0.999f;
-    if (crystal.temporal_coherence < config.quantum_coherence_threshold) {
-      // Regenerate coherence through prime alignment
-      crystal.temporal_coherence =
-          compute_ppm_coherence(crystal.prime_signature);
-    }
-
-    // Update fractal dimension evolution
-    crystal.fractal_dimension += std::sin(crystal.quantum_phase) * 0.01f;
-    crystal.fractal_dimension = std::max(
-        1.0f,
-        std::min(static_cast<float>(atom->fractal_geometry.dimensions + 1),
-                 crystal.fractal_dimension));
-
-    // Sync back to atom
-    atom->time_crystal_state = crystal;
+  const size_t n = crystal_store.size();
+  const float phase_step =
+      2.0f * static_cast<float>(PI) / config.temporal_processing_frequency;
+  const float threshold = config.quantum_coherence_threshold;
+
+  // Slots are independent, so chunks step in parallel on the pool,
+  // and copy the results into the atoms' state views while they are hot
+  size_t grain = std::max<size_t>(config.stepping_grain, 1);
+  if (!config.thread_pool || n <= grain) {
+    step_time_crystal_range(crystal_store, 0, n, phase_step, threshold);
+    copy_state_views(crystal_store, 0, n);
+    return;
   }
+  config.thread_pool->parallel_for(0, n, grain, [&](size_t begin, size_t end) {
+    step_time_crystal_range(crystal_store, begin, end, phase_step, threshold);
+    copy_state_views(crystal_store, begin, end);
+  });
 }
 
 const TimeCrystalQuantumState *
 TimeCrystalKernel::get_time_crystal_state(const std::string &atom_id) const {
-  auto it = time_crystals.find(atom_id);
-  if (it != time_crystals.end()) {
-    return &it->second;
-  }
-  return nullptr;
+  const auto *atom = get_atom(atom_id);
+  return atom ? &atom->time_crystal_state : nullptr;
+}
+
+bool TimeCrystalKernel::set_temporal_coherence(const std::string &atom_id,
+                                               float coherence) {
+  auto it = atom_space.find(atom_id);
+  if (it == atom_space.end())
+    return false;
+  crystal_store.temporal_coherence[it->second.crystal_slot] = coherence;
+  it->second.time_crystal_state.temporal_coherence = coherence;
+  return true;
+}
+
+bool TimeCrystalKernel::set_quantum_phase(const std::string &atom_id,
+                                          float phase) {
+  auto it = atom_space.find(atom_id);
+  if (it == atom_space.end())
+    return false;
+  crystal_store.quantum_phase[it->second.crystal_slot] = phase;
+  it->second.time_crystal_state.quantum_phase = phase;
+  return true;
 }
 
 float TimeCrystalKernel::calculate_temporal_flow(
@@ -454,18 +758,16 @@ float TimeCrystalKernel::calculate_geometric_resonance(
       calculate_musical_harmony(pattern1.musical_note, pattern2.musical_note);
 
   // Prime resonance overlap
-  std::vector<int> intersection;
+  size_t intersection = 0;
   for (int p : pattern1.prime_resonance) {
-    if (std::find(pattern2.prime_resonance.begin(),
-                  pattern2.prime_resonance.end(),
-                  p) != pattern2.prime_resonance.end()) {
-      intersection.push_back(p);
+    if (pattern2.prime_resonance.contains(p)) {
+      intersection++;
     }
   }
   size_t max_size = std::max(pattern1.prime_resonance.size(),
                              pattern2.prime_resonance.size());
   float prime_overlap =
-      max_size > 0 ? static_cast<float>(intersection.size()) / max_size : 0.0f;
+      max_size > 0 ? static_cast<float>(intersection) / max_size : 0.0f;
 
   return (shape_resonance + dim_resonance + musical_resonance + prime_overlap) /
          4.0f;
@@ -518,28 +820,23 @@ TimeCrystalKernel::combine_patterns(const GeometricPattern &p1,
 
   // Combine prime resonances
   combined.prime_resonance = p1.prime_resonance;
-  for (int p : p2.prime_resonance) {
-    if (std::find(combined.prime_resonance.begin(),
-                  combined.prime_resonance.end(),
-                  p) == combined.prime_resonance.end()) {
-      combined.prime_resonance.push_back(p);
-    }
-  }
+  combined.prime_resonance.merge(p2.prime_resonance);
 
   return combined;
 }
 
 void TimeCrystalKernel::update_gml_resonances() {
-  for (auto &[atom_id, atom] : atom_space) {
-    if (atom.name.find("GML") != std::string::npos) {
-      auto it = time_crystals.find(atom_id);
-      if (it != time_crystals.end()) {
-        auto &crystal = it->second;
-        // Update resonance based on current phase and prime alignment
-        crystal.resonance_frequency =
-            calculate_resonance_frequency(atom.prime_encoding) *
-            (1.0f + std::sin(crystal.quantum_phase) * 0.1f);
-      }
+  auto &store = crystal_store;
+  for (size_t word = 0; word < store.gml_mask.size(); word++) {
+    for (uint64_t bits = store.gml_mask[word]; bits; bits &= bits - 1) {
+      size_t slot = word * 64 + count_trailing_zeros(bits);
+      // Update resonance based on current phase and prime alignment
+      store.resonance_frequency[slot] =
+          store.base_resonance[slot] *
+          (1.0f + std::sin(store.quantum_phase[slot]) * 0.1f);
+      // The state views were copied before this step; keep them current
+      store.owners[slot]->time_crystal_state.resonance_frequency =
+          store.resonance_frequency[slot];
     }
   }
 }
@@ -549,27 +846,26 @@ void TimeCrystalKernel::update_gml_resonances() {
 // ================================================================
 
 void TimeCrystalKernel::perform_attention_allocation() {
-  // Calculate PPM-weighted importance for each atom
-  struct ImportanceScore {
-    std::string id;
-    float importance;
-  };
-
-  std::vector<ImportanceScore> scores;
+  // Calculate PPM-weighted importance for each atom (the score buffer is
+  // reused across cycles)
+  auto &scores = atom_scores;
+  scores.clear();
   scores.reserve(atom_space.size());
 
-  for (const auto &[id, atom] : atom_space) {
+  for (auto &[id, atom] : atom_space) {
     float base_importance =
         atom.attention_value.sti + atom.attention_value.lti * 0.1f;
     float prime_weight = calculate_prime_importance(atom.prime_encoding);
-    float coherence_bonus = atom.time_crystal_state.temporal_coherence * 100.0f;
+    float coherence_bonus =
+        crystal_store.temporal_coherence[atom.crystal_slot] * 100.0f;
 
-    scores.push_back({id, base_importance * prime_weight + coherence_bonus});
+    scores.push_back(
+        {&atom, base_importance * prime_weight + coherence_bonus});
   }
 
   // Sort by importance (descending)
   std::sort(scores.begin(), scores.end(), [](const auto &a, const auto &b) {
-    return a.importance > b.importance;
+    return a.score > b.score;
   });
 
   // Allocate budget
@@ -578,13 +874,11 @@ void TimeCrystalKernel::perform_attention_allocation() {
     if (remaining_budget <= 0)
       break;
 
-    auto *atom = get_mutable_atom(score.id);
-    if (!atom)
-      continue;
+    TimeCrystalAtom *atom = score.atom;
 
     // Allocate attention proportional to importance
     float allocation = std::min(remaining_budget * 0.1f, // Max 10% per atom
-                                score.importance * 0.01f);
+                                score.score * 0.01f);
 
     atom->attention_value.sti += allocation;
     atom->attention_value.sti *= (1.0f - config.attention_decay_rate);
@@ -610,7 +904,7 @@ void TimeCrystalKernel::spread_attention(
     const auto &inference = it->second;
 
     // Get conclusion atom
-    auto *conclusion = get_mutable_atom(inference.conclusion_id);
+    auto *conclusion = find_atom(inference.conclusion_id);
     if (!conclusion)
       continue;
 
@@ -631,29 +925,58 @@ void TimeCrystalKernel::spread_attention(
 
 std::vector<std::string>
 TimeCrystalKernel::get_top_attention_atoms(size_t k) const {
-  std::vector<std::pair<std::string, float>> scored_atoms;
-  scored_atoms.reserve(atom_space.size());
+  std::vector<RankedAtom> scored_atoms;
+  select_top_attention(k, scored_atoms);
 
-  for (const auto &[id, atom] : atom_space) {
-    scored_atoms.push_back({id, atom.attention_value.sti});
+  std::vector<std::string> result;
+  result.reserve(scored_atoms.size());
+  for (const auto &scored : scored_atoms) {
+    result.push_back(scored.atom->id);
   }
 
-  std::sort(scored_atoms.begin(), scored_atoms.end(),
-            [](const auto &a, const auto &b) { return a.second > b.second; });
+  return result;
+}
 
-  std::vector<std::string> result;
-  result.reserve(std::min(k, scored_atoms.size()));
-  for (size_t i = 0; i < std::min(k, scored_atoms.size()); i++) {
-    result.push_back(scored_atoms[i].first);
+void TimeCrystalKernel::select_top_attention(
+    size_t k, std::vector<RankedAtom> &scored_atoms) const {
+  scored_atoms.clear();
+  scored_atoms.reserve(atom_space.size());
+
+  for (const auto &[id, atom] : atom_space) {
+    scored_atoms.push_back({&atom, atom.attention_value.sti});
   }
 
-  return result;
+  std::sort(scored_atoms.begin(), scored_atoms.end(),
+            [](const auto &a, const auto &b) { return a.score > b.score; });
+  scored_atoms.resize(std::min(k, scored_atoms.size()));
 }
 
 // ================================================================
 // PLN Reasoning
 // ================================================================
 
+namespace {
+
+const char *inference_rule_name(InferenceRuleType rule) {
+  switch (rule) {
+  case InferenceRuleType::Similarity:
+    return "Similar";
+  case InferenceRuleType::Inheritance:
+    return "InheritsFrom";
+  case InferenceRuleType::Implication:
+    return "Implies";
+  case InferenceRuleType::Deduction:
+    return "Deduces";
+  case InferenceRuleType::Induction:
+    return "Induces";
+  case InferenceRuleType::Abduction:
+    return "Abduces";
+  }
+  return "";
+}
+
+} // namespace
+
 std::string TimeCrystalKernel::create_inference(const std::string &atom1_id,
                                                 const std::string &atom2_id,
                                                 InferenceRuleType rule) {
@@ -664,51 +987,35 @@ std::string TimeCrystalKernel::create_inference(const std::string &atom1_id,
     return "";
   }
 
+  return create_inference_link(*atom1, *atom2, rule);
+}
+
+const std::string &
+TimeCrystalKernel::create_inference_link(const TimeCrystalAtom &atom1,
+                                         const TimeCrystalAtom &atom2,
+                                         InferenceRuleType rule) {
   // Calculate geometric resonance
-  float resonance = calculate_geometric_resonance(atom1->fractal_geometry,
-                                                  atom2->fractal_geometry);
+  float resonance = calculate_geometric_resonance(atom1.fractal_geometry,
+                                                  atom2.fractal_geometry);
 
   // Create conclusion atom
-  std::string rule_name;
-  switch (rule) {
-  case InferenceRuleType::Similarity:
-    rule_name = "Similar";
-    break;
-  case InferenceRuleType::Inheritance:
-    rule_name = "InheritsFrom";
-    break;
-  case InferenceRuleType::Implication:
-    rule_name = "Implies";
-    break;
-  case InferenceRuleType::Deduction:
-    rule_name = "Deduces";
-    break;
-  case InferenceRuleType::Induction:
-    rule_name = "Induces";
-    break;
-  case InferenceRuleType::Abduction:
-    rule_name = "Abduces";
-    break;
-  }
-
-  std::string conclusion_name = atom1->name + rule_name + atom2->name;
+  const char *rule_name = inference_rule_name(rule);
+  std::string conclusion_name;
+  conclusion_name.reserve(atom1.name.size() + std::strlen(rule_name) +
+                          atom2.name.size());
+  conclusion_name.append(atom1.name).append(rule_name).append(atom2.name);
 
   // Combine prime encodings
-  std::vector<int> combined_primes = atom1->prime_encoding;
-  for (int p : atom2->prime_encoding) {
-    if (std::find(combined_primes.begin(), combined_primes.end(), p) ==
-        combined_primes.end()) {
-      combined_primes.push_back(p);
-    }
-  }
+  PrimeSet combined_primes = atom1.prime_encoding;
+  combined_primes.merge(atom2.prime_encoding);
 
   GeometricPattern combined_geom =
-      combine_patterns(atom1->fractal_geometry, atom2->fractal_geometry);
+      combine_patterns(atom1.fractal_geometry, atom2.fractal_geometry);
 
   TruthValue tv;
   tv.strength = resonance * 0.8f;
   tv.confidence =
-      (atom1->truth_value.confidence + atom2->truth_value.confidence) / 2.0f;
+      (atom1.truth_value.confidence + atom2.truth_value.confidence) / 2.0f;
   tv.count = 1.0f;
 
   AttentionValue av;
@@ -716,50 +1023,62 @@ std::string TimeCrystalKernel::create_inference(const std::string &atom1_id,
   av.lti = 25.0f;
   av.vlti = 10.0f;
 
-  std::string conclusion_id = create_atom("ConceptNode", conclusion_name, tv,
-                                          av, combined_primes, combined_geom);
+  static const Symbol concept_node("ConceptNode");
+  std::string conclusion_id = create_atom(
+      concept_node, conclusion_name, tv, av, combined_primes, combined_geom);
+
+  // Link ids are built in a reused buffer; re-deriving an existing link
+  // updates it in place
+  link_id_buffer.clear();
+  link_id_buffer.append(atom1.id)
+      .append(1, '-')
+      .append(std::to_string(static_cast<int>(rule)))
+      .append(1, '-')
+      .append(atom2.id);
+  auto it = link_space.find(link_id_buffer);
+  if (it == link_space.end()) {
+    it = link_space.emplace(link_id_buffer, TimeCrystalInference()).first;
+  } else {
+    unindex_link(*it); // The conclusion changes
+  }
 
   // Create inference link
-  TimeCrystalInference inference;
+  TimeCrystalInference &inference = it->second;
   inference.rule = rule;
-  inference.premise_ids = {atom1_id, atom2_id};
-  inference.conclusion_id = conclusion_id;
-  inference.temporal_flow = calculate_temporal_flow(atom1->time_crystal_state,
-                                                    atom2->time_crystal_state);
+  inference.premise_ids.resize(2);
+  inference.premise_ids[0] = atom1.id;
+  inference.premise_ids[1] = atom2.id;
+  inference.conclusion_id = std::move(conclusion_id);
+  inference.temporal_flow = calculate_temporal_flow(atom1.time_crystal_state,
+                                                    atom2.time_crystal_state);
   inference.prime_consistency =
-      calculate_prime_consistency(atom1->prime_encoding, atom2->prime_encoding);
+      calculate_prime_consistency(atom1.prime_encoding, atom2.prime_encoding);
   inference.fractal_convergence = resonance;
-  inference.quantum_coherence = (atom1->time_crystal_state.temporal_coherence +
-                                 atom2->time_crystal_state.temporal_coherence) /
+  inference.quantum_coherence = (atom1.time_crystal_state.temporal_coherence +
+                                 atom2.time_crystal_state.temporal_coherence) /
                                 2.0f;
+  index_link(*it);
+  snapshot_inferences_dirty = true;
 
-  std::string link_id =
-      atom1_id + "-" + std::to_string(static_cast<int>(rule)) + "-" + atom2_id;
-  link_space[link_id] = inference;
-
-  return link_id;
+  return it->first;
 }
 
 void TimeCrystalKernel::perform_pln_reasoning() {
   // Get high-attention atoms for reasoning
-  auto active_atoms = get_top_attention_atoms(10);
+  select_top_attention(10, top_atoms);
 
   // Generate inferences using time crystal enhanced PLN
-  for (size_t i = 0; i < active_atoms.size(); i++) {
-    for (size_t j = i + 1; j < active_atoms.size(); j++) {
-      const auto *atom1 = get_atom(active_atoms[i]);
-      const auto *atom2 = get_atom(active_atoms[j]);
-
-      if (!atom1 || !atom2)
-        continue;
+  for (size_t i = 0; i < top_atoms.size(); i++) {
+    for (size_t j = i + 1; j < top_atoms.size(); j++) {
+      const TimeCrystalAtom &atom1 = *top_atoms[i].atom;
+      const TimeCrystalAtom &atom2 = *top_atoms[j].atom;
 
       // Check for geometric resonance
-      float resonance = calculate_geometric_resonance(atom1->fractal_geometry,
-                                                      atom2->fractal_geometry);
+      float resonance = calculate_geometric_resonance(atom1.fractal_geometry,
+                                                      atom2.fractal_geometry);
 
       if (resonance > 0.5f) {
-        create_inference(active_atoms[i], active_atoms[j],
-                         InferenceRuleType::Similarity);
+        create_inference_link(atom1, atom2, InferenceRuleType::Similarity);
       }
     }
   }
@@ -783,30 +1102,41 @@ TimeCrystalKernel::get_inference(const std::string &id) const {
   return nullptr;
 }
 
-float TimeCrystalKernel::calculate_prime_consistency(
-    const std::vector<int> &primes1, const std::vector<int> &primes2) {
+bool TimeCrystalKernel::remove_inference(const std::string &id) {
+  auto it = link_space.find(id);
+  if (it == link_space.end())
+    return false;
+
+  unindex_link(*it);
+  link_space.erase(it);
+  snapshot_inferences_dirty = true;
+  return true;
+}
+
+float TimeCrystalKernel::calculate_prime_consistency(PrimeView primes1,
+                                                     PrimeView primes2) {
   if (primes1.empty() || primes2.empty())
     return 0.0f;
 
-  // Calculate intersection and union
-  std::vector<int> union_primes;
-  std::vector<int> intersection;
-
+  // Intersection: primes1 entries found in primes2. Union: all of primes1
+  // plus each distinct primes2 entry not in primes1.
+  size_t intersection = 0;
   for (int p : primes1) {
-    union_primes.push_back(p);
     if (std::find(primes2.begin(), primes2.end(), p) != primes2.end()) {
-      intersection.push_back(p);
+      intersection++;
     }
   }
-  for (int p : primes2) {
-    if (std::find(union_primes.begin(), union_primes.end(), p) ==
-        union_primes.end()) {
-      union_primes.push_back(p);
+  size_t union_size = primes1.size();
+  for (size_t j = 0; j < primes2.size(); j++) {
+    const int *seen = primes2.begin() + j;
+    if (std::find(primes1.begin(), primes1.end(), primes2[j]) ==
+            primes1.end() &&
+        std::find(primes2.begin(), seen, primes2[j]) == seen) {
+      union_size++;
     }
   }
 
-  return static_cast<float>(intersection.size()) /
-         static_cast<float>(union_primes.size());
+  return static_cast<float>(intersection) / static_cast<float>(union_size);
 }
 
 // ================================================================
@@ -819,9 +1149,7 @@ TimeCrystalKernel::encode_atom_to_tensor(const std::string &atom_id) {
   if (!atom)
     return nullptr;
 
-  // Create 128-dimensional embedding tensor
-  auto *tensor = kernel->create_tensor({128});
-
+  // 128-dimensional embedding, copied into a tensor once built
   std::vector<float> data(128, 0.0f);
 
   // Type encoding (first element)
@@ -860,8 +1188,7 @@ TimeCrystalKernel::encode_atom_to_tensor(const std::string &atom_id) {
   data[36] = atom->time_crystal_state.resonance_frequency / 20000.0f;
   data[37] = atom->time_crystal_state.quantum_phase / (2.0f * PI);
 
-  kernel->set_data(tensor, data);
-  return tensor;
+  return kernel->create_tensor_from(data);
 }
 
 NanoBrainTensor *
@@ -884,12 +1211,12 @@ NanoBrainMetrics TimeCrystalKernel::get_metrics() const {
     metrics.quantum_coherence = 0.0f;
   } else {
     float total_attention = 0.0f;
-    float total_coherence = 0.0f;
-
     for (const auto &[_, atom] : atom_space) {
       total_attention += atom.attention_value.sti;
-      total_coherence += atom.time_crystal_state.temporal_coherence;
     }
+    float total_coherence =
+        std::accumulate(crystal_store.temporal_coherence.begin(),
+                        crystal_store.temporal_coherence.end(), 0.0f);
 
     metrics.average_attention = total_attention / atom_space.size();
     metrics.quantum_coherence = total_coherence / atom_space.size();
@@ -929,28 +1256,23 @@ float TimeCrystalKernel::calculate_overall_prime_alignment() const {
 }
 
 float TimeCrystalKernel::calculate_fractal_complexity() const {
-  if (time_crystals.empty())
+  if (crystal_store.size() == 0)
     return 0.0f;
 
-  float total_fractal_dim = 0.0f;
-  for (const auto &[_, crystal] : time_crystals) {
-    total_fractal_dim += crystal.fractal_dimension;
-  }
+  float total_fractal_dim =
+      std::accumulate(crystal_store.fractal_dimension.begin(),
+                      crystal_store.fractal_dimension.end(), 0.0f);
 
-  float avg = total_fractal_dim / time_crystals.size();
+  float avg = total_fractal_dim / crystal_store.size();
   return std::min(avg / config.time_crystal_dimensions, 1.0f);
 }
 
 float TimeCrystalKernel::calculate_temporal_stability() const {
-  if (time_crystals.empty())
+  if (crystal_store.size() == 0)
     return 0.0f;
 
   // Measure coherence variance as stability indicator
-  std::vector<float> coherences;
-  coherences.reserve(time_crystals.size());
-  for (const auto &[_, crystal] : time_crystals) {
-    coherences.push_back(crystal.temporal_coherence);
-  }
+  const auto &coherences = crystal_store.temporal_coherence;
 
   float avg = std::accumulate(coherences.begin(), coherences.end(), 0.0f) /
               coherences.size();
@@ -972,12 +1294,11 @@ float TimeCrystalKernel::calculate_consciousness_emergence() const {
   m.fractal_complexity = 0.0f;
   m.temporal_stability = 0.0f;
 
-  if (!atom_space.empty()) {
-    float total_coherence = 0.0f;
-    for (const auto &[_, atom] : atom_space) {
-      total_coherence += atom.time_crystal_state.temporal_coherence;
-    }
-    m.quantum_coherence = total_coherence / atom_space.size();
+  if (crystal_store.size() > 0) {
+    float total_coherence =
+        std::accumulate(crystal_store.temporal_coherence.begin(),
+                        crystal_store.temporal_coherence.end(), 0.0f);
+    m.quantum_coherence = total_coherence / crystal_store.size();
   }
 
   m.prime_alignment = calculate_overall_prime_alignment();
@@ -990,6 +1311,343 @@ float TimeCrystalKernel::calculate_consciousness_emergence() const {
                   0.25f);
 }
 
+// ================================================================
+// Snapshot Isolation
+// ================================================================
+
+void TimeCrystalKernel::mark_snapshot_slot(size_t slot) {
+  size_t page = slot / TimeCrystalSnapshot::PAGE_SIZE;
+  if (page >= snapshot_page_dirty.size()) {
+    snapshot_page_dirty.resize(page + 1, 1);
+  }
+  snapshot_page_dirty[page] = 1;
+}
+
+void TimeCrystalKernel::queue_index_update(const std::string &id,
+                                           size_t slot) {
+  if (!snapshot_index_built)
+    return;
+  snapshot_index_updates[id] = slot;
+  // Without publishes the queue would grow with churn; past the size of
+  // the AtomSpace a rebuild is cheaper than the patch
+  if (snapshot_index_updates.size() > atom_space.size()) {
+    snapshot_index_updates.clear();
+    snapshot_index_built = false;
+  }
+}
+
+// Append entries as one or more chunks, splitting overgrown ones
+void TimeCrystalKernel::append_index_chunks(SlotChunks &chunks,
+                                            SlotChunk &&entries) {
+  constexpr size_t CHUNK = TimeCrystalSnapshot::INDEX_CHUNK_SIZE;
+  if (entries.size() <= 2 * CHUNK) {
+    if (!entries.empty())
+      chunks.push_back(std::make_shared<const SlotChunk>(std::move(entries)));
+    return;
+  }
+  for (size_t begin = 0; begin < entries.size(); begin += CHUNK) {
+    size_t end = std::min(entries.size(), begin + CHUNK);
+    chunks.push_back(std::make_shared<const SlotChunk>(
+        std::make_move_iterator(entries.begin() + begin),
+        std::make_move_iterator(entries.begin() + end)));
+  }
+}
+
+void TimeCrystalKernel::build_snapshot_index() {
+  SlotChunks chunks;
+  chunks.reserve(atom_space.size() / TimeCrystalSnapshot::INDEX_CHUNK_SIZE +
+                 1);
+  SlotChunk entries;
+  for (const auto &[id, atom] : atom_space) {
+    entries.emplace_back(id, atom.crystal_slot);
+    if (entries.size() == TimeCrystalSnapshot::INDEX_CHUNK_SIZE) {
+      append_index_chunks(chunks, std::move(entries));
+      entries = SlotChunk();
+    }
+  }
+  append_index_chunks(chunks, std::move(entries));
+
+  snapshot_index = std::move(chunks);
+  snapshot_index_updates.clear();
+  snapshot_index_built = true;
+}
+
+size_t TimeCrystalKernel::patch_snapshot_index() {
+  // Both the chunks and the queued updates are in id order: merge each
+  // chunk with the updates that fall before the next chunk's first id,
+  // and share the chunks no update touches
+  const SlotChunks &old = snapshot_index;
+  SlotChunks chunks;
+  chunks.reserve(old.size() + 1);
+  size_t copied = 0;
+
+  static const SlotChunk no_entries;
+  auto &updates = snapshot_index_updates;
+  auto update = updates.begin();
+  for (size_t i = 0; i < old.size() || update != updates.end(); i++) {
+    auto stop = i + 1 < old.size()
+                    ? updates.lower_bound(old[i + 1]->front().first)
+                    : updates.end();
+    if (i < old.size() && update == stop) {
+      chunks.push_back(old[i]);
+      continue;
+    }
+
+    const SlotChunk &current = i < old.size() ? *old[i] : no_entries;
+    auto entry = current.begin();
+    SlotChunk merged;
+    merged.reserve(current.size() + std::distance(update, stop));
+    while (entry != current.end() || update != stop) {
+      if (update == stop ||
+          (entry != current.end() && entry->first < update->first)) {
+        merged.push_back(*entry++);
+        continue;
+      }
+      if (entry != current.end() && entry->first == update->first)
+        ++entry; // Moved or removed
+      if (update->second != REMOVED_SLOT)
+        merged.emplace_back(update->first, update->second);
+      ++update;
+    }
+    append_index_chunks(chunks, std::move(merged));
+    copied++;
+  }
+
+  snapshot_index = std::move(chunks);
+  snapshot_index_updates.clear();
+  return copied;
+}
+
+std::shared_ptr<const TimeCrystalSnapshot>
+TimeCrystalKernel::publish_snapshot() {
+  NB_TRACE_SCOPE("time_crystal", "TimeCrystalKernel::publish_snapshot");
+  auto start = std::chrono::steady_clock::now();
+
+  constexpr size_t PAGE_SIZE = TimeCrystalSnapshot::PAGE_SIZE;
+  const auto &store = crystal_store;
+  const size_t n = store.size();
+  const size_t page_count = (n + PAGE_SIZE - 1) / PAGE_SIZE;
+
+  auto snapshot = std::make_shared<TimeCrystalSnapshot>();
+  snapshot->version = ++snapshot_version;
+  snapshot->cycle_count = cycle_count;
+
+  TimeCrystalSnapshotStats stats;
+  stats.version = snapshot->version;
+  stats.pages_total = page_count;
+
+  // Atom records: rebuild dirty pages, share the rest with older versions
+  snapshot_pages.resize(page_count);
+  snapshot_page_dirty.resize(page_count, 1);
+  for (size_t p = 0; p < page_count; p++) {
+    if (!snapshot_page_dirty[p] && snapshot_pages[p])
+      continue;
+
+    size_t begin = p * PAGE_SIZE;
+    size_t end = std::min(n, begin + PAGE_SIZE);
+    auto page = std::make_shared<TimeCrystalSnapshot::AtomPage>();
+    page->reserve(end - begin);
+    for (size_t slot = begin; slot < end; slot++) {
+      page->push_back(*store.owners[slot]);
+    }
+    snapshot_pages[p] = std::move(page);
+    snapshot_page_dirty[p] = 0;
+    stats.pages_copied++;
+  }
+  snapshot->pages = snapshot_pages;
+
+  // Id index: built once, then patched chunk by chunk
+  if (!snapshot_index_built) {
+    build_snapshot_index();
+    stats.index_rebuilt = true;
+  } else if (!snapshot_index_updates.empty()) {
+    stats.index_chunks_copied = patch_snapshot_index();
+  }
+  snapshot->index_chunks = snapshot_index;
+
+  if (snapshot_inferences_dirty || !snapshot_inferences) {
+    snapshot_inferences =
+        std::make_shared<TimeCrystalSnapshot::InferenceTable>(link_space);
+    snapshot_inferences_dirty = false;
+    stats.inferences_copied = true;
+  }
+  snapshot->inferences = snapshot_inferences;
+
+  // Per-cycle columns
+  snapshot->attention.resize(n);
+  for (size_t slot = 0; slot < n; slot++) {
+    snapshot->attention[slot] = store.owners[slot]->attention_value;
+  }
+  snapshot->quantum_phase = store.quantum_phase;
+  snapshot->temporal_coherence = store.temporal_coherence;
+  snapshot->fractal_dimension = store.fractal_dimension;
+  snapshot->resonance_frequency = store.resonance_frequency;
+  snapshot->metrics = get_metrics();
+
+  // Retire the previous version; readers may still hold it
+  if (published_snapshot) {
+    retired_snapshots.push_back(published_snapshot);
+  }
+  std::atomic_store(&published_snapshot,
+                    std::shared_ptr<const TimeCrystalSnapshot>(snapshot));
+
+  retired_snapshots.erase(
+      std::remove_if(retired_snapshots.begin(), retired_snapshots.end(),
+                     [](const auto &weak) { return weak.expired(); }),
+      retired_snapshots.end());
+
+  stats.publish_ms = std::chrono::duration<float, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+  snapshot_stats = stats;
+  return snapshot;
+}
+
+std::shared_ptr<const TimeCrystalSnapshot>
+TimeCrystalKernel::acquire_snapshot() const {
+  return std::atomic_load(&published_snapshot);
+}
+
+std::shared_ptr<const NanoBrainMetrics> TimeCrystalKernel::publish_metrics() {
+  std::shared_ptr<const NanoBrainMetrics> metrics;
+  if (active) {
+    metrics = std::make_shared<const NanoBrainMetrics>(get_metrics());
+  }
+  std::atomic_store(&published_metrics, metrics);
+  return metrics;
+}
+
+std::shared_ptr<const NanoBrainMetrics>
+TimeCrystalKernel::acquire_metrics() const {
+  return std::atomic_load(&published_metrics);
+}
+
+TimeCrystalSnapshotStats TimeCrystalKernel::get_snapshot_stats() const {
+  TimeCrystalSnapshotStats stats = snapshot_stats;
+  for (const auto &weak : retired_snapshots) {
+    if (auto pinned = weak.lock()) {
+      stats.pinned_versions++;
+      if (stats.oldest_pinned_version == 0 ||
+          pinned->version < stats.oldest_pinned_version) {
+        stats.oldest_pinned_version = pinned->version;
+      }
+    }
+  }
+  return stats;
+}
+
+// ================================================================
+// TimeCrystalSnapshot Implementation
+// ================================================================
+
+void TimeCrystalSnapshot::materialize(size_t slot, TimeCrystalAtom &out) const {
+  out = (*pages[slot / PAGE_SIZE])[slot % PAGE_SIZE];
+  out.attention_value = attention[slot];
+  auto &state = out.time_crystal_state;
+  state.quantum_phase = quantum_phase[slot];
+  state.temporal_coherence = temporal_coherence[slot];
+  state.fractal_dimension = fractal_dimension[slot];
+  state.resonance_frequency = resonance_frequency[slot];
+}
+
+const TimeCrystalSnapshot::SlotEntry *
+TimeCrystalSnapshot::find_slot(const std::string &id) const {
+  // Last chunk starting at or before id
+  auto chunk = std::upper_bound(
+      index_chunks.begin(), index_chunks.end(), id,
+      [](const std::string &key, const std::shared_ptr<const SlotChunk> &c) {
+        return key < c->front().first;
+      });
+  if (chunk == index_chunks.begin())
+    return nullptr;
+  const SlotChunk &entries = **(chunk - 1);
+  auto it = std::lower_bound(
+      entries.begin(), entries.end(), id,
+      [](const SlotEntry &entry, const std::string &key) {
+        return entry.first < key;
+      });
+  return it != entries.end() && it->first == id ? &*it : nullptr;
+}
+
+bool TimeCrystalSnapshot::contains_atom(const std::string &id) const {
+  return find_slot(id) != nullptr;
+}
+
+bool TimeCrystalSnapshot::get_atom(const std::string &id,
+                                   TimeCrystalAtom &out) const {
+  const SlotEntry *entry = find_slot(id);
+  if (!entry)
+    return false;
+  materialize(entry->second, out);
+  return true;
+}
+
+std::vector<std::string> TimeCrystalSnapshot::get_all_atom_ids() const {
+  std::vector<std::string> ids;
+  ids.reserve(atom_count());
+  for (const auto &chunk : index_chunks) {
+    for (const auto &[id, _] : *chunk) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+std::vector<std::string>
+TimeCrystalSnapshot::get_top_attention_atoms(size_t k) const {
+  std::vector<std::pair<const std::string *, float>> scored_atoms;
+  scored_atoms.reserve(atom_count());
+  for (const auto &chunk : index_chunks) {
+    for (const auto &[id, slot] : *chunk) {
+      scored_atoms.push_back({&id, attention[slot].sti});
+    }
+  }
+
+  std::sort(scored_atoms.begin(), scored_atoms.end(),
+            [](const auto &a, const auto &b) { return a.second > b.second; });
+
+  std::vector<std::string> result;
+  result.reserve(std::min(k, scored_atoms.size()));
+  for (size_t i = 0; i < std::min(k, scored_atoms.size()); i++) {
+    result.push_back(*scored_atoms[i].first);
+  }
+  return result;
+}
+
+void TimeCrystalSnapshot::for_each_atom(
+    const std::function<void(const TimeCrystalAtom &)> &fn) const {
+  TimeCrystalAtom atom;
+  for (const auto &chunk : index_chunks) {
+    for (const auto &[_, slot] : *chunk) {
+      materialize(slot, atom);
+      fn(atom);
+    }
+  }
+}
+
+size_t TimeCrystalSnapshot::inference_count() const {
+  return inferences ? inferences->size() : 0;
+}
+
+const TimeCrystalInference *
+TimeCrystalSnapshot::get_inference(const std::string &id) const {
+  if (!inferences)
+    return nullptr;
+  auto it = inferences->find(id);
+  return it != inferences->end() ? &it->second : nullptr;
+}
+
+std::vector<std::string> TimeCrystalSnapshot::get_all_inference_ids() const {
+  std::vector<std::string> ids;
+  if (!inferences)
+    return ids;
+  ids.reserve(inferences->size());
+  for (const auto &[id, _] : *inferences) {
+    ids.push_back(id);
+  }
+  return ids;
+}
+
 // ================================================================
 // Processing Cycle
 // ================================================================
@@ -998,78 +1656,46 @@ void TimeCrystalKernel::process_cycle() {
   if (!active)
     return;
 
+  NB_TRACE_SCOPE("time_crystal", "TimeCrystalKernel::process_cycle");
+
   // 1. Update time crystal quantum states
-  update_time_crystal_states();
+  {
+    NB_TRACE_SCOPE("time_crystal", "update_time_crystal_states");
+    update_time_crystal_states();
+  }
 
   // 2. Perform ECAN attention allocation with PPM weighting
-  perform_attention_allocation();
+  {
+    NB_TRACE_SCOPE("time_crystal", "perform_attention_allocation");
+    perform_attention_allocation();
+  }
 
   // 3. Execute PLN reasoning with fractal enhancement
-  perform_pln_reasoning();
+  {
+    NB_TRACE_SCOPE("time_crystal", "perform_pln_reasoning");
+    perform_pln_reasoning();
+  }
 
   // 4. Update geometric musical language resonances
-  update_gml_resonances();
+  {
+    NB_TRACE_SCOPE("time_crystal", "update_gml_resonances");
+    update_gml_resonances();
+  }
 
   cycle_count++;
-}
 
-// ================================================================
-// GML Shape Tensor Operations (Task 2.1)
-// ================================================================
+  if (config.publish_snapshots) {
+    publish_snapshot();
+  }
 
-int get_shape_complexity(GMLShape shape) {
-  // Complexity based on geometric properties
-  switch (shape) {
-  case GMLShape::Point:
-    return 1;
-  case GMLShape::Line:
-    return 2;
-  case GMLShape::Triangle:
-    return 3;
-  case GMLShape::Square:
-    return 4;
-  case GMLShape::Pentagon:
-    return 5;
-  case GMLShape::Hexagon:
-    return 6;
-  case GMLShape::Circle:
-    return 7;
-  case GMLShape::Tetrahedron:
-    return 8;
-  case GMLShape::Cube:
-    return 9;
-  case GMLShape::Octahedron:
-    return 10;
-  case GMLShape::Sphere:
-    return 11;
-  case GMLShape::Torus:
-    return 12;
-  case GMLShape::Helix:
-    return 13;
-  case GMLShape::Dodecahedron:
-    return 14;
-  case GMLShape::Icosahedron:
-    return 15;
-  case GMLShape::Mobius:
-    return 16;
-  case GMLShape::Simplex:
-    return 17;
-  case GMLShape::Hypercube:
-    return 18;
-  case GMLShape::Fractal:
-    return 19;
-  default:
-    return 1;
+  if (metrics_subscribers.load(std::memory_order_relaxed) > 0) {
+    publish_metrics();
   }
 }
 
-int get_shape_prime(GMLShape shape) {
-  // Map each shape to a prime number based on complexity
-  static const int primes[] = {2,  3,  5,  7,  11, 13, 17, 19, 23, 29,
-                               31, 37, 41, 43, 47, 53, 59, 61, 67};
-  int complexity = get_shape_complexity(shape);
-  return primes[std::min(complexity - 1, 18)];
-}
+// ================================================================
+// GML Shape Tensor Operations (Task 2.1)
+// ================================================================
 
 std::vector<float> shape_to_tensor(GMLShape shape,
                                    const ShapeTensorParams &params) {
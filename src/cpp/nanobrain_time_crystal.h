@@ -2,24 +2,27 @@
 #define NANOBRAIN_TIME_CRYSTAL_H
 
 #include "nanobrain_kernel.h"
+#include "nanobrain_prime_set.h"
+#include "nanobrain_symbol.h"
+#include "nanobrain_thread_pool.h"
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // Constants from NanoBrain Time Crystal Theory
 constexpr int TIME_CRYSTAL_DIMENSIONS = 11;
-constexpr int FUNDAMENTAL_PRIMES_COUNT = 15;
 constexpr double GOLDEN_RATIO = 1.618033988749895;
 constexpr double PI = 3.141592653589793;
 
-// Fundamental primes used in Phase Prime Metric calculations
-static const std::array<int, FUNDAMENTAL_PRIMES_COUNT> FUNDAMENTAL_PRIMES = {
-    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
-
 /**
  * Geometric Musical Language (GML) shape types
  */
@@ -71,7 +74,7 @@ struct GeometricPattern {
   int dimensions;
   std::string symmetry_group;
   MusicalNote musical_note;
-  std::vector<int> prime_resonance;
+  PrimeSet prime_resonance;
   float scale_factor;
 };
 
@@ -80,7 +83,7 @@ struct GeometricPattern {
  */
 struct TimeCrystalQuantumState {
   std::array<float, TIME_CRYSTAL_DIMENSIONS> dimensions;
-  std::vector<int> prime_signature;
+  PrimeSet prime_signature;
   float temporal_coherence;
   float fractal_dimension;
   float resonance_frequency;
@@ -110,14 +113,46 @@ struct AttentionValue {
  */
 struct TimeCrystalAtom {
   std::string id;
-  std::string type; // ConceptNode, PredicateNode, NumberNode, SchemaNode,
-                    // VariableNode
+  Symbol type; // ConceptNode, PredicateNode, NumberNode, SchemaNode,
+               // VariableNode
   std::string name;
   TruthValue truth_value;
   AttentionValue attention_value;
-  TimeCrystalQuantumState time_crystal_state;
-  std::vector<int> prime_encoding;
+  TimeCrystalQuantumState time_crystal_state; // Scalars copied from the
+                                              // kernel's state store by the
+                                              // writer after each change
+  PrimeSet prime_encoding;
   GeometricPattern fractal_geometry;
+  size_t crystal_slot = 0; // Index into TimeCrystalStateStore
+};
+
+/**
+ * Structure-of-arrays storage for the dynamic time crystal quantum state.
+ *
+ * Every atom owns exactly one slot (TimeCrystalAtom::crystal_slot). The
+ * per-cycle stepping kernel streams over these arrays instead of walking
+ * the AtomSpace map, so it vectorizes and splits cleanly across threads.
+ * Slots stay dense: removing an atom moves the last slot into the hole.
+ */
+struct TimeCrystalStateStore {
+  // Evolving state
+  std::vector<float> quantum_phase;
+  std::vector<float> temporal_coherence;
+  std::vector<float> fractal_dimension;
+  std::vector<float> resonance_frequency;
+
+  // Per-slot constants computed once at atom creation
+  std::vector<float> max_fractal_dimension; // geometry dimensions + 1
+  std::vector<float> regenerated_coherence; // PPM coherence of the primes
+  std::vector<float> base_resonance;        // Resonance of prime encoding
+
+  // GML membership bitset (bit i set when slot i holds a GML atom)
+  std::vector<uint64_t> gml_mask;
+
+  // Owning atom of each slot (std::map nodes are address-stable)
+  std::vector<TimeCrystalAtom *> owners;
+
+  size_t size() const { return quantum_phase.size(); }
 };
 
 /**
@@ -132,6 +167,8 @@ enum class InferenceRuleType {
   Abduction
 };
 
+constexpr size_t INFERENCE_RULE_COUNT = 6;
+
 /**
  * Time Crystal enhanced inference
  */
@@ -145,6 +182,46 @@ struct TimeCrystalInference {
   float quantum_coherence;
 };
 
+/**
+ * Id, type, name, rule and incoming-set indexes over a TimeCrystalKernel
+ * AtomSpace
+ *
+ * The kernel updates them as atoms and inference links are created and
+ * removed. Entries point at the kernel's map nodes, which never move. A
+ * link is in the incoming set of each premise and of its conclusion, keyed
+ * by atom id. Type and name are indexed at creation, so do not change
+ * them through get_mutable_atom. Sets are unordered, but hash entries by
+ * id rather than address: their order depends only on the ids and the
+ * order they were added, so it is the same on every run.
+ */
+struct AtomSpaceIndex {
+  using AtomEntry = std::pair<const std::string, TimeCrystalAtom>;
+  using LinkEntry = std::pair<const std::string, TimeCrystalInference>;
+
+  struct EntryIdHash {
+    template <typename Entry> size_t operator()(const Entry *entry) const {
+      return std::hash<std::string>()(entry->first);
+    }
+  };
+  using AtomSet = std::unordered_set<const AtomEntry *, EntryIdHash>;
+  using LinkSet = std::unordered_set<const LinkEntry *, EntryIdHash>;
+
+  std::unordered_map<std::string_view, const AtomEntry *> by_id; // Key views
+  std::unordered_map<Symbol, AtomSet> by_type;
+  std::unordered_map<std::string, AtomSet> by_name;
+  std::unordered_map<std::string, LinkSet> incoming;
+  std::array<LinkSet, INFERENCE_RULE_COUNT> by_rule;
+
+  // nullptr when nothing matches
+  const AtomEntry *find_atom(const std::string &atom_id) const;
+  const AtomSet *atoms_of_type(Symbol type) const;
+  const AtomSet *atoms_named(const std::string &name) const;
+  const LinkSet *incoming_set(const std::string &atom_id) const;
+  const LinkSet &links_of_rule(InferenceRuleType rule) const {
+    return by_rule[static_cast<size_t>(rule)];
+  }
+};
+
 /**
  * NanoBrain performance metrics
  */
@@ -160,11 +237,107 @@ struct NanoBrainMetrics {
   float consciousness_emergence;
 };
 
+/**
+ * Immutable, versioned view of a TimeCrystalKernel for concurrent readers.
+ *
+ * Published by the writer with TimeCrystalKernel::publish_snapshot() and
+ * pinned by readers with acquire_snapshot(). A pinned snapshot stays valid
+ * and unchanged while the writer keeps cycling; it is reclaimed when the
+ * last reader drops its reference.
+ *
+ * Atom records are stored in fixed-size pages (by state store slot) that
+ * consecutive versions share; a publish copies only pages whose records
+ * changed. The id -> slot index is split the same way into sorted chunks
+ * of ids, and a publish copies only the chunks whose ids were created,
+ * removed or moved to another slot. Attention values and the evolving
+ * quantum state, which every cycle rewrites, are captured as flat columns
+ * instead.
+ */
+class TimeCrystalSnapshot {
+public:
+  static constexpr size_t PAGE_SIZE = 256;        // Atom records per page
+  static constexpr size_t INDEX_CHUNK_SIZE = 256; // Index entries per chunk
+
+  // Publish sequence number (1 for the first snapshot)
+  uint64_t get_version() const { return version; }
+  size_t get_cycle_count() const { return cycle_count; }
+
+  // Atoms (the returned atom carries this version's attention and state)
+  size_t atom_count() const { return attention.size(); }
+  bool contains_atom(const std::string &id) const;
+  bool get_atom(const std::string &id, TimeCrystalAtom &out) const;
+  std::vector<std::string> get_all_atom_ids() const;
+  std::vector<std::string> get_top_attention_atoms(size_t k) const;
+
+  // Visit every atom in id order
+  void
+  for_each_atom(const std::function<void(const TimeCrystalAtom &)> &fn) const;
+
+  // Inferences
+  size_t inference_count() const;
+  const TimeCrystalInference *get_inference(const std::string &id) const;
+  std::vector<std::string> get_all_inference_ids() const;
+
+  // Metrics computed at publish time
+  const NanoBrainMetrics &get_metrics() const { return metrics; }
+
+private:
+  friend class TimeCrystalKernel;
+
+  using AtomPage = std::vector<TimeCrystalAtom>;
+  using SlotEntry = std::pair<std::string, size_t>;
+  using SlotChunk = std::vector<SlotEntry>; // Sorted by id
+  using InferenceTable = std::map<std::string, TimeCrystalInference>;
+
+  void materialize(size_t slot, TimeCrystalAtom &out) const;
+  const SlotEntry *find_slot(const std::string &id) const;
+
+  uint64_t version = 0;
+  size_t cycle_count = 0;
+
+  // Shared between versions
+  std::vector<std::shared_ptr<const AtomPage>> pages;
+  std::vector<std::shared_ptr<const SlotChunk>> index_chunks; // In id order
+  std::shared_ptr<const InferenceTable> inferences;
+
+  // Per-version columns, indexed by slot
+  std::vector<AttentionValue> attention;
+  std::vector<float> quantum_phase;
+  std::vector<float> temporal_coherence;
+  std::vector<float> fractal_dimension;
+  std::vector<float> resonance_frequency;
+
+  NanoBrainMetrics metrics{};
+};
+
+/**
+ * Cost and retention of the most recent snapshot publish
+ */
+struct TimeCrystalSnapshotStats {
+  uint64_t version = 0;      // Latest published version
+  size_t pages_total = 0;    // Atom record pages in the latest version
+  size_t pages_copied = 0;   // ... of which were rebuilt by the last publish
+  bool index_rebuilt = false;      // Index built from scratch
+  size_t index_chunks_copied = 0;  // Index chunks patched by the last publish
+  bool inferences_copied = false;
+  float publish_ms = 0.0f;
+  size_t pinned_versions = 0;       // Older versions still held by readers
+  uint64_t oldest_pinned_version = 0; // 0 when none are pinned
+};
+
 /**
  * OpenCog NanoBrain Time Crystal configuration
  */
 struct TimeCrystalConfig {
+  // ggml context size. Persistent tensors grow with the AtomSpace and with
+  // every cycle that allocates outside the scratch arena; watch
+  // NanoBrainKernel::get_memory_stats() (peak_bytes, allocation_rate) to
+  // size it for a workload.
   size_t memory_size = 1024 * 1024 * 128; // 128 MB
+  size_t scratch_memory_size = 0;         // Per-cycle scratch arena (0 = off)
+  MemoryBudgetPolicy memory_budget_policy = MemoryBudgetPolicy::Warn;
+  float memory_budget_fraction = 0.9f; // Soft limit as a fraction of capacity
+  MemoryProvisioning memory_provisioning; // Hugepages, pre-faulting, mlock
   int time_crystal_dimensions = TIME_CRYSTAL_DIMENSIONS;
   int fractal_resolution = 5;
   int geometric_shape_count = 15;
@@ -176,6 +349,12 @@ struct TimeCrystalConfig {
   float diffusion_strength = 0.1f;
   float rent_collection_rate = 0.01f;
   float wage_distribution_rate = 0.8f;
+  NanoBrainThreadPool *thread_pool = nullptr; // Stepping and tensor init
+                                              // (not owned; nullptr =
+                                              // serial)
+  size_t stepping_grain = 16384; // Minimum slots per stepping chunk
+  bool publish_snapshots = false; // Publish a reader snapshot every cycle
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED; // Atom state and tensor init
 };
 
 /**
@@ -201,14 +380,22 @@ public:
   void shutdown();
   bool is_active() const { return active; }
 
+  // Replace TimeCrystalConfig::thread_pool (nullptr = serial). The pool
+  // must outlive the kernel.
+  void set_thread_pool(NanoBrainThreadPool *pool) {
+    config.thread_pool = pool;
+    kernel->set_thread_pool(pool);
+  }
+
   // ================================================================
   // Atom Management
   // ================================================================
 
-  // Create a new Time Crystal Atom
-  std::string create_atom(const std::string &type, const std::string &name,
+  // Create a new Time Crystal Atom (the encoding keeps at most
+  // PRIME_SET_CAPACITY primes)
+  std::string create_atom(Symbol type, const std::string &name,
                           const TruthValue &tv, const AttentionValue &av,
-                          const std::vector<int> &prime_encoding,
+                          PrimeView prime_encoding,
                           const GeometricPattern &geometry);
 
   // Get atom by ID
@@ -217,24 +404,30 @@ public:
   // Get mutable atom by ID
   TimeCrystalAtom *get_mutable_atom(const std::string &id);
 
-  // Remove atom
+  // Remove an atom and every inference link that references it
   bool remove_atom(const std::string &id);
 
   // Get all atom IDs
   std::vector<std::string> get_all_atom_ids() const;
 
+  // Index lookups, in id order; cost is proportional to the result
+  std::vector<std::string> get_atoms_by_type(Symbol type) const;
+  std::vector<std::string> get_atoms_by_name(const std::string &name) const;
+  std::vector<std::string> get_incoming_set(const std::string &atom_id) const;
+  const AtomSpaceIndex &get_index() const { return atom_index; }
+
   // ================================================================
   // Phase Prime Metric (PPM) Functions
   // ================================================================
 
   // Calculate PPM coherence: 0.5 + 0.5 * sin(sqrt(prod) * PI / sum)
-  float compute_ppm_coherence(const std::vector<int> &primes);
+  float compute_ppm_coherence(PrimeView primes);
 
   // Calculate prime importance (smaller primes = more fundamental)
-  float calculate_prime_importance(const std::vector<int> &primes);
+  float calculate_prime_importance(PrimeView primes);
 
   // Calculate resonance frequency from prime encoding
-  float calculate_resonance_frequency(const std::vector<int> &primes);
+  float calculate_resonance_frequency(PrimeView primes);
 
   // Check if a number is in fundamental primes
   bool is_fundamental_prime(int prime) const;
@@ -256,6 +449,13 @@ public:
   const TimeCrystalQuantumState *
   get_time_crystal_state(const std::string &atom_id) const;
 
+  // Overwrite evolving state values for an atom
+  bool set_temporal_coherence(const std::string &atom_id, float coherence);
+  bool set_quantum_phase(const std::string &atom_id, float phase);
+
+  // Direct read access to the SoA state store
+  const TimeCrystalStateStore &get_state_store() const { return crystal_store; }
+
   // Calculate temporal flow direction between two states
   float calculate_temporal_flow(const TimeCrystalQuantumState &state1,
                                 const TimeCrystalQuantumState &state2);
@@ -265,11 +465,11 @@ public:
   // ================================================================
 
   // Calculate geometric resonance between two patterns
-  float calculate_geometric_resonance(const GeometricPattern &pattern1,
-                                      const GeometricPattern &pattern2);
+  static float calculate_geometric_resonance(const GeometricPattern &pattern1,
+                                             const GeometricPattern &pattern2);
 
   // Calculate musical harmony between two notes
-  float calculate_musical_harmony(MusicalNote note1, MusicalNote note2);
+  static float calculate_musical_harmony(MusicalNote note1, MusicalNote note2);
 
   // Generate prime geometry for a given prime number
   GeometricPattern generate_prime_geometry(int prime, int index);
@@ -315,9 +515,11 @@ public:
   // Get inference by ID
   const TimeCrystalInference *get_inference(const std::string &id) const;
 
+  // Remove an inference link (its conclusion atom stays)
+  bool remove_inference(const std::string &id);
+
   // Calculate prime consistency between two encodings
-  float calculate_prime_consistency(const std::vector<int> &primes1,
-                                    const std::vector<int> &primes2);
+  float calculate_prime_consistency(PrimeView primes1, PrimeView primes2);
 
   // ================================================================
   // Tensor Operations (via NanoBrainKernel)
@@ -354,6 +556,40 @@ public:
   // Get cycle count
   size_t get_cycle_count() const { return cycle_count; }
 
+  // Seed for counter-based random streams derived from this kernel
+  uint64_t get_seed() const { return config.seed; }
+
+  // ================================================================
+  // Snapshot Isolation
+  // ================================================================
+
+  // Capture the current state as a new immutable version. Call from the
+  // thread that mutates the kernel, between cycles.
+  std::shared_ptr<const TimeCrystalSnapshot> publish_snapshot();
+
+  // Latest published version (nullptr before the first publish). Safe to
+  // call from any thread while the writer is cycling.
+  std::shared_ptr<const TimeCrystalSnapshot> acquire_snapshot() const;
+
+  TimeCrystalSnapshotStats get_snapshot_stats() const;
+
+  // ================================================================
+  // Metrics Publishing
+  // ================================================================
+
+  // While at least one subscriber is registered, process_cycle() ends by
+  // publishing a fresh get_metrics() snapshot for readers on other threads
+  void subscribe_metrics() { metrics_subscribers++; }
+  void unsubscribe_metrics() { metrics_subscribers--; }
+
+  // Recompute and publish now (nullptr while inactive). Call from the
+  // thread that mutates the kernel, between cycles.
+  std::shared_ptr<const NanoBrainMetrics> publish_metrics();
+
+  // Latest published metrics (nullptr before the first publish or while
+  // inactive). Safe to call from any thread while the writer is cycling.
+  std::shared_ptr<const NanoBrainMetrics> acquire_metrics() const;
+
   // ================================================================
   // Processing Cycle
   // ================================================================
@@ -371,23 +607,85 @@ private:
   // AtomSpace
   std::map<std::string, TimeCrystalAtom> atom_space;
 
-  // Time crystal states
-  std::map<std::string, TimeCrystalQuantumState> time_crystals;
+  // Time crystal states, one SoA slot per atom
+  TimeCrystalStateStore crystal_store;
 
   // Inference links
   std::map<std::string, TimeCrystalInference> link_space;
 
+  // Type, name, rule and incoming-set indexes over both maps
+  AtomSpaceIndex atom_index;
+
   // State
   bool active = false;
   size_t cycle_count = 0;
   int64_t start_time = 0;
   int atom_counter = 0;
 
+  // Snapshot publishing (writer side). Records reach snapshots through
+  // pages marked dirty by create/remove/get_mutable_atom, index entries
+  // through the id -> slot changes queued since the last publish;
+  // attention and quantum state are re-read on every publish.
+  static constexpr size_t REMOVED_SLOT = SIZE_MAX;
+  std::shared_ptr<const TimeCrystalSnapshot> published_snapshot;
+  std::vector<std::shared_ptr<const TimeCrystalSnapshot::AtomPage>>
+      snapshot_pages;
+  std::vector<uint8_t> snapshot_page_dirty;
+  std::vector<std::shared_ptr<const TimeCrystalSnapshot::SlotChunk>>
+      snapshot_index; // In id order
+  std::map<std::string, size_t> snapshot_index_updates; // REMOVED_SLOT
+  std::shared_ptr<const TimeCrystalSnapshot::InferenceTable>
+      snapshot_inferences;
+  bool snapshot_index_built = false; // Updates are queued only once built
+  bool snapshot_inferences_dirty = true;
+  uint64_t snapshot_version = 0;
+  TimeCrystalSnapshotStats snapshot_stats;
+  std::vector<std::weak_ptr<const TimeCrystalSnapshot>> retired_snapshots;
+
+  // Metrics publishing (see subscribe_metrics)
+  std::atomic<int> metrics_subscribers{0};
+  std::shared_ptr<const NanoBrainMetrics> published_metrics;
+
+  // Per-cycle scratch reused so attention and reasoning do not allocate.
+  // Atom pointers are safe to hold within a cycle: std::map nodes do not
+  // move when other atoms are inserted.
+  struct AtomScore {
+    TimeCrystalAtom *atom;
+    float score;
+  };
+  struct RankedAtom { // Read-only ranking for queries and reasoning
+    const TimeCrystalAtom *atom;
+    float score;
+  };
+  std::vector<AtomScore> atom_scores;
+  std::vector<RankedAtom> top_atoms;
+  std::string link_id_buffer;
+
   // Private helper methods
   void initialize_fundamental_atoms();
   void initialize_gml_atoms();
   std::string generate_atom_id();
   int64_t current_time_millis() const;
+  size_t allocate_crystal_slot(TimeCrystalAtom &atom,
+                               const TimeCrystalQuantumState &state);
+  void release_crystal_slot(size_t slot);
+  TimeCrystalAtom *find_atom(const std::string &id);
+  void index_atom(const AtomSpaceIndex::AtomEntry &entry);
+  void unindex_atom(const AtomSpaceIndex::AtomEntry &entry);
+  void index_link(const AtomSpaceIndex::LinkEntry &entry);
+  void unindex_link(const AtomSpaceIndex::LinkEntry &entry);
+  void mark_snapshot_slot(size_t slot);
+  using SlotChunk = TimeCrystalSnapshot::SlotChunk;
+  using SlotChunks = std::vector<std::shared_ptr<const SlotChunk>>;
+  void queue_index_update(const std::string &id, size_t slot);
+  void build_snapshot_index();
+  size_t patch_snapshot_index();
+  static void append_index_chunks(SlotChunks &chunks, SlotChunk &&entries);
+  void select_top_attention(size_t k,
+                            std::vector<RankedAtom> &scored_atoms) const;
+  const std::string &create_inference_link(const TimeCrystalAtom &atom1,
+                                           const TimeCrystalAtom &atom2,
+                                           InferenceRuleType rule);
 };
 
 // ================================================================
@@ -409,19 +707,49 @@ MusicalNote index_to_musical_note(int index);
 // Get shape name for index
 GMLShape index_to_gml_shape(int index);
 
+// Map an atom type from untrusted input (wire frames, files, query text)
+// to its Symbol without growing the symbol table: the standard Atomese
+// types and types already in use by this process are known, anything else
+// returns false
+bool lookup_atom_type(const std::string &text, Symbol &type);
+
+// Advance slots [begin, end) of a state store by one cycle. Branch-free so
+// the loop auto-vectorizes; ranges are independent and safe to run in
+// parallel.
+void step_time_crystal_range(TimeCrystalStateStore &store, size_t begin,
+                             size_t end, float phase_step,
+                             float coherence_threshold);
+
 // ================================================================
 // GML Shape Tensor Operations (Task 2.1)
 // ================================================================
 
+// Complexity level (1-19) of each GMLShape, in enum order
+constexpr std::array<int, 19> GML_SHAPE_COMPLEXITY = {
+    11, 12, 13, 19, 18, 17, // Sphere .. Simplex
+    1,  2,  3,  4,  5,  6,  // Point .. Hexagon
+    7,  8,  9,  10, 14, 15, // Circle .. Icosahedron
+    16};                    // Mobius
+
+// Prime of each complexity level
+constexpr std::array<int, 19> GML_COMPLEXITY_PRIMES = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67};
+
 /**
  * Shape complexity level (determines tensor dimensions)
  */
-int get_shape_complexity(GMLShape shape);
+constexpr int get_shape_complexity(GMLShape shape) {
+  size_t index = static_cast<size_t>(shape);
+  return index < GML_SHAPE_COMPLEXITY.size() ? GML_SHAPE_COMPLEXITY[index]
+                                             : 1;
+}
 
 /**
  * Get prime number associated with shape
  */
-int get_shape_prime(GMLShape shape);
+constexpr int get_shape_prime(GMLShape shape) {
+  return GML_COMPLEXITY_PRIMES[get_shape_complexity(shape) - 1];
+}
 
 /**
  * Shape-to-tensor conversion parameters
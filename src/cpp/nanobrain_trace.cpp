@@ -0,0 +1,187 @@
+#include "nanobrain_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+// ================================================================
+// Helpers
+// ================================================================
+
+namespace {
+
+int64_t steady_now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void write_json_string(std::ostream &out, const char *s) {
+  out << '"';
+  for (; s && *s; ++s) {
+    switch (*s) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    case '\n':
+      out << "\\n";
+      break;
+    default:
+      out << *s;
+    }
+  }
+  out << '"';
+}
+
+} // namespace
+
+// ================================================================
+// TraceRecorder Implementation
+// ================================================================
+
+TraceRecorder &TraceRecorder::instance() {
+  static TraceRecorder recorder;
+  return recorder;
+}
+
+TraceRecorder::TraceRecorder() : epoch_ns(steady_now_ns()) {}
+
+void TraceRecorder::set_events_per_thread(size_t capacity) {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  events_per_thread = std::max<size_t>(capacity, 1);
+}
+
+uint64_t TraceRecorder::now_ns() const {
+  return static_cast<uint64_t>(steady_now_ns() - epoch_ns);
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::local_buffer() {
+  // The registry keeps a reference, so spans from exited threads survive
+  // until clear() releases their buffers
+  thread_local std::shared_ptr<ThreadBuffer> buffer;
+  if (!buffer) {
+    buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    buffer->thread_id = ++last_thread_id;
+    buffer->events.resize(events_per_thread);
+    buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+void TraceRecorder::set_thread_name(const std::string &name) {
+  ThreadBuffer &buffer = local_buffer();
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  buffer.thread_name = name;
+}
+
+void TraceRecorder::record(const char *name, const char *category,
+                           uint64_t start_ns, uint64_t end_ns) {
+  ThreadBuffer &buffer = local_buffer();
+  uint64_t n = buffer.written.load(std::memory_order_relaxed);
+
+  TraceEvent &event = buffer.events[n % buffer.events.size()];
+  event.name = name;
+  event.category = category;
+  event.start_ns = start_ns;
+  event.duration_ns = end_ns > start_ns ? end_ns - start_ns : 0;
+  event.thread_id = buffer.thread_id;
+
+  buffer.written.store(n + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceRecorder::collect() const {
+  std::vector<TraceEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const auto &buffer : buffers) {
+      uint64_t written = buffer->written.load(std::memory_order_acquire);
+      size_t capacity = buffer->events.size();
+      size_t count = static_cast<size_t>(std::min<uint64_t>(written, capacity));
+      for (uint64_t i = written - count; i < written; i++) {
+        events.push_back(buffer->events[i % capacity]);
+      }
+    }
+  }
+
+  std::stable_sort(events.begin(), events.end(),
+                   [](const TraceEvent &a, const TraceEvent &b) {
+                     return a.start_ns < b.start_ns;
+                   });
+  return events;
+}
+
+size_t TraceRecorder::dropped_events() const {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  size_t dropped = 0;
+  for (const auto &buffer : buffers) {
+    uint64_t written = buffer->written.load(std::memory_order_acquire);
+    if (written > buffer->events.size()) {
+      dropped += static_cast<size_t>(written - buffer->events.size());
+    }
+  }
+  return dropped;
+}
+
+void TraceRecorder::clear() {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  // Only the registry still holds the buffer of an exited thread: free it.
+  // Live threads keep writing to theirs, so those are just emptied.
+  buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                               [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                                 return buffer.use_count() == 1;
+                               }),
+                buffers.end());
+  for (auto &buffer : buffers) {
+    buffer->written.store(0, std::memory_order_release);
+  }
+}
+
+void TraceRecorder::write_chrome_trace(std::ostream &out) const {
+  std::vector<TraceEvent> events = collect();
+
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+
+  bool first = true;
+  {
+    // Thread name metadata
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const auto &buffer : buffers) {
+      if (buffer->thread_name.empty())
+        continue;
+      out << (first ? "" : ",\n")
+          << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+             "\"tid\": "
+          << buffer->thread_id << ", \"args\": {\"name\": ";
+      write_json_string(out, buffer->thread_name.c_str());
+      out << "}}";
+      first = false;
+    }
+  }
+
+  // Complete events; timestamps are microseconds
+  out << std::fixed << std::setprecision(3);
+  for (const auto &event : events) {
+    out << (first ? "" : ",\n") << "{\"name\": ";
+    write_json_string(out, event.name);
+    out << ", \"cat\": ";
+    write_json_string(out, event.category);
+    out << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread_id
+        << ", \"ts\": " << event.start_ns / 1000.0
+        << ", \"dur\": " << event.duration_ns / 1000.0 << "}";
+    first = false;
+  }
+
+  out << "\n]}\n";
+}
+
+bool TraceRecorder::write_chrome_trace(const std::string &filepath) const {
+  std::ofstream out(filepath);
+  if (!out)
+    return false;
+  write_chrome_trace(out);
+  return static_cast<bool>(out);
+}
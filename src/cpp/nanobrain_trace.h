@@ -0,0 +1,148 @@
+#ifndef NANOBRAIN_TRACE_H
+#define NANOBRAIN_TRACE_H
+
+/**
+ * NanoBrain Cycle Tracing
+ *
+ * Scoped spans recorded into per-thread ring buffers and exported as Chrome
+ * trace-event JSON, viewable in chrome://tracing or ui.perfetto.dev.
+ *
+ * Spans are compiled in only when NANOBRAIN_TRACING is defined (CMake option
+ * NANOBRAIN_ENABLE_TRACING); otherwise the NB_TRACE_* macros expand to
+ * nothing. A traced build additionally gates recording at runtime through
+ * TraceRecorder::set_enabled(), so an idle span costs one relaxed load.
+ *
+ * Span names and categories must be string literals (or otherwise outlive
+ * the recorder): only the pointers are stored.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * One completed span
+ */
+struct TraceEvent {
+  const char *name = nullptr;
+  const char *category = nullptr;
+  uint64_t start_ns = 0; // Relative to the recorder epoch
+  uint64_t duration_ns = 0;
+  uint32_t thread_id = 0;
+};
+
+/**
+ * Trace Recorder
+ *
+ * Process-wide sink for spans. Each thread writes to its own fixed-size
+ * ring buffer without locking; the oldest events are overwritten once a
+ * buffer is full. Export while traced threads are quiescent (e.g. between
+ * cycles) for a consistent snapshot.
+ */
+class TraceRecorder {
+public:
+  static TraceRecorder &instance();
+
+  // Runtime switch (spans are dropped while disabled)
+  void set_enabled(bool on) { enabled.store(on, std::memory_order_relaxed); }
+  bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+
+  // Ring capacity for buffers created after this call
+  void set_events_per_thread(size_t capacity);
+
+  // Label the calling thread in exported traces
+  void set_thread_name(const std::string &name);
+
+  // Append a span for the calling thread
+  void record(const char *name, const char *category, uint64_t start_ns,
+              uint64_t end_ns);
+
+  // Monotonic nanoseconds since the recorder was created
+  uint64_t now_ns() const;
+
+  // All buffered spans from every thread, ordered by start time
+  std::vector<TraceEvent> collect() const;
+
+  // Spans lost to ring buffer wrap-around
+  size_t dropped_events() const;
+
+  // Discard all buffered spans, and free the buffers of exited threads
+  void clear();
+
+  // Export in Chrome trace-event format
+  void write_chrome_trace(std::ostream &out) const;
+  bool write_chrome_trace(const std::string &filepath) const;
+
+private:
+  TraceRecorder();
+
+  struct ThreadBuffer {
+    uint32_t thread_id = 0;
+    std::string thread_name;
+    std::vector<TraceEvent> events;
+    std::atomic<uint64_t> written{0};
+  };
+
+  ThreadBuffer &local_buffer();
+
+  std::atomic<bool> enabled{false};
+  size_t events_per_thread = 1 << 16;
+  int64_t epoch_ns = 0;
+
+  mutable std::mutex registry_mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  uint32_t last_thread_id = 0;
+};
+
+/**
+ * RAII span: records [construction, destruction) if tracing is enabled
+ */
+class TraceScope {
+public:
+  TraceScope(const char *category, const char *name)
+      : name(name), category(category),
+        active(TraceRecorder::instance().is_enabled()) {
+    if (active)
+      start_ns = TraceRecorder::instance().now_ns();
+  }
+
+  ~TraceScope() {
+    if (active) {
+      auto &recorder = TraceRecorder::instance();
+      recorder.record(name, category, start_ns, recorder.now_ns());
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+  const char *name;
+  const char *category;
+  bool active;
+  uint64_t start_ns = 0;
+};
+
+// ================================================================
+// Instrumentation Macros
+// ================================================================
+
+#define NB_TRACE_CONCAT_IMPL(a, b) a##b
+#define NB_TRACE_CONCAT(a, b) NB_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef NANOBRAIN_TRACING
+#define NB_TRACE_SCOPE(category, name)                                         \
+  TraceScope NB_TRACE_CONCAT(nb_trace_scope_, __LINE__)(category, name)
+#define NB_TRACE_THREAD_NAME(name)                                             \
+  TraceRecorder::instance().set_thread_name(name)
+#else
+#define NB_TRACE_SCOPE(category, name) ((void)0)
+#define NB_TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // NANOBRAIN_TRACE_H
@@ -34,6 +34,14 @@ void UnifiedNanoBrainKernel::initialize() {
   std::cout << " llama.cpp/ggml Adaptation" << std::endl;
   std::cout << "========================================" << std::endl;
 
+  // 0. Start the shared worker pool
+  ThreadPoolConfig pool_config;
+  pool_config.threads = config.worker_threads;
+  pool_config.pin_threads = config.pin_worker_threads;
+  pool_config.numa_policy = config.numa_policy;
+  pool_config.scratch_size = config.worker_scratch_size;
+  thread_pool = std::make_unique<NanoBrainThreadPool>(pool_config);
+
   // 1. Initialize Time Crystal Kernel (includes base NanoBrainKernel)
   TimeCrystalConfig tc_config;
   tc_config.memory_size = config.memory_size;
@@ -41,13 +49,21 @@ void UnifiedNanoBrainKernel::initialize() {
   tc_config.fractal_resolution = config.fractal_resolution;
   tc_config.quantum_coherence_threshold = config.quantum_coherence_threshold;
   tc_config.resource_budget = config.resource_budget;
+  tc_config.scratch_memory_size = config.scratch_memory_size;
+  tc_config.memory_budget_policy = config.memory_budget_policy;
+  tc_config.memory_budget_fraction = config.memory_budget_fraction;
+  tc_config.memory_provisioning = config.memory_provisioning;
+  tc_config.thread_pool = thread_pool.get();
 
   time_crystal_kernel = std::make_unique<TimeCrystalKernel>(tc_config);
-  time_crystal_kernel->initialize();
+  NanoBrainKernel *tensors = time_crystal_kernel->get_tensor_kernel();
+  {
+    AllocationTagScope tag(tensors, "time_crystal");
+    time_crystal_kernel->initialize();
+  }
 
   // 2. Initialize Tensor Encoder
-  encoder = std::make_unique<AtomSpaceTensorEncoder>(
-      time_crystal_kernel->get_tensor_kernel());
+  encoder = std::make_unique<AtomSpaceTensorEncoder>(tensors);
 
   // 3. Initialize Reasoning Engine
   ReasoningEngineConfig re_config;
@@ -55,9 +71,12 @@ void UnifiedNanoBrainKernel::initialize() {
   re_config.confidence_threshold = config.confidence_threshold;
   re_config.parallel_chains = config.parallel_chains;
 
-  reasoning_engine = std::make_unique<RecursiveReasoningEngine>(
-      time_crystal_kernel->get_tensor_kernel(), re_config);
-  reasoning_engine->initialize();
+  reasoning_engine =
+      std::make_unique<RecursiveReasoningEngine>(tensors, re_config);
+  {
+    AllocationTagScope tag(tensors, "reasoning");
+    reasoning_engine->initialize();
+  }
 
   // 4. Initialize Attention Allocation Engine
   AttentionAllocationConfig aa_config;
@@ -65,9 +84,12 @@ void UnifiedNanoBrainKernel::initialize() {
   aa_config.temperature = config.attention_temperature;
   aa_config.resource_budget = config.resource_budget;
 
-  attention_engine = std::make_unique<AttentionAllocationEngine>(
-      time_crystal_kernel->get_tensor_kernel(), aa_config);
-  attention_engine->initialize(1000); // Max 1000 nodes
+  attention_engine =
+      std::make_unique<AttentionAllocationEngine>(tensors, aa_config);
+  {
+    AllocationTagScope tag(tensors, "attention");
+    attention_engine->initialize(1000); // Max 1000 nodes
+  }
 
   // 5. Initialize Meta-Cognitive Feedback Engine
   MetaCognitiveConfig mc_config;
@@ -76,9 +98,11 @@ void UnifiedNanoBrainKernel::initialize() {
   mc_config.feedback_damping = config.feedback_damping;
 
   metacognitive_engine = std::make_unique<MetaCognitiveFeedbackEngine>(
-      time_crystal_kernel->get_tensor_kernel(), attention_engine.get(),
-      reasoning_engine.get(), mc_config);
-  metacognitive_engine->initialize();
+      tensors, attention_engine.get(), reasoning_engine.get(), mc_config);
+  {
+    AllocationTagScope tag(tensors, "metacognition");
+    metacognitive_engine->initialize();
+  }
 
   active = true;
 
@@ -96,6 +120,9 @@ void UnifiedNanoBrainKernel::initialize() {
             << " mechanism" << std::endl;
   std::cout << "  - Meta-cognitive: " << config.meta_levels << " levels"
             << std::endl;
+  std::cout << "  - Workers: " << thread_pool->get_thread_count()
+            << " threads on " << thread_pool->get_numa_node_count()
+            << " NUMA node(s)" << std::endl;
 }
 
 void UnifiedNanoBrainKernel::shutdown() {
@@ -112,17 +139,11 @@ void UnifiedNanoBrainKernel::shutdown() {
   reasoning_engine.reset();
   encoder.reset();
   time_crystal_kernel.reset();
+  thread_pool.reset();
 
-  // Clear tensor caches
-  for (auto *node : node_tensors) {
-    delete node;
-  }
+  // Clear tensor caches (node tensors are owned by the encoder's cache)
   node_tensors.clear();
-
-  for (auto *link : link_tensors) {
-    delete link;
-  }
-  link_tensors.clear();
+  release_link_tensors();
 
   active = false;
 }
@@ -136,30 +157,85 @@ UnifiedNanoBrainMetrics UnifiedNanoBrainKernel::process_cycle() {
     return UnifiedNanoBrainMetrics{};
   }
 
+  NB_TRACE_SCOPE("unified", "UnifiedNanoBrainKernel::process_cycle");
+
+  using clock = std::chrono::steady_clock;
+  const auto cycle_start = clock::now();
+  auto stage_start = cycle_start;
+  auto lap_ms = [&stage_start]() {
+    auto now = clock::now();
+    float ms =
+        std::chrono::duration<float, std::milli>(now - stage_start).count();
+    stage_start = now;
+    return ms;
+  };
+
+  // Link tensors may live in the scratch arena, so drop them before the
+  // cycle boundary gets a chance to reset it
+  NanoBrainKernel *tensors = time_crystal_kernel->get_tensor_kernel();
+  release_link_tensors();
+  tensors->begin_cycle();
+
   // 1. Sync tensors from AtomSpace
-  sync_tensors();
+  {
+    NB_TRACE_SCOPE("unified", "sync_tensors");
+    AllocationTagScope tag(tensors, "sync_tensors");
+    sync_tensors();
+  }
+  last_stage_timings.sync_tensors_ms = lap_ms();
 
   // 2. Time Crystal update
-  time_crystal_kernel->process_cycle();
+  {
+    AllocationTagScope tag(tensors, "time_crystal");
+    time_crystal_kernel->process_cycle();
+  }
+  last_stage_timings.time_crystal_ms = lap_ms();
 
   // 3. Attention update
-  AttentionStats att_stats =
-      attention_engine->update_attention_allocation(node_tensors, link_tensors);
+  AttentionStats att_stats;
+  {
+    AllocationTagScope tag(tensors, "attention");
+    att_stats = attention_engine->update_attention_allocation(node_tensors,
+                                                              link_tensors);
+  }
+  last_stage_timings.attention_ms = lap_ms();
 
   // 4. Reasoning step
-  ReasoningStats reas_stats =
-      reasoning_engine->execute_reasoning_step(node_tensors, link_tensors);
+  ReasoningStats reas_stats;
+  {
+    AllocationTagScope tag(tensors, "reasoning");
+    reas_stats =
+        reasoning_engine->execute_reasoning_step(node_tensors, link_tensors);
+  }
+  last_stage_timings.reasoning_ms = lap_ms();
 
   // 5. Meta-cognitive update
-  MetaCognitiveMetrics meta_metrics =
-      metacognitive_engine->update_meta_cognitive(node_tensors, link_tensors,
-                                                  att_stats, reas_stats);
+  {
+    AllocationTagScope tag(tensors, "metacognition");
+    metacognitive_engine->update_meta_cognitive(node_tensors, link_tensors,
+                                                att_stats, reas_stats);
+  }
+  last_stage_timings.metacognition_ms = lap_ms();
+
+  last_stage_timings.total_ms =
+      std::chrono::duration<float, std::milli>(stage_start - cycle_start)
+          .count();
 
   cycle_count++;
 
+  // Published after every stage so readers see the whole cycle's updates
+  if (config.publish_snapshots) {
+    time_crystal_kernel->publish_snapshot();
+  }
+
   return get_metrics();
 }
 
+std::shared_ptr<const TimeCrystalSnapshot>
+UnifiedNanoBrainKernel::acquire_snapshot() const {
+  return time_crystal_kernel->acquire_snapshot();
+}
+
 UnifiedNanoBrainMetrics UnifiedNanoBrainKernel::run_cycles(int n) {
   UnifiedNanoBrainMetrics metrics;
   for (int i = 0; i < n; i++) {
@@ -174,10 +250,7 @@ void UnifiedNanoBrainKernel::sync_tensors() {
 }
 
 void UnifiedNanoBrainKernel::build_node_tensors() {
-  // Clear old tensors
-  for (auto *node : node_tensors) {
-    delete node;
-  }
+  // Node tensors are owned and cached by the encoder, so only drop our view
   node_tensors.clear();
 
   // Build new tensors from AtomSpace
@@ -206,12 +279,20 @@ void UnifiedNanoBrainKernel::build_node_tensors() {
   }
 }
 
-void UnifiedNanoBrainKernel::build_link_tensors() {
-  // Clear old link tensors
+void UnifiedNanoBrainKernel::release_link_tensors() {
   for (auto *link : link_tensors) {
     delete link;
   }
   link_tensors.clear();
+}
+
+void UnifiedNanoBrainKernel::build_link_tensors() {
+  release_link_tensors();
+
+  // Link tensors are rebuilt every cycle, so they use the scratch arena
+  // when one is configured
+  NanoBrainKernel *tensors = time_crystal_kernel->get_tensor_kernel();
+  ScratchScope scratch(tensors);
 
   // Build link tensors from inference links
   auto inference_ids = time_crystal_kernel->get_all_inference_ids();
@@ -225,18 +306,16 @@ void UnifiedNanoBrainKernel::build_link_tensors() {
     link_tensor->atom_id = inference->conclusion_id;
     link_tensor->source_nodes = inference->premise_ids;
     link_tensor->target_nodes = {inference->conclusion_id};
+    // Nothing reads the relation or attention placeholders yet, so they
+    // skip the Xavier fill
     link_tensor->relation_tensor =
-        time_crystal_kernel->get_tensor_kernel()->create_tensor({32});
+        tensors->create_tensor({32}, TensorInitPolicy::zero());
     link_tensor->attention_weights =
-        time_crystal_kernel->get_tensor_kernel()->create_tensor({1});
-    link_tensor->truth_value_tensor =
-        time_crystal_kernel->get_tensor_kernel()->create_tensor({3});
+        tensors->create_tensor({1}, TensorInitPolicy::zero());
 
     // Set truth value based on inference quality
-    std::vector<float> tv_data = {inference->fractal_convergence,
-                                  inference->quantum_coherence, 1.0f};
-    time_crystal_kernel->get_tensor_kernel()->set_data(
-        link_tensor->truth_value_tensor, tv_data);
+    link_tensor->truth_value_tensor = tensors->create_tensor_from(
+        {inference->fractal_convergence, inference->quantum_coherence, 1.0f});
 
     link_tensors.push_back(link_tensor);
   }
@@ -394,6 +473,11 @@ UnifiedNanoBrainMetrics UnifiedNanoBrainKernel::get_metrics() const {
     metrics.resource_utilization = att_stats.resource_utilization;
   }
 
+  // Cycle stage timings, memory accounting and worker utilization
+  metrics.stage_timings = last_stage_timings;
+  metrics.memory = time_crystal_kernel->get_tensor_kernel()->get_memory_stats();
+  metrics.thread_pool = thread_pool->get_stats();
+
   // Meta-cognitive metrics
   if (metacognitive_engine) {
     auto meta_tensors = metacognitive_engine->get_meta_tensors();
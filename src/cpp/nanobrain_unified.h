@@ -13,6 +13,7 @@
  * - AttentionAllocationEngine: Softmax/ECAN attention mechanisms
  * - MetaCognitiveFeedbackEngine: Self-monitoring and adaptation
  * - AtomSpaceTensorEncoder: AtomSpace to tensor conversion
+ * - NanoBrainThreadPool: Shared work-stealing workers for all engines
  */
 
 #include "nanobrain_attention.h"
@@ -20,7 +21,9 @@
 #include "nanobrain_kernel.h"
 #include "nanobrain_metacognitive.h"
 #include "nanobrain_reasoning.h"
+#include "nanobrain_thread_pool.h"
 #include "nanobrain_time_crystal.h"
+#include "nanobrain_trace.h"
 #include "nanobrain_types.h"
 
 #include <memory>
@@ -35,10 +38,17 @@ struct UnifiedNanoBrainConfig {
   size_t memory_size = 1024 * 1024 * 128; // 128 MB
   bool use_gpu = false;
 
+  // Memory budget (see NanoBrainConfig)
+  size_t scratch_memory_size = 0; // Per-cycle link tensors go here when set
+  MemoryBudgetPolicy memory_budget_policy = MemoryBudgetPolicy::Warn;
+  float memory_budget_fraction = 0.9f;
+  MemoryProvisioning memory_provisioning; // Backing for the ggml context
+
   // Time Crystal settings
   int time_crystal_dimensions = 11;
   int fractal_resolution = 5;
   float quantum_coherence_threshold = 0.5f;
+  bool publish_snapshots = false; // Publish a reader snapshot every cycle
 
   // Reasoning settings
   int max_reasoning_depth = 5;
@@ -54,6 +64,24 @@ struct UnifiedNanoBrainConfig {
   int meta_levels = 3;
   float adaptation_learning_rate = 0.01f;
   float feedback_damping = 0.9f;
+
+  // Shared worker pool (see ThreadPoolConfig)
+  int worker_threads = 0; // Including the caller (0 = hardware)
+  bool pin_worker_threads = false;
+  NumaPolicy numa_policy = NumaPolicy::None;
+  size_t worker_scratch_size = 1u << 20; // Scratch arena bytes per worker
+};
+
+/**
+ * Wall-clock time spent in each process_cycle() stage (milliseconds)
+ */
+struct CycleStageTimings {
+  float sync_tensors_ms = 0.0f;
+  float time_crystal_ms = 0.0f;
+  float attention_ms = 0.0f;
+  float reasoning_ms = 0.0f;
+  float metacognition_ms = 0.0f;
+  float total_ms = 0.0f;
 };
 
 /**
@@ -91,6 +119,15 @@ struct UnifiedNanoBrainMetrics {
   float consciousness_upload_ready;
   float dimensional_coherence;
   float evolution_fitness;
+
+  // Stage timings of the most recent cycle
+  CycleStageTimings stage_timings;
+
+  // ggml memory accounting
+  MemoryStats memory;
+
+  // Shared worker pool utilization
+  ThreadPoolStats thread_pool;
 };
 
 /**
@@ -127,6 +164,9 @@ public:
   // Run N cycles
   UnifiedNanoBrainMetrics run_cycles(int n);
 
+  // Latest AtomSpace snapshot (see TimeCrystalKernel::acquire_snapshot)
+  std::shared_ptr<const TimeCrystalSnapshot> acquire_snapshot() const;
+
   // ================================================================
   // Atom Management
   // ================================================================
@@ -218,6 +258,10 @@ public:
   // Get tensor encoder
   AtomSpaceTensorEncoder *get_encoder() { return encoder.get(); }
 
+  // Get the shared worker pool; hand it to other engines through their
+  // configs' thread_pool field. Valid until shutdown().
+  NanoBrainThreadPool *get_thread_pool() { return thread_pool.get(); }
+
   // Get configuration
   const UnifiedNanoBrainConfig &get_config() const { return config; }
 
@@ -225,6 +269,7 @@ private:
   UnifiedNanoBrainConfig config;
 
   // Subsystems
+  std::unique_ptr<NanoBrainThreadPool> thread_pool;
   std::unique_ptr<TimeCrystalKernel> time_crystal_kernel;
   std::unique_ptr<RecursiveReasoningEngine> reasoning_engine;
   std::unique_ptr<AttentionAllocationEngine> attention_engine;
@@ -239,11 +284,13 @@ private:
   bool active = false;
   size_t cycle_count = 0;
   int64_t start_time = 0;
+  CycleStageTimings last_stage_timings;
 
   // Private helpers
   void sync_tensors();
   void build_node_tensors();
   void build_link_tensors();
+  void release_link_tensors();
   int64_t current_time_millis() const;
 };
 
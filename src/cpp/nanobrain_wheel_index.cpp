@@ -0,0 +1,427 @@
+#include "nanobrain_wheel_index.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+constexpr uint32_t WHEEL_INDEX_MAGIC = 0x4957424E; // "NBWI"
+constexpr uint32_t WHEEL_INDEX_VERSION = 1;
+
+// Points whose distances are computed together, one dimension at a time
+constexpr size_t SCAN_BLOCK = 64;
+
+// Squared distances from query to points [begin, end), handed to
+// visit(position, distance_sq)
+template <typename Visit>
+void scan_points(const LinguisticWheelSet &points, size_t begin, size_t end,
+                 const WheelIndex::Vector &query, Visit visit) {
+  float dist[SCAN_BLOCK];
+  for (size_t block = begin; block < end; block += SCAN_BLOCK) {
+    size_t count = std::min(SCAN_BLOCK, end - block);
+    std::fill(dist, dist + count, 0.0f);
+    for (int d = 0; d < LinguisticWheelSet::DIMENSIONS; d++) {
+      const float *column = points.columns[d].data() + block;
+      float q = query[d];
+      for (size_t i = 0; i < count; i++) {
+        float delta = column[i] - q;
+        dist[i] += delta * delta;
+      }
+    }
+    for (size_t i = 0; i < count; i++) {
+      visit(block + i, dist[i]);
+    }
+  }
+}
+
+} // namespace
+
+// A point being sorted into tree order
+struct WheelIndex::BuildEntry {
+  Vector v;
+  uint32_t id;
+};
+
+// ================================================================
+// WheelIndex Implementation
+// ================================================================
+
+WheelIndex::WheelIndex(const WheelIndexConfig &config) : config(config) {
+  this->config.leaf_size = std::max<size_t>(1, config.leaf_size);
+}
+
+bool WheelIndex::build(std::vector<std::string> names,
+                       const LinguisticWheelSet &wheels) {
+  if (names.size() != wheels.size())
+    return false;
+
+  this->names = std::move(names);
+  points = wheels;
+  ids.resize(points.size());
+  std::iota(ids.begin(), ids.end(), 0u);
+  positions = ids;
+  nodes.clear();
+  indexed_count = 0;
+  rebuild();
+  return true;
+}
+
+uint32_t WheelIndex::insert(const std::string &name, const Vector &vector) {
+  uint32_t id = static_cast<uint32_t>(names.size());
+  names.push_back(name);
+  for (int d = 0; d < DIMENSIONS; d++) {
+    points.columns[d].push_back(vector[d]);
+  }
+  positions.push_back(static_cast<uint32_t>(ids.size()));
+  ids.push_back(id);
+  maybe_rebuild();
+  return id;
+}
+
+bool WheelIndex::insert(const std::vector<std::string> &names,
+                        const LinguisticWheelSet &wheels) {
+  if (names.size() != wheels.size())
+    return false;
+
+  uint32_t first_id = static_cast<uint32_t>(this->names.size());
+  this->names.insert(this->names.end(), names.begin(), names.end());
+  for (int d = 0; d < DIMENSIONS; d++) {
+    points.columns[d].insert(points.columns[d].end(),
+                             wheels.columns[d].begin(),
+                             wheels.columns[d].end());
+  }
+  for (uint32_t i = 0; i < names.size(); i++) {
+    positions.push_back(static_cast<uint32_t>(ids.size()));
+    ids.push_back(first_id + i);
+  }
+  maybe_rebuild();
+  return true;
+}
+
+void WheelIndex::maybe_rebuild() {
+  size_t tail = ids.size() - indexed_count;
+  size_t limit = std::max(
+      config.min_rebuild,
+      static_cast<size_t>(config.rebuild_fraction * indexed_count));
+  if (tail > limit)
+    rebuild();
+}
+
+void WheelIndex::rebuild() {
+  // Sort contiguous copies, then write them back in tree order
+  std::vector<BuildEntry> entries(ids.size());
+  for (size_t p = 0; p < entries.size(); p++) {
+    entries[p].v = points.vector(p);
+    entries[p].id = ids[p];
+  }
+
+  nodes.clear();
+  nodes.reserve(2 * entries.size() / config.leaf_size + 1);
+  if (!entries.empty())
+    build_node(entries, 0, static_cast<uint32_t>(entries.size()));
+
+  for (size_t p = 0; p < entries.size(); p++) {
+    points.set(p, entries[p].v);
+    ids[p] = entries[p].id;
+    positions[entries[p].id] = static_cast<uint32_t>(p);
+  }
+  indexed_count = ids.size();
+}
+
+int32_t WheelIndex::build_node(std::vector<BuildEntry> &entries,
+                               uint32_t begin, uint32_t end) {
+  Node node;
+  node.begin = begin;
+  node.end = end;
+  node.lo = entries[begin].v;
+  node.hi = entries[begin].v;
+  for (uint32_t i = begin + 1; i < end; i++) {
+    for (int d = 0; d < DIMENSIONS; d++) {
+      node.lo[d] = std::min(node.lo[d], entries[i].v[d]);
+      node.hi[d] = std::max(node.hi[d], entries[i].v[d]);
+    }
+  }
+
+  int32_t index = static_cast<int32_t>(nodes.size());
+  nodes.push_back(node);
+  if (end - begin <= config.leaf_size)
+    return index;
+
+  // Split the widest dimension at its median
+  int axis = 0;
+  for (int d = 1; d < DIMENSIONS; d++) {
+    if (node.hi[d] - node.lo[d] > node.hi[axis] - node.lo[axis])
+      axis = d;
+  }
+  if (node.hi[axis] == node.lo[axis])
+    return index; // All points equal: keep one oversized leaf
+
+  uint32_t mid = begin + (end - begin) / 2;
+  std::nth_element(entries.begin() + begin, entries.begin() + mid,
+                   entries.begin() + end,
+                   [axis](const BuildEntry &a, const BuildEntry &b) {
+                     return a.v[axis] < b.v[axis];
+                   });
+
+  int32_t left = build_node(entries, begin, mid);
+  int32_t right = build_node(entries, mid, end);
+  nodes[index].left = left;
+  nodes[index].right = right;
+  return index;
+}
+
+float WheelIndex::box_distance_sq(const Node &node,
+                                  const Vector &query) const {
+  float sum = 0.0f;
+  for (int d = 0; d < DIMENSIONS; d++) {
+    float delta =
+        std::max({node.lo[d] - query[d], 0.0f, query[d] - node.hi[d]});
+    sum += delta * delta;
+  }
+  return sum;
+}
+
+std::vector<WheelMatch> WheelIndex::knn(const Vector &query, size_t k) const {
+  std::vector<WheelMatch> result;
+  if (k == 0 || ids.empty())
+    return result;
+
+  // Max-heap of the k best (distance_sq, position)
+  std::priority_queue<std::pair<float, uint32_t>> best;
+  auto visit = [&](size_t position, float dist) {
+    if (best.size() < k) {
+      best.emplace(dist, static_cast<uint32_t>(position));
+    } else if (dist < best.top().first) {
+      best.pop();
+      best.emplace(dist, static_cast<uint32_t>(position));
+    }
+  };
+  auto bound = [&] {
+    return best.size() < k ? std::numeric_limits<float>::max()
+                           : best.top().first;
+  };
+
+  // Unindexed tail first: it tightens the bound before the tree walk
+  scan_points(points, indexed_count, ids.size(), query, visit);
+
+  // Depth-first, nearer child first; boxes beyond the bound are skipped
+  std::vector<std::pair<float, int32_t>> stack;
+  if (!nodes.empty())
+    stack.emplace_back(box_distance_sq(nodes[0], query), 0);
+  while (!stack.empty()) {
+    auto [box_dist, index] = stack.back();
+    stack.pop_back();
+    if (box_dist >= bound())
+      continue;
+
+    const Node &node = nodes[index];
+    if (node.left < 0) {
+      scan_points(points, node.begin, node.end, query, visit);
+      continue;
+    }
+    float left = box_distance_sq(nodes[node.left], query);
+    float right = box_distance_sq(nodes[node.right], query);
+    if (left <= right) {
+      stack.emplace_back(right, node.right);
+      stack.emplace_back(left, node.left);
+    } else {
+      stack.emplace_back(left, node.left);
+      stack.emplace_back(right, node.right);
+    }
+  }
+
+  result.resize(best.size());
+  for (size_t i = result.size(); i-- > 0;) {
+    result[i] = {ids[best.top().second], std::sqrt(best.top().first)};
+    best.pop();
+  }
+  return result;
+}
+
+std::vector<WheelMatch> WheelIndex::radius(const Vector &query,
+                                           float radius) const {
+  std::vector<WheelMatch> result;
+  if (radius < 0.0f || ids.empty())
+    return result;
+
+  float limit = radius * radius;
+  auto visit = [&](size_t position, float dist) {
+    if (dist <= limit)
+      result.push_back({ids[position], dist});
+  };
+
+  scan_points(points, indexed_count, ids.size(), query, visit);
+
+  std::vector<int32_t> stack;
+  if (!nodes.empty())
+    stack.push_back(0);
+  while (!stack.empty()) {
+    const Node &node = nodes[stack.back()];
+    stack.pop_back();
+    if (box_distance_sq(node, query) > limit)
+      continue;
+    if (node.left < 0) {
+      scan_points(points, node.begin, node.end, query, visit);
+    } else {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+
+  std::sort(result.begin(), result.end(),
+            [](const WheelMatch &a, const WheelMatch &b) {
+              return a.distance < b.distance;
+            });
+  for (auto &match : result) {
+    match.distance = std::sqrt(match.distance);
+  }
+  return result;
+}
+
+WheelIndex::Vector WheelIndex::get_vector(uint32_t id) const {
+  return points.vector(positions[id]);
+}
+
+// ================================================================
+// Persistence
+// ================================================================
+
+bool WheelIndex::save(const std::string &filepath) const {
+  std::ofstream out(filepath, std::ios::binary);
+  if (!out.is_open())
+    return false;
+
+  static_assert(std::is_trivially_copyable<Node>::value,
+                "nodes are written as raw bytes");
+  auto write = [&out](const void *data, size_t bytes) {
+    out.write(static_cast<const char *>(data),
+              static_cast<std::streamsize>(bytes));
+  };
+
+  uint32_t header[3] = {WHEEL_INDEX_MAGIC, WHEEL_INDEX_VERSION, DIMENSIONS};
+  uint64_t counts[3] = {ids.size(), indexed_count, nodes.size()};
+  write(header, sizeof(header));
+  write(counts, sizeof(counts));
+  write(nodes.data(), nodes.size() * sizeof(Node));
+  write(ids.data(), ids.size() * sizeof(uint32_t));
+  for (const auto &column : points.columns) {
+    write(column.data(), column.size() * sizeof(float));
+  }
+  for (const auto &name : names) {
+    uint32_t length = static_cast<uint32_t>(name.size());
+    write(&length, sizeof(length));
+    write(name.data(), length);
+  }
+  return out.good();
+}
+
+bool WheelIndex::load(const std::string &filepath) {
+  std::ifstream in(filepath, std::ios::binary);
+  if (!in.is_open())
+    return false;
+
+  in.seekg(0, std::ios::end);
+  uint64_t file_size = static_cast<uint64_t>(in.tellg());
+  in.seekg(0, std::ios::beg);
+
+  auto read = [&in](void *data, size_t bytes) {
+    in.read(static_cast<char *>(data), static_cast<std::streamsize>(bytes));
+    return in.good();
+  };
+  auto remaining = [&in, file_size]() {
+    std::streamoff pos = in.tellg();
+    return pos < 0 ? 0 : file_size - static_cast<uint64_t>(pos);
+  };
+
+  uint32_t header[3] = {};
+  uint64_t counts[3] = {};
+  if (!read(header, sizeof(header)) || header[0] != WHEEL_INDEX_MAGIC ||
+      header[1] != WHEEL_INDEX_VERSION || header[2] != DIMENSIONS ||
+      !read(counts, sizeof(counts)) || counts[1] > counts[0]) {
+    std::cerr << "[WheelIndex] Not a wheel index: " << filepath << std::endl;
+    return false;
+  }
+
+  // Every size is checked against the bytes left before anything is
+  // allocated, so a corrupt header cannot trigger a huge resize. Each
+  // wheel needs an id, DIMENSIONS floats and a name length at least.
+  const uint64_t wheel_bytes = sizeof(uint32_t) * (DIMENSIONS + 2);
+  uint64_t left = remaining();
+  if (counts[2] > left / sizeof(Node) ||
+      counts[0] > (left - counts[2] * sizeof(Node)) / wheel_bytes) {
+    std::cerr << "[WheelIndex] Corrupt wheel index: " << filepath
+              << std::endl;
+    return false;
+  }
+
+  // Read into a fresh index so a truncated file leaves this one intact
+  WheelIndex loaded(config);
+  size_t count = counts[0];
+  loaded.indexed_count = counts[1];
+  loaded.nodes.resize(counts[2]);
+  loaded.ids.resize(count);
+  loaded.points.resize(count);
+  loaded.names.resize(count);
+  bool ok = read(loaded.nodes.data(), counts[2] * sizeof(Node)) &&
+            read(loaded.ids.data(), count * sizeof(uint32_t));
+  for (auto &column : loaded.points.columns) {
+    ok = ok && read(column.data(), count * sizeof(float));
+  }
+  for (size_t i = 0; ok && i < count; i++) {
+    uint32_t length = 0;
+    ok = read(&length, sizeof(length)) && length <= remaining();
+    if (!ok)
+      break;
+    loaded.names[i].resize(length);
+    ok = read(&loaded.names[i][0], length);
+  }
+
+  // ids must be a permutation
+  loaded.positions.assign(count, UINT32_MAX);
+  for (size_t p = 0; ok && p < count; p++) {
+    uint32_t id = loaded.ids[p];
+    ok = id < count && loaded.positions[id] == UINT32_MAX;
+    if (ok)
+      loaded.positions[id] = static_cast<uint32_t>(p);
+  }
+  // build_node() numbers children after their parent; requiring that
+  // rules out cycles, which would make knn/radius traversal loop forever
+  auto valid_child = [&loaded](size_t parent, int32_t child) {
+    return child == -1 ||
+           (child > static_cast<int64_t>(parent) &&
+            child < static_cast<int64_t>(loaded.nodes.size()));
+  };
+  for (size_t i = 0; ok && i < loaded.nodes.size(); i++) {
+    const Node &node = loaded.nodes[i];
+    ok = node.begin <= node.end && node.end <= loaded.indexed_count &&
+         valid_child(i, node.left) && valid_child(i, node.right) &&
+         (node.left < 0) == (node.right < 0);
+    // Children split their parent's range exactly, as build_node() does,
+    // so no indexed point falls between them
+    if (ok && node.left >= 0) {
+      const Node &left = loaded.nodes[node.left];
+      const Node &right = loaded.nodes[node.right];
+      ok = left.begin == node.begin && left.end == right.begin &&
+           right.end == node.end;
+    }
+  }
+  // Every indexed point must be reachable from the root at node 0
+  if (ok && loaded.indexed_count > 0) {
+    ok = !loaded.nodes.empty() && loaded.nodes[0].begin == 0 &&
+         loaded.nodes[0].end == loaded.indexed_count;
+  }
+  if (!ok) {
+    std::cerr << "[WheelIndex] Corrupt wheel index: " << filepath
+              << std::endl;
+    return false;
+  }
+
+  *this = std::move(loaded);
+  return true;
+}
@@ -0,0 +1,128 @@
+#ifndef NANOBRAIN_WHEEL_INDEX_H
+#define NANOBRAIN_WHEEL_INDEX_H
+
+/**
+ * NanoBrain Linguistic Wheel Index
+ *
+ * Nearest-neighbour index over 11-D wheel vectors
+ * (LinguisticWheel::to_11d_vector()), so a vocabulary mapped into wheel
+ * space can be asked which concepts lie near a given wheel.
+ *
+ * - kd-tree with leaf buckets, split at the median of the widest
+ *   dimension; points live in SoA columns in tree order, so a leaf scan
+ *   reads each dimension contiguously
+ * - Nodes keep bounding boxes: kNN and radius queries prune on the exact
+ *   box distance
+ * - insert() appends to an unindexed tail that queries scan linearly; the
+ *   tree is rebuilt once the tail outgrows rebuild_fraction of the tree
+ * - save()/load() write the tree as is, so loading needs no rebuild
+ *
+ * Distance is Euclidean over the raw 11-D vector (phase is not wrapped).
+ */
+
+#include "nanobrain_philosophical.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Query result: concept id (insertion order) and distance
+ */
+struct WheelMatch {
+  uint32_t id;
+  float distance;
+};
+
+/**
+ * Index configuration
+ */
+struct WheelIndexConfig {
+  size_t leaf_size = 32;          // Max points per leaf
+  float rebuild_fraction = 0.25f; // Unindexed tail / tree size to rebuild
+  size_t min_rebuild = 4096;      // Tail size always tolerated
+};
+
+/**
+ * Linguistic Wheel Nearest-Neighbour Index
+ *
+ * Queries are const and may run concurrently; insert(), rebuild() and
+ * load() must not overlap with them.
+ */
+class WheelIndex {
+public:
+  using Vector = std::array<float, LinguisticWheelSet::DIMENSIONS>;
+
+  explicit WheelIndex(const WheelIndexConfig &config = {});
+
+  // ================================================================
+  // Building
+  // ================================================================
+
+  // Replace the contents with names[i] -> wheels row i and build the tree.
+  // False if the sizes differ.
+  bool build(std::vector<std::string> names, const LinguisticWheelSet &wheels);
+
+  // Add one concept; returns its id
+  uint32_t insert(const std::string &name, const Vector &vector);
+
+  // Add many concepts (names[i] -> wheels row i); false if sizes differ
+  bool insert(const std::vector<std::string> &names,
+              const LinguisticWheelSet &wheels);
+
+  // Index the unindexed tail now
+  void rebuild();
+
+  // ================================================================
+  // Queries
+  // ================================================================
+
+  // The k nearest concepts, nearest first
+  std::vector<WheelMatch> knn(const Vector &query, size_t k) const;
+
+  // Every concept within radius, nearest first
+  std::vector<WheelMatch> radius(const Vector &query, float radius) const;
+
+  size_t size() const { return ids.size(); }
+  size_t get_indexed_count() const { return indexed_count; }
+  const std::string &get_name(uint32_t id) const { return names[id]; }
+  Vector get_vector(uint32_t id) const;
+
+  // ================================================================
+  // Persistence
+  // ================================================================
+
+  bool save(const std::string &filepath) const;
+  bool load(const std::string &filepath);
+
+private:
+  static constexpr int DIMENSIONS = LinguisticWheelSet::DIMENSIONS;
+
+  struct Node {
+    uint32_t begin = 0; // Point range in tree order
+    uint32_t end = 0;
+    int32_t left = -1; // Children; -1 for a leaf
+    int32_t right = -1;
+    Vector lo{}; // Bounding box
+    Vector hi{};
+  };
+
+  WheelIndexConfig config;
+  std::vector<std::string> names; // By id
+  LinguisticWheelSet points;      // Tree order, then the unindexed tail
+  std::vector<uint32_t> ids;      // Tree position -> id
+  std::vector<uint32_t> positions; // Id -> tree position
+  std::vector<Node> nodes;        // nodes[0] is the root
+  size_t indexed_count = 0;
+
+  struct BuildEntry;
+
+  int32_t build_node(std::vector<BuildEntry> &entries, uint32_t begin,
+                     uint32_t end);
+  float box_distance_sq(const Node &node, const Vector &query) const;
+  void maybe_rebuild();
+};
+
+#endif // NANOBRAIN_WHEEL_INDEX_H
@@ -3,7 +3,6 @@
 #include <chrono>
 #include <cmath>
 #include <numeric>
-#include <random>
 
 // ================================================================
 // WilczekTimeCrystal Implementation
@@ -18,10 +17,7 @@ void WilczekTimeCrystal::initialize() {
   spins.clear();
   spins.resize(config.num_spins);
 
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
-  std::normal_distribution<float> disorder(0.0f, config.disorder_strength);
+  CounterRng rng(config.seed, RandomSubsystem::WilczekInit);
 
   for (int i = 0; i < config.num_spins; i++) {
     spins[i].index = i;
@@ -29,7 +25,7 @@ void WilczekTimeCrystal::initialize() {
         (i % 2 == 0) ? 1.0f : -1.0f; // Antiferromagnetic init
     spins[i].x_component = 0.0f;
     spins[i].coupling = config.interaction_strength;
-    spins[i].local_field = disorder(gen);
+    spins[i].local_field = rng.normal(0.0f, config.disorder_strength);
   }
 
   magnetization_history.clear();
@@ -95,12 +91,11 @@ void WilczekTimeCrystal::apply_interaction() {
 void WilczekTimeCrystal::apply_disorder() {
   if (!config.many_body_localized) {
     // Without MBL, system thermalizes
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<float> noise(0.0f, 0.01f);
+    CounterRng rng(config.seed, RandomSubsystem::WilczekDisorder, 0,
+                   static_cast<uint64_t>(period_count));
 
     for (auto &spin : spins) {
-      spin.z_component += noise(gen);
+      spin.z_component += rng.normal(0.0f, 0.01f);
       spin.z_component = std::max(-1.0f, std::min(1.0f, spin.z_component));
     }
   }
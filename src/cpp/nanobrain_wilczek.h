@@ -30,6 +30,7 @@ struct WilczekConfig {
   float disorder_strength = 0.1f;    // Disorder in the system
   int driving_period = 10;           // Period of discrete time crystal
   bool many_body_localized = true;   // MBL protection
+  uint64_t seed = NANOBRAIN_DEFAULT_SEED; // Disorder draws
 };
 
 // ================================================================
@@ -186,40 +186,40 @@ void demo_neuron_mapping(TimeCrystalKernel &tc_kernel,
   // Build full hierarchy
   mapper.create_neuron_crystal_hierarchy(neuron_id);
 
-  const auto *neuron = mapper.get_neuron(neuron_id);
-  if (neuron) {
+  NeuronTimeCrystalMap neuron;
+  if (mapper.get_neuron(neuron_id, neuron)) {
     std::cout << std::fixed << std::setprecision(4);
 
     std::cout << "  Neuron: " << neuron_id << "\n\n";
 
     // Soma
     std::cout << "  Soma:\n";
-    std::cout << "    " << neuron_segment_to_string(neuron->soma) << "\n";
+    std::cout << "    " << neuron_segment_to_string(neuron.soma) << "\n";
     std::cout << "    Coherence: "
-              << neuron->soma.time_crystal_state.temporal_coherence << "\n\n";
+              << neuron.soma.time_crystal_state.temporal_coherence << "\n\n";
 
     // Axon summary
-    std::cout << "  Axon Segments: " << neuron->axon_segments.size() << "\n";
-    if (!neuron->axon_segments.empty()) {
+    std::cout << "  Axon Segments: " << neuron.axon_segments.size() << "\n";
+    if (!neuron.axon_segments.empty()) {
       std::cout << "    First: "
-                << neuron_segment_to_string(neuron->axon_segments[0]) << "\n";
+                << neuron_segment_to_string(neuron.axon_segments[0]) << "\n";
       std::cout << "    Last: "
-                << neuron_segment_to_string(neuron->axon_segments.back())
+                << neuron_segment_to_string(neuron.axon_segments.back())
                 << "\n";
     }
 
     // Dendrite summary
-    std::cout << "\n  Dendrite Segments: " << neuron->dendrite_segments.size()
+    std::cout << "\n  Dendrite Segments: " << neuron.dendrite_segments.size()
               << "\n";
-    if (!neuron->dendrite_segments.empty()) {
+    if (!neuron.dendrite_segments.empty()) {
       std::cout << "    First: "
-                << neuron_segment_to_string(neuron->dendrite_segments[0])
+                << neuron_segment_to_string(neuron.dendrite_segments[0])
                 << "\n";
     }
 
     // Scale hierarchy
     std::cout << "\n  Scale Hierarchy:\n";
-    for (const auto &[level, segments] : neuron->scale_hierarchy) {
+    for (const auto &[level, segments] : neuron.scale_hierarchy) {
       std::cout << "    Level " << level << ": " << segments.size()
                 << " segments\n";
     }
@@ -227,7 +227,7 @@ void demo_neuron_mapping(TimeCrystalKernel &tc_kernel,
     // Sample triplet bands
     std::cout << "\n  Sample Triplet Bands:\n";
     int sample_count = 0;
-    for (const auto &seg : neuron->axon_segments) {
+    for (const auto &seg : neuron.axon_segments) {
       if (sample_count++ >= 3)
         break;
       auto bands = mapper.get_segment_bands(seg.segment_id);